@@ -0,0 +1,246 @@
+#include "BTTreeLoadBenchmark.h"
+#include "../Core/BTCompiledTree.h"
+#include "../Core/BTComposite.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/// <summary>
+/// 従来の読み込み処理の再帰部分（リンク配列全体から子を探す）
+/// </summary>
+BTNodePtr BuildLegacyNode(const nlohmann::json& nodeJson,
+                          const std::unordered_map<int, nlohmann::json>& nodeMap,
+                          const std::vector<nlohmann::json>& links,
+                          std::unordered_set<int>& visitedNodes,
+                          const BTTreeDefinition::NodeFactory& factory) {
+    int nodeId = nodeJson["id"];
+    if (!visitedNodes.insert(nodeId).second) {
+        return nullptr;
+    }
+
+    BTNodePtr node = factory(nodeJson["type"].get<std::string>());
+    if (!node) {
+        return nullptr;
+    }
+    if (nodeJson.contains("parameters") && !nodeJson["parameters"].is_null()) {
+        node->ApplyParameters(nodeJson["parameters"]);
+    }
+    if (nodeJson.contains("displayName")) {
+        node->SetName(nodeJson["displayName"]);
+    }
+
+    if (auto composite = std::dynamic_pointer_cast<BTComposite>(node)) {
+        std::vector<int> childIds;
+        for (const auto& link : links) {
+            if (link["sourceNodeId"] == nodeId) {
+                childIds.push_back(link["targetNodeId"]);
+            }
+        }
+        for (int childId : childIds) {
+            auto childIt = nodeMap.find(childId);
+            if (childIt != nodeMap.end()) {
+                if (BTNodePtr child = BuildLegacyNode(childIt->second, nodeMap, links, visitedNodes, factory)) {
+                    composite->AddChild(child);
+                }
+            }
+        }
+    }
+    return node;
+}
+
+} // namespace
+
+std::string BTTreeLoadBenchmark::GenerateTreeJSON(size_t nodeCount, uint32_t fanout,
+                                                  const BTTreeDefinition::NodeFactory& factory,
+                                                  const std::vector<std::string>& compositeTypes,
+                                                  const std::vector<std::string>& leafTypes,
+                                                  uint32_t seed) {
+    nlohmann::json json;
+    json["version"] = "1.0";
+    json["nodes"] = nlohmann::json::array();
+    json["links"] = nlohmann::json::array();
+
+    if (nodeCount == 0 || fanout == 0 || compositeTypes.empty() || leafTypes.empty()) {
+        return json.dump();
+    }
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> compositeDist(0, compositeTypes.size() - 1);
+    std::uniform_int_distribution<size_t> leafDist(0, leafTypes.size() - 1);
+
+    // 葉ノードのパラメータはファクトリ生成ノードの既定値を使う（タイプごとに1度だけ生成）
+    std::unordered_map<std::string, nlohmann::json> leafParameters;
+    for (const std::string& type : leafTypes) {
+        BTNodePtr node = factory ? factory(type) : nullptr;
+        leafParameters[type] = node ? node->ExtractParameters() : nlohmann::json::object();
+    }
+
+    // 幅優先の完全木：ノード i の子は i * fanout + 1 〜 i * fanout + fanout
+    auto& nodes = json["nodes"];
+    auto& links = json["links"];
+    int linkId = 0;
+    for (size_t i = 0; i < nodeCount; ++i) {
+        size_t firstChild = i * fanout + 1;
+        bool isComposite = firstChild < nodeCount;
+
+        nlohmann::json nodeJson;
+        nodeJson["id"] = static_cast<int>(i + 1);
+        if (isComposite) {
+            nodeJson["type"] = compositeTypes[compositeDist(rng)];
+        }
+        else {
+            const std::string& type = leafTypes[leafDist(rng)];
+            nodeJson["type"] = type;
+            nodeJson["parameters"] = leafParameters[type];
+        }
+        nodes.push_back(std::move(nodeJson));
+
+        for (size_t c = firstChild; c < firstChild + fanout && c < nodeCount; ++c) {
+            links.push_back({
+                {"id", ++linkId},
+                {"sourceNodeId", static_cast<int>(i + 1)},
+                {"targetNodeId", static_cast<int>(c + 1)}
+            });
+        }
+    }
+
+    // リンクの記述順に依存しないことを確かめるため、順序をシャッフルしておく
+    // （兄弟間の順序は保つ必要があるので、親ごとのまとまりを維持したまま入れ替える）
+    std::vector<nlohmann::json> groups;
+    for (size_t i = 0; i < links.size(); i += fanout) {
+        nlohmann::json group = nlohmann::json::array();
+        for (size_t j = i; j < i + fanout && j < links.size(); ++j) {
+            group.push_back(std::move(links[j]));
+        }
+        groups.push_back(std::move(group));
+    }
+    std::shuffle(groups.begin(), groups.end(), rng);
+    links = nlohmann::json::array();
+    for (auto& group : groups) {
+        for (auto& link : group) {
+            links.push_back(std::move(link));
+        }
+    }
+
+    return json.dump();
+}
+
+BTTreeLoadBenchmark::Result BTTreeLoadBenchmark::Run(size_t nodeCount,
+                                                     const BTTreeDefinition::NodeFactory& factory,
+                                                     const std::vector<std::string>& compositeTypes,
+                                                     const std::vector<std::string>& leafTypes) {
+    Result result;
+
+    std::string text = GenerateTreeJSON(nodeCount, kFanout, factory, compositeTypes, leafTypes,
+                                        static_cast<uint32_t>(nodeCount));
+    result.jsonBytes = text.size();
+
+    // パース
+    auto t0 = Clock::now();
+    nlohmann::json json = nlohmann::json::parse(text);
+    auto t1 = Clock::now();
+
+    // ノードテーブル・隣接リスト構築
+    BTTreeDefinition definition;
+    bool loaded = definition.LoadFromJSON(json);
+    auto t2 = Clock::now();
+
+    // ノードグラフ生成
+    BTNodePtr root = loaded ? definition.Instantiate(factory) : nullptr;
+    auto t3 = Clock::now();
+
+    // フラット配列化
+    BTCompiledTree compiledTree;
+    compiledTree.Compile(root);
+    auto t4 = Clock::now();
+
+    // 従来の読み込み（パース済みの DOM は上で書き換わるので、同じテキストをパースし直してから計測）
+    nlohmann::json legacyJson = nlohmann::json::parse(text);
+    auto t5 = Clock::now();
+    BTNodePtr legacyRoot = BuildLegacy(legacyJson, factory);
+    auto t6 = Clock::now();
+
+    result.nodeCount = definition.GetNodeCount();
+    result.linkCount = definition.GetLinkCount();
+    result.parseMs = ElapsedMs(t0, t1);
+    result.indexMs = ElapsedMs(t1, t2);
+    result.instantiateMs = ElapsedMs(t2, t3);
+    result.compileMs = ElapsedMs(t3, t4);
+    result.legacyMs = ElapsedMs(t5, t6);
+    result.matches = root && legacyRoot && IsSameGraph(root.get(), legacyRoot.get());
+
+    results_.push_back(result);
+    return result;
+}
+
+BTNodePtr BTTreeLoadBenchmark::BuildLegacy(const nlohmann::json& json, const BTTreeDefinition::NodeFactory& factory) {
+    if (!factory || !json.contains("version") || json["version"] != "1.0") {
+        return nullptr;
+    }
+
+    // ノードマップを作成（ID → ノード情報）
+    std::unordered_map<int, nlohmann::json> nodeMap;
+    if (json.contains("nodes")) {
+        for (const auto& nodeJson : json["nodes"]) {
+            nodeMap[nodeJson["id"].get<int>()] = nodeJson;
+        }
+    }
+
+    std::vector<nlohmann::json> links;
+    if (json.contains("links")) {
+        links = json["links"].get<std::vector<nlohmann::json>>();
+    }
+
+    // ルートノードを探す（親リンクを持たないノード）
+    std::unordered_set<int> childNodeIds;
+    for (const auto& link : links) {
+        childNodeIds.insert(link["targetNodeId"].get<int>());
+    }
+    int rootNodeId = -1;
+    for (const auto& [nodeId, nodeJson] : nodeMap) {
+        if (!childNodeIds.contains(nodeId)) {
+            rootNodeId = nodeId;
+            break;
+        }
+    }
+    if (rootNodeId == -1) {
+        return nullptr;
+    }
+
+    std::unordered_set<int> visitedNodes;
+    return BuildLegacyNode(nodeMap[rootNodeId], nodeMap, links, visitedNodes, factory);
+}
+
+bool BTTreeLoadBenchmark::IsSameGraph(const BTNode* a, const BTNode* b) {
+    if (!a || !b) {
+        return a == b;
+    }
+    if (a->GetName() != b->GetName() || a->IsComposite() != b->IsComposite()) {
+        return false;
+    }
+    if (!a->IsComposite()) {
+        return true;
+    }
+
+    const auto& childrenA = static_cast<const BTComposite*>(a)->GetChildren();
+    const auto& childrenB = static_cast<const BTComposite*>(b)->GetChildren();
+    if (childrenA.size() != childrenB.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < childrenA.size(); ++i) {
+        if (!IsSameGraph(childrenA[i].get(), childrenB[i].get())) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include "../Core/BTTreeDefinition.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// ビヘイビアツリー読み込みのベンチマーク
+/// 合成した大規模ツリー JSON を生成し、パース・インデックス構築・ノード生成・
+/// フラット化の各段階の所要時間を計測する
+/// 同じ JSON を従来の読み込み（ノードごとにリンク配列全体を走査する O(N^2) の実装）でも組み立て、
+/// 所要時間と組み立てたノードグラフが一致するかを比べる
+/// </summary>
+class BTTreeLoadBenchmark {
+public:
+    // 合成ツリーの子の数
+    static constexpr uint32_t kFanout = 4;
+
+    /// <summary>
+    /// 計測結果
+    /// </summary>
+    struct Result {
+        size_t nodeCount = 0;       // ノード数
+        size_t linkCount = 0;       // リンク数
+        size_t jsonBytes = 0;       // JSON テキストのサイズ
+        double parseMs = 0.0;       // JSON テキストのパース時間
+        double indexMs = 0.0;       // ノードテーブル・隣接リスト構築時間
+        double instantiateMs = 0.0; // ノードグラフ生成時間
+        double compileMs = 0.0;     // フラット配列化の時間
+        double legacyMs = 0.0;      // 従来の読み込みでのノードグラフ構築時間（パースを除く）
+        bool matches = false;       // 従来の読み込みと同じノードグラフになったか
+
+        /// <summary>
+        /// 合計時間の取得
+        /// </summary>
+        /// <returns>合計時間（ミリ秒）</returns>
+        double GetTotalMs() const { return parseMs + indexMs + instantiateMs + compileMs; }
+
+        /// <summary>
+        /// ノードグラフ構築時間（インデックス構築＋ノード生成）の取得
+        /// </summary>
+        /// <returns>構築時間（ミリ秒）。legacyMs と比べる</returns>
+        double GetBuildMs() const { return indexMs + instantiateMs; }
+    };
+
+    /// <summary>
+    /// 合成ツリーの JSON テキストを生成
+    /// 各ノードが fanout 個の子を持つ完全木を作り、葉には leafTypes のノードを置く
+    /// </summary>
+    /// <param name="nodeCount">ノード数</param>
+    /// <param name="fanout">コンポジットあたりの子の数</param>
+    /// <param name="factory">ノード生成関数（葉のパラメータ既定値の取得に使用）</param>
+    /// <param name="compositeTypes">コンポジットのノードタイプ名</param>
+    /// <param name="leafTypes">葉のノードタイプ名</param>
+    /// <param name="seed">乱数シード</param>
+    /// <returns>ツリー JSON テキスト</returns>
+    static std::string GenerateTreeJSON(size_t nodeCount, uint32_t fanout,
+                                        const BTTreeDefinition::NodeFactory& factory,
+                                        const std::vector<std::string>& compositeTypes,
+                                        const std::vector<std::string>& leafTypes,
+                                        uint32_t seed);
+
+    /// <summary>
+    /// 1回分のベンチマークを実行して結果を記録
+    /// </summary>
+    /// <param name="nodeCount">ノード数</param>
+    /// <param name="factory">ノード生成関数</param>
+    /// <param name="compositeTypes">コンポジットのノードタイプ名</param>
+    /// <param name="leafTypes">葉のノードタイプ名</param>
+    /// <returns>計測結果</returns>
+    Result Run(size_t nodeCount, const BTTreeDefinition::NodeFactory& factory,
+               const std::vector<std::string>& compositeTypes,
+               const std::vector<std::string>& leafTypes);
+
+    /// <summary>
+    /// 従来の読み込み処理でノードグラフを構築（比較用）
+    /// ID → ノード JSON の表を作り、コンポジットごとにリンク配列全体を走査して子を集める
+    /// </summary>
+    /// <param name="json">パース済みのツリー JSON</param>
+    /// <param name="factory">ノード生成関数</param>
+    /// <returns>ルートノード（失敗時は nullptr）</returns>
+    static BTNodePtr BuildLegacy(const nlohmann::json& json, const BTTreeDefinition::NodeFactory& factory);
+
+    /// <summary>
+    /// 2つのノードグラフが同じ形か（深さ優先でタイプ名と子の数を比べる）
+    /// </summary>
+    static bool IsSameGraph(const BTNode* a, const BTNode* b);
+
+    /// <summary>
+    /// 記録済みの結果を取得
+    /// </summary>
+    /// <returns>計測結果のリスト</returns>
+    const std::vector<Result>& GetResults() const { return results_; }
+
+    /// <summary>
+    /// 記録済みの結果をクリア
+    /// </summary>
+    void ClearResults() { results_.clear(); }
+
+private:
+    // 計測結果
+    std::vector<Result> results_;
+};
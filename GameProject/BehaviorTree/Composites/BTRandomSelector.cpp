@@ -1,4 +1,5 @@
 #include "BTRandomSelector.h"
+#include "../Core/BTProfiler.h"
 #include "RandomEngine.h"
 #include <algorithm>
 
@@ -23,7 +24,7 @@ BTNodeStatus BTRandomSelector::Execute(BTBlackboard* blackboard) {
     // シャッフル順で実行（前回の Running 位置から継続）
     for (size_t i = currentShuffledIdx_; i < shuffledIndices_.size(); ++i) {
         size_t idx = shuffledIndices_[i];
-        BTNodeStatus childStatus = children_[idx]->Execute(blackboard);
+        BTNodeStatus childStatus = BTExecuteNode(children_[idx].get(), blackboard);
 
         if (childStatus == BTNodeStatus::Success) {
             needsShuffle_ = true;  // 次回はシャッフル
@@ -50,6 +51,13 @@ void BTRandomSelector::Reset() {
     needsShuffle_ = true;
 }
 
+BTNode* BTRandomSelector::GetRunningChild() const {
+    if (status_ != BTNodeStatus::Running || currentShuffledIdx_ >= shuffledIndices_.size()) {
+        return nullptr;
+    }
+    return children_[shuffledIndices_[currentShuffledIdx_]].get();
+}
+
 void BTRandomSelector::ShuffleIndices() {
     shuffledIndices_.resize(children_.size());
     for (size_t i = 0; i < children_.size(); ++i) {
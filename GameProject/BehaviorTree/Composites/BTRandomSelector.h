@@ -31,6 +31,12 @@ public:
     /// </summary>
     void Reset() override;
 
+    /// <summary>
+    /// 実行中の子ノードを取得
+    /// </summary>
+    /// <returns>Running を返した子ノード（実行中でなければ nullptr）</returns>
+    BTNode* GetRunningChild() const override;
+
 private: // プライベートメンバー関数
     /// <summary>
     /// 子ノードのインデックスをシャッフル
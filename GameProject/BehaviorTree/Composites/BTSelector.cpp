@@ -1,4 +1,5 @@
 #include "BTSelector.h"
+#include "../Core/BTProfiler.h"
 
 BTSelector::BTSelector() {
     name_ = "Selector";
@@ -11,7 +12,7 @@ BTNodeStatus BTSelector::Execute(BTBlackboard* blackboard) {
 
     // 前回 Running だった場合、その子ノードから続行
     for (size_t i = currentChildIndex_; i < children_.size(); ++i) {
-        BTNodeStatus childStatus = children_[i]->Execute(blackboard);
+        BTNodeStatus childStatus = BTExecuteNode(children_[i].get(), blackboard);
 
         if (childStatus == BTNodeStatus::Success) {
             // 成功したら即座に成功を返す
@@ -1,4 +1,5 @@
 #include "BTSequence.h"
+#include "../Core/BTProfiler.h"
 
 BTSequence::BTSequence() {
     name_ = "Sequence";
@@ -11,7 +12,7 @@ BTNodeStatus BTSequence::Execute(BTBlackboard* blackboard) {
 
     // 前回 Running だった場合、その子ノードから続行
     for (size_t i = currentChildIndex_; i < children_.size(); ++i) {
-        BTNodeStatus childStatus = children_[i]->Execute(blackboard);
+        BTNodeStatus childStatus = BTExecuteNode(children_[i].get(), blackboard);
 
         if (childStatus == BTNodeStatus::Failure) {
             // 失敗したら即座に失敗を返す
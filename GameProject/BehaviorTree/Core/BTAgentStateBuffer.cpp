@@ -0,0 +1,65 @@
+#include "BTAgentStateBuffer.h"
+#include "BTCompiledTree.h"
+#include <algorithm>
+#include <utility>
+
+BTAgentStateBuffer::~BTAgentStateBuffer() = default;
+
+void BTAgentStateBuffer::Initialize(const BTCompiledTree& tree, size_t agentCount) {
+    Release();
+
+    // 状態を持たないツリーでも有効なアドレスを返せるよう最低1バイト確保する
+    size_t alignment = std::max(tree.GetStateAlignment(), alignof(std::max_align_t));
+    stride_ = std::max<size_t>(tree.GetStateSize(), 1);
+    stride_ = (stride_ + alignment - 1) / alignment * alignment;
+    agentCount_ = agentCount;
+    tree_ = &tree;
+
+    if (agentCount_ == 0) {
+        return;
+    }
+
+    std::align_val_t align{ alignment };
+    data_ = std::unique_ptr<std::byte[], AlignedDeleter>(
+        static_cast<std::byte*>(::operator new[](stride_ * agentCount_, align)),
+        AlignedDeleter{ align });
+
+    std::fill(data_.get(), data_.get() + stride_ * agentCount_, std::byte{ 0 });
+    for (size_t i = 0; i < agentCount_; ++i) {
+        tree_->InitializeState(GetAgentState(i));
+    }
+}
+
+void BTAgentStateBuffer::Release() {
+    data_.reset();
+    tree_ = nullptr;
+    agentCount_ = 0;
+    stride_ = 0;
+}
+
+void BTAgentStateBuffer::InitializeAgent(size_t agentIndex) {
+    std::byte* block = GetAgentState(agentIndex);
+    if (!block || !tree_) {
+        return;
+    }
+
+    std::fill(block, block + stride_, std::byte{ 0 });
+    tree_->InitializeState(block);
+}
+
+void BTAgentStateBuffer::ResetAgent(size_t agentIndex) {
+    std::byte* block = GetAgentState(agentIndex);
+    if (!block || !tree_) {
+        return;
+    }
+
+    // 評価結果のキャッシュなど、完了をまたいで保持する状態は残す
+    tree_->ResetState(block);
+}
+
+void BTAgentStateBuffer::Swap(BTAgentStateBuffer& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(tree_, other.tree_);
+    std::swap(agentCount_, other.agentCount_);
+    std::swap(stride_, other.stride_);
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+
+class BTCompiledTree;
+
+/// <summary>
+/// エージェントのランタイム状態ブロック
+/// 共有する BTCompiledTree のレイアウトに従い、エージェント数分の状態を
+/// 1つの連続領域に固定ストライドで並べる（1体なら単独の状態ブロックとして使う）
+/// </summary>
+class BTAgentStateBuffer {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    BTAgentStateBuffer() = default;
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~BTAgentStateBuffer();
+
+    BTAgentStateBuffer(const BTAgentStateBuffer&) = delete;
+    BTAgentStateBuffer& operator=(const BTAgentStateBuffer&) = delete;
+
+    /// <summary>
+    /// ツリーのレイアウトで領域を確保し、全エージェントの状態を初期化
+    /// </summary>
+    /// <param name="tree">共有するコンパイル済みツリー</param>
+    /// <param name="agentCount">エージェント数</param>
+    void Initialize(const BTCompiledTree& tree, size_t agentCount = 1);
+
+    /// <summary>
+    /// 領域の解放
+    /// </summary>
+    void Release();
+
+    /// <summary>
+    /// 指定エージェントの状態を確保直後と同じ状態に作り直す（持ち越す状態も消す）
+    /// </summary>
+    /// <param name="agentIndex">エージェント番号</param>
+    void InitializeAgent(size_t agentIndex);
+
+    /// <summary>
+    /// 指定エージェントの状態を初期状態に戻す
+    /// 完了をまたいで保持する状態（BTNode::IsStatePersistent）は残す
+    /// </summary>
+    /// <param name="agentIndex">エージェント番号</param>
+    void ResetAgent(size_t agentIndex);
+
+    /// <summary>
+    /// 領域とレイアウト元のツリーを入れ替え（状態を移し替えたバッファへの差し替え用）
+    /// </summary>
+    /// <param name="other">入れ替え先</param>
+    void Swap(BTAgentStateBuffer& other) noexcept;
+
+    /// <summary>
+    /// 指定エージェントの状態ブロックを取得
+    /// </summary>
+    /// <param name="agentIndex">エージェント番号</param>
+    /// <returns>状態ブロックの先頭（範囲外なら nullptr）</returns>
+    std::byte* GetAgentState(size_t agentIndex = 0) const {
+        return agentIndex < agentCount_ ? data_.get() + agentIndex * stride_ : nullptr;
+    }
+
+    /// <summary>
+    /// エージェント数の取得
+    /// </summary>
+    /// <returns>エージェント数</returns>
+    size_t GetAgentCount() const { return agentCount_; }
+
+    /// <summary>
+    /// エージェント1体あたりのバイト数
+    /// </summary>
+    /// <returns>ストライド</returns>
+    size_t GetStride() const { return stride_; }
+
+    /// <summary>
+    /// 確保済みの総バイト数
+    /// </summary>
+    /// <returns>バイト数</returns>
+    size_t GetTotalSize() const { return stride_ * agentCount_; }
+
+private:
+    /// <summary>
+    /// アライメント付きで確保した領域の解放
+    /// </summary>
+    struct AlignedDeleter {
+        std::align_val_t alignment;
+        void operator()(std::byte* ptr) const { ::operator delete[](ptr, alignment); }
+    };
+
+    // 状態領域（agentCount_ × stride_）
+    std::unique_ptr<std::byte[], AlignedDeleter> data_{ nullptr, AlignedDeleter{ std::align_val_t(alignof(std::max_align_t)) } };
+
+    // レイアウト元のツリー（非所有）
+    const BTCompiledTree* tree_ = nullptr;
+
+    // エージェント数・ストライド
+    size_t agentCount_ = 0;
+    size_t stride_ = 0;
+};
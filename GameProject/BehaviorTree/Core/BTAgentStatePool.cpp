@@ -0,0 +1,64 @@
+#include "BTAgentStatePool.h"
+#include "BTCompiledTree.h"
+
+BTAgentStatePool::BTAgentStatePool(std::shared_ptr<const BTCompiledTree> tree)
+    : tree_(std::move(tree)) {
+}
+
+uint32_t BTAgentStatePool::Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // 空きが無ければチャンクを足し、後ろのスロットから使われるよう逆順に積む
+    if (freeSlots_.empty()) {
+        auto chunk = std::make_unique<BTAgentStateBuffer>();
+        chunk->Initialize(*tree_, kAgentsPerChunk);
+        uint32_t base = static_cast<uint32_t>(chunks_.size() * kAgentsPerChunk);
+        chunks_.push_back(std::move(chunk));
+        for (size_t i = kAgentsPerChunk; i > 0; --i) {
+            freeSlots_.push_back(base + static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    uint32_t slot = freeSlots_.back();
+    freeSlots_.pop_back();
+    ++agentCount_;
+
+    // 前の持ち主の状態が残っているので初期状態で作り直す
+    chunks_[slot / kAgentsPerChunk]->InitializeAgent(slot % kAgentsPerChunk);
+    return slot;
+}
+
+void BTAgentStatePool::Release(uint32_t slot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slot / kAgentsPerChunk >= chunks_.size()) {
+        return;
+    }
+    freeSlots_.push_back(slot);
+    --agentCount_;
+}
+
+std::byte* BTAgentStatePool::GetAgentState(uint32_t slot) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slot / kAgentsPerChunk >= chunks_.size()) {
+        return nullptr;
+    }
+    return chunks_[slot / kAgentsPerChunk]->GetAgentState(slot % kAgentsPerChunk);
+}
+
+void BTAgentStatePool::ResetAgent(uint32_t slot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slot / kAgentsPerChunk >= chunks_.size()) {
+        return;
+    }
+    chunks_[slot / kAgentsPerChunk]->ResetAgent(slot % kAgentsPerChunk);
+}
+
+size_t BTAgentStatePool::GetStride() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return chunks_.empty() ? 0 : chunks_.front()->GetStride();
+}
+
+size_t BTAgentStatePool::GetAgentCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return agentCount_;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "BTAgentStateBuffer.h"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class BTCompiledTree;
+
+/// <summary>
+/// 同じツリーを共有するエージェントの状態ブロックをまとめて持つプール
+/// 状態は kAgentsPerChunk 体分ずつの BTAgentStateBuffer（チャンク）に固定ストライドで並べ、各エージェントにはスロット番号を配る
+/// チャンクは足すだけで動かさないため、配った状態ブロックのアドレスはスロットを返すまで変わらない
+/// </summary>
+class BTAgentStatePool {
+public:
+    /// <summary>
+    /// 1チャンクに並べるエージェント数
+    /// </summary>
+    static constexpr size_t kAgentsPerChunk = 64;
+
+    /// <summary>
+    /// 無効なスロット番号
+    /// </summary>
+    static constexpr uint32_t kInvalidSlot = UINT32_MAX;
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="tree">状態のレイアウト元のツリー（プールが生きている間は保持する）</param>
+    explicit BTAgentStatePool(std::shared_ptr<const BTCompiledTree> tree);
+
+    BTAgentStatePool(const BTAgentStatePool&) = delete;
+    BTAgentStatePool& operator=(const BTAgentStatePool&) = delete;
+
+    /// <summary>
+    /// スロットを確保して状態を初期化（空きが無ければチャンクを足す）
+    /// </summary>
+    /// <returns>スロット番号</returns>
+    uint32_t Acquire();
+
+    /// <summary>
+    /// スロットを返す
+    /// </summary>
+    /// <param name="slot">Acquire で得たスロット番号</param>
+    void Release(uint32_t slot);
+
+    /// <summary>
+    /// スロットの状態ブロックを取得
+    /// </summary>
+    /// <param name="slot">スロット番号</param>
+    /// <returns>状態ブロックの先頭（範囲外なら nullptr）</returns>
+    std::byte* GetAgentState(uint32_t slot) const;
+
+    /// <summary>
+    /// スロットの状態を初期状態に戻す（BTAgentStateBuffer::ResetAgent と同じく持ち越す状態は残す）
+    /// </summary>
+    /// <param name="slot">スロット番号</param>
+    void ResetAgent(uint32_t slot);
+
+    /// <summary>
+    /// レイアウト元のツリーを取得
+    /// </summary>
+    /// <returns>ツリー</returns>
+    const std::shared_ptr<const BTCompiledTree>& GetTree() const { return tree_; }
+
+    /// <summary>
+    /// エージェント1体あたりのバイト数
+    /// </summary>
+    /// <returns>ストライド</returns>
+    size_t GetStride() const;
+
+    /// <summary>
+    /// 使用中のスロット数
+    /// </summary>
+    /// <returns>エージェント数</returns>
+    size_t GetAgentCount() const;
+
+private:
+    // レイアウト元のツリー
+    std::shared_ptr<const BTCompiledTree> tree_;
+
+    // チャンク（それぞれ kAgentsPerChunk 体分の連続領域）と空きスロット
+    std::vector<std::unique_ptr<BTAgentStateBuffer>> chunks_;
+    std::vector<uint32_t> freeSlots_;
+    size_t agentCount_ = 0;
+
+    // スロットの確保・返却はボスの生成・破棄やツリーの差し替えから呼ばれるため保護する
+    mutable std::mutex mutex_;
+};
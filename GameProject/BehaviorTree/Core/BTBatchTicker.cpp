@@ -0,0 +1,150 @@
+#include "BTBatchTicker.h"
+#include "BTBlackboard.h"
+#include "BTCompiledTree.h"
+#include <algorithm>
+#include <cassert>
+
+BTBatchTicker::BTBatchTicker(uint32_t workerCount) {
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    rangeStorage_ = std::make_unique<WorkRange[]>(workerCount);
+    ranges_ = std::span<WorkRange>(rangeStorage_.get(), workerCount);
+    buffers_.resize(workerCount);
+
+    threads_.reserve(workerCount - 1);
+    for (uint32_t i = 1; i < workerCount; ++i) {
+        threads_.emplace_back(&BTBatchTicker::WorkerLoop, this, i);
+    }
+}
+
+BTBatchTicker::~BTBatchTicker() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    startCondition_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+void BTBatchTicker::Tick(std::span<const BTBatchAgent> agents, std::span<BTNodeStatus> results) {
+    assert(agents.size() == results.size());
+    uint32_t agentCount = static_cast<uint32_t>(std::min(agents.size(), results.size()));
+    if (agentCount == 0) {
+        lastCommandCount_ = 0;
+        return;
+    }
+
+    agents_ = agents;
+    results_ = results;
+
+    // エージェントが少なければワーカーを起こすコストの方が大きい
+    if (threads_.empty() || agentCount < kMinParallelAgents) {
+        for (uint32_t i = 0; i < agentCount; ++i) {
+            TickAgent(i, &buffers_[0]);
+        }
+    }
+    else {
+        // エージェントを連続した範囲に分けて各ワーカーへ配る
+        uint32_t workerCount = GetWorkerCount();
+        uint32_t chunk = agentCount / workerCount;
+        uint32_t remainder = agentCount % workerCount;
+        uint32_t begin = 0;
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            uint32_t size = chunk + (i < remainder ? 1u : 0u);
+            ranges_[i].next.store(begin, std::memory_order_relaxed);
+            ranges_[i].end = begin + size;
+            begin += size;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pendingWorkers_ = static_cast<uint32_t>(threads_.size());
+            ++generation_;
+        }
+        startCondition_.notify_all();
+
+        // 呼び出しスレッドもワーカー 0 として参加する
+        RunWorker(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        doneCondition_.wait(lock, [this] { return pendingWorkers_ == 0; });
+    }
+
+    agents_ = {};
+    results_ = {};
+
+    // 全員の評価が終わってから、エージェント順に副作用を適用
+    lastCommandCount_ = BTCommandBuffer::ExecuteMerged(buffers_);
+}
+
+void BTBatchTicker::WorkerLoop(uint32_t workerIndex) {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            startCondition_.wait(lock, [&] { return stopping_ || generation_ != seenGeneration; });
+            if (stopping_) {
+                return;
+            }
+            seenGeneration = generation_;
+        }
+
+        RunWorker(workerIndex);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last = (--pendingWorkers_ == 0);
+        }
+        if (last) {
+            doneCondition_.notify_one();
+        }
+    }
+}
+
+void BTBatchTicker::RunWorker(uint32_t workerIndex) {
+    BTCommandBuffer* buffer = &buffers_[workerIndex];
+    uint32_t agentIndex = 0;
+
+    // 自分の範囲
+    while (TryPop(ranges_[workerIndex], agentIndex)) {
+        TickAgent(agentIndex, buffer);
+    }
+
+    // 他のワーカーの範囲から盗む（隣から順に見て偏りを減らす）
+    uint32_t workerCount = GetWorkerCount();
+    for (uint32_t offset = 1; offset < workerCount; ++offset) {
+        WorkRange& victim = ranges_[(workerIndex + offset) % workerCount];
+        while (TryPop(victim, agentIndex)) {
+            TickAgent(agentIndex, buffer);
+        }
+    }
+}
+
+bool BTBatchTicker::TryPop(WorkRange& range, uint32_t& agentIndex) {
+    // 終端を越えたら以後は取り出さないので、事前の読み取りで無駄な加算を避ける
+    if (range.next.load(std::memory_order_relaxed) >= range.end) {
+        return false;
+    }
+    uint32_t index = range.next.fetch_add(1, std::memory_order_relaxed);
+    if (index >= range.end) {
+        return false;
+    }
+    agentIndex = index;
+    return true;
+}
+
+void BTBatchTicker::TickAgent(uint32_t agentIndex, BTCommandBuffer* buffer) {
+    const BTBatchAgent& agent = agents_[agentIndex];
+    if (!agent.tree || !agent.blackboard || !agent.tree->IsCompiled()) {
+        results_[agentIndex] = BTNodeStatus::Failure;
+        return;
+    }
+
+    BTCommandBuffer::Scope scope(buffer, agentIndex);
+    results_[agentIndex] = agent.tree->Tick(agent.blackboard);
+}
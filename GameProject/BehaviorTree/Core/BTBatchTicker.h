@@ -0,0 +1,126 @@
+#pragma once
+#include "BTNode.h"
+#include "BTCommandBuffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+class BTBlackboard;
+class BTCompiledTree;
+
+/// <summary>
+/// 一括評価するエージェント（共有ツリーとエージェント固有のブラックボードの組）
+/// </summary>
+struct BTBatchAgent {
+    const BTCompiledTree* tree = nullptr;   // 評価するツリー（複数エージェントで共有可）
+    BTBlackboard* blackboard = nullptr;     // エージェントのブラックボード（状態ブロック設定済み）
+};
+
+/// <summary>
+/// 複数エージェントのビヘイビアツリーをワーカープールで並列評価するクラス
+/// エージェントをワーカーごとの範囲に分けて配り、自分の範囲を終えたワーカーは他の範囲から盗む（ワークスティーリング）
+/// 評価中の共有システムへの副作用は BTCommandBuffer に記録し、全員の評価後にエージェント順で実行する
+/// </summary>
+class BTBatchTicker {
+public:
+    /// <summary>
+    /// これ未満のエージェント数ならワーカーを起こさず呼び出しスレッドで評価する
+    /// </summary>
+    static constexpr size_t kMinParallelAgents = 4;
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="workerCount">ワーカー数（呼び出しスレッドを含む。0 ならハードウェアスレッド数）</param>
+    explicit BTBatchTicker(uint32_t workerCount = 0);
+
+    /// <summary>
+    /// デストラクタ（ワーカースレッドを終了）
+    /// </summary>
+    ~BTBatchTicker();
+
+    BTBatchTicker(const BTBatchTicker&) = delete;
+    BTBatchTicker& operator=(const BTBatchTicker&) = delete;
+
+    /// <summary>
+    /// 全エージェントを1回ずつ評価し、遅延コマンドを実行
+    /// </summary>
+    /// <param name="agents">評価するエージェント</param>
+    /// <param name="results">各エージェントのルートの実行結果の出力先（agents と同じ要素数）</param>
+    void Tick(std::span<const BTBatchAgent> agents, std::span<BTNodeStatus> results);
+
+    /// <summary>
+    /// ワーカー数の取得
+    /// </summary>
+    /// <returns>呼び出しスレッドを含むワーカー数</returns>
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(ranges_.size()); }
+
+    /// <summary>
+    /// 直近の Tick で実行した遅延コマンド数
+    /// </summary>
+    /// <returns>コマンド数</returns>
+    size_t GetLastCommandCount() const { return lastCommandCount_; }
+
+private:
+    /// <summary>
+    /// ワーカーに割り当てたエージェントの範囲（偽共有を避けるためキャッシュラインに揃える）
+    /// </summary>
+    struct alignas(64) WorkRange {
+        std::atomic<uint32_t> next{ 0 };   // 次に取り出すエージェント
+        uint32_t end = 0;                  // 範囲の終端
+    };
+
+    /// <summary>
+    /// ワーカースレッドのメインループ
+    /// </summary>
+    /// <param name="workerIndex">ワーカー番号（1 以上）</param>
+    void WorkerLoop(uint32_t workerIndex);
+
+    /// <summary>
+    /// 自分の範囲を評価し、終わったら他のワーカーの範囲から盗んで評価
+    /// </summary>
+    /// <param name="workerIndex">ワーカー番号</param>
+    void RunWorker(uint32_t workerIndex);
+
+    /// <summary>
+    /// 範囲から1体取り出す
+    /// </summary>
+    /// <param name="range">対象の範囲</param>
+    /// <param name="agentIndex">取り出したエージェント番号の出力先</param>
+    /// <returns>取り出せたら true</returns>
+    static bool TryPop(WorkRange& range, uint32_t& agentIndex);
+
+    /// <summary>
+    /// 1体のエージェントを評価
+    /// </summary>
+    /// <param name="agentIndex">エージェント番号</param>
+    /// <param name="buffer">記録先のコマンドバッファ</param>
+    void TickAgent(uint32_t agentIndex, BTCommandBuffer* buffer);
+
+    // ワーカーごとの範囲とコマンドバッファ（0 番は呼び出しスレッド）
+    std::unique_ptr<WorkRange[]> rangeStorage_;
+    std::span<WorkRange> ranges_;
+    std::vector<BTCommandBuffer> buffers_;
+
+    // ワーカースレッド（1 番以降）
+    std::vector<std::thread> threads_;
+
+    // 評価中のバッチ
+    std::span<const BTBatchAgent> agents_;
+    std::span<BTNodeStatus> results_;
+
+    // 同期
+    std::mutex mutex_;
+    std::condition_variable startCondition_;
+    std::condition_variable doneCondition_;
+    uint64_t generation_ = 0;
+    uint32_t pendingWorkers_ = 0;
+    bool stopping_ = false;
+
+    size_t lastCommandCount_ = 0;
+};
@@ -0,0 +1,279 @@
+#include "BTBinaryTree.h"
+#include "BTComposite.h"
+#include "BTTreeDefinition.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// ファイルレイアウト（リトルエンディアン、各セクションは 4 バイト境界）
+//   Header
+//   NodeRecord[nodeCount]
+//   BTParameters::Record[parameterCount]   ノードごとのパラメータ（8 バイト境界）
+//   uint32_t children[childCount]
+//   char strings[stringBytes]              表示名・パラメータのキーと文字列値
+
+struct BTBinaryTree::Header {
+    char magic[4];              // "BTBN"
+    uint32_t version;           // kFormatVersion
+    uint32_t typeTableHash;     // 書き出し時のタイプ ID 表のハッシュ
+    uint32_t nodeCount;         // ノード数
+    uint64_t sourceSize;        // 変換元ファイルのサイズ
+    int64_t sourceWriteTime;    // 変換元ファイルの更新時刻
+    uint32_t childCount;        // 隣接リストの要素数
+    uint32_t rootIndex;         // ルートノードのインデックス
+    uint32_t stringBytes;       // 文字列領域のバイト数
+    uint32_t parameterCount;    // パラメータレコード数
+};
+
+struct BTBinaryTree::NodeRecord {
+    uint16_t typeId;            // ノードタイプ ID
+    uint16_t flags;             // kHasDisplayName 等
+    int32_t id;                 // JSON 上のノード ID
+    uint32_t childBegin;        // 隣接リスト内の開始位置
+    uint32_t childCount;        // 子ノード数
+    uint32_t nameOffset;        // 表示名の位置（文字列領域内）
+    uint32_t nameLength;        // 表示名の長さ
+    uint32_t parameterBegin;    // パラメータレコードの開始位置
+    uint32_t parameterCount;    // パラメータレコード数（入れ子を含む。0 なら未指定）
+};
+
+namespace {
+
+constexpr char kMagic[4] = { 'B', 'T', 'B', 'N' };
+constexpr uint16_t kHasDisplayName = 1 << 0;
+
+} // namespace
+
+bool BTBinaryTree::Write(const std::string& filepath, const BTTreeDefinition& definition,
+                         const TypeIdResolver& resolver, uint32_t typeTableHash,
+                         const SourceStamp& source) {
+    const auto& defs = definition.GetNodes();
+    if (defs.empty() || definition.GetRootIndex() == BTTreeDefinition::kInvalidIndex || !resolver) {
+        return false;
+    }
+
+    try {
+        std::vector<NodeRecord> records;
+        std::vector<uint32_t> children;
+        std::string strings;
+        std::vector<BTParameters::Record> parameters;
+        records.reserve(defs.size());
+        children.reserve(definition.GetLinkCount());
+
+        for (uint32_t i = 0; i < defs.size(); ++i) {
+            const BTTreeDefinition::NodeDef& def = defs[i];
+
+            NodeRecord record{};
+            record.typeId = resolver(def.type);
+            if (record.typeId == kInvalidTypeId) {
+                return false;
+            }
+            record.id = def.id;
+
+            record.childBegin = static_cast<uint32_t>(children.size());
+            record.childCount = def.childCount;
+            for (uint32_t child : definition.GetChildren(i)) {
+                children.push_back(child);
+            }
+
+            if (def.hasDisplayName) {
+                record.flags |= kHasDisplayName;
+                record.nameOffset = static_cast<uint32_t>(strings.size());
+                record.nameLength = static_cast<uint32_t>(def.displayName.size());
+                strings += def.displayName;
+            }
+
+            // パラメータは固定レイアウトのレコードに平坦化し、読み込み時にそのままノードへ適用する
+            if (!def.parameters.is_null()) {
+                record.parameterBegin = static_cast<uint32_t>(parameters.size());
+                if (!BTParameters::Flatten(def.parameters, parameters, strings)) {
+                    return false;
+                }
+                record.parameterCount = static_cast<uint32_t>(parameters.size()) - record.parameterBegin;
+            }
+
+            records.push_back(record);
+        }
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFormatVersion;
+        header.typeTableHash = typeTableHash;
+        header.nodeCount = static_cast<uint32_t>(records.size());
+        header.sourceSize = source.size;
+        header.sourceWriteTime = source.writeTime;
+        header.childCount = static_cast<uint32_t>(children.size());
+        header.rootIndex = definition.GetRootIndex();
+        header.stringBytes = static_cast<uint32_t>(strings.size());
+        header.parameterCount = static_cast<uint32_t>(parameters.size());
+
+        // 読み込み中のプロセスが書きかけを見ないよう、一時ファイルに書いてから置き換える
+        std::string tempPath = filepath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(NodeRecord));
+            file.write(reinterpret_cast<const char*>(parameters.data()), parameters.size() * sizeof(BTParameters::Record));
+            file.write(reinterpret_cast<const char*>(children.data()), children.size() * sizeof(uint32_t));
+            file.write(strings.data(), strings.size());
+            if (!file) {
+                return false;
+            }
+        }
+        std::filesystem::rename(tempPath, filepath);
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool BTBinaryTree::GetSourceStamp(const std::string& filepath, SourceStamp& stamp) {
+    std::error_code ec;
+    uint64_t size = std::filesystem::file_size(filepath, ec);
+    if (ec) {
+        return false;
+    }
+    auto writeTime = std::filesystem::last_write_time(filepath, ec);
+    if (ec) {
+        return false;
+    }
+
+    stamp.size = size;
+    stamp.writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+bool BTBinaryTree::Open(const std::string& filepath, uint32_t typeTableHash,
+                        const SourceStamp* expectedSource) {
+    static_assert(sizeof(Header) == 48, "btbin header layout changed");
+    static_assert(sizeof(NodeRecord) == 32, "btbin node layout changed");
+    static_assert(sizeof(BTParameters::Record) == 24, "btbin parameter layout changed");
+
+    Close();
+
+    if (!file_.Open(filepath) || file_.GetSize() < sizeof(Header)) {
+        Close();
+        return false;
+    }
+
+    const uint8_t* data = file_.GetData();
+    const auto* header = reinterpret_cast<const Header*>(data);
+
+    // フォーマット・タイプ表・変換元の鮮度を確認
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+        header->version != kFormatVersion ||
+        header->typeTableHash != typeTableHash ||
+        header->nodeCount == 0 ||
+        header->rootIndex >= header->nodeCount) {
+        Close();
+        return false;
+    }
+    if (expectedSource &&
+        (header->sourceSize != expectedSource->size ||
+         header->sourceWriteTime != expectedSource->writeTime)) {
+        Close();
+        return false;
+    }
+
+    // セクションサイズの整合性
+    uint64_t nodesOffset = sizeof(Header);
+    uint64_t parametersOffset = nodesOffset + uint64_t(header->nodeCount) * sizeof(NodeRecord);
+    uint64_t childrenOffset = parametersOffset + uint64_t(header->parameterCount) * sizeof(BTParameters::Record);
+    uint64_t stringsOffset = childrenOffset + uint64_t(header->childCount) * sizeof(uint32_t);
+    uint64_t totalSize = stringsOffset + header->stringBytes;
+    if (totalSize != file_.GetSize()) {
+        Close();
+        return false;
+    }
+
+    const auto* nodes = reinterpret_cast<const NodeRecord*>(data + nodesOffset);
+    const auto* parameters = reinterpret_cast<const BTParameters::Record*>(data + parametersOffset);
+    const auto* children = reinterpret_cast<const uint32_t*>(data + childrenOffset);
+
+    // 各レコードの参照範囲を確認（以降の生成処理では境界チェックしない）
+    for (uint32_t i = 0; i < header->nodeCount; ++i) {
+        const NodeRecord& node = nodes[i];
+        if (uint64_t(node.childBegin) + node.childCount > header->childCount ||
+            uint64_t(node.nameOffset) + node.nameLength > header->stringBytes ||
+            uint64_t(node.parameterBegin) + node.parameterCount > header->parameterCount ||
+            !BTParameters::Validate(parameters + node.parameterBegin, node.parameterCount, header->stringBytes)) {
+            Close();
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < header->childCount; ++i) {
+        if (children[i] >= header->nodeCount) {
+            Close();
+            return false;
+        }
+    }
+
+    header_ = header;
+    nodes_ = nodes;
+    parameters_ = parameters;
+    children_ = children;
+    strings_ = reinterpret_cast<const char*>(data + stringsOffset);
+    return true;
+}
+
+void BTBinaryTree::Close() {
+    file_.Close();
+    header_ = nullptr;
+    nodes_ = nullptr;
+    parameters_ = nullptr;
+    children_ = nullptr;
+    strings_ = nullptr;
+}
+
+uint32_t BTBinaryTree::GetNodeCount() const {
+    return header_ ? header_->nodeCount : 0;
+}
+
+BTNodePtr BTBinaryTree::Instantiate(const NodeFactoryById& factory) const {
+    if (!header_ || !factory) {
+        return nullptr;
+    }
+
+    std::vector<bool> visited(header_->nodeCount, false);
+    return InstantiateRecursive(header_->rootIndex, factory, visited);
+}
+
+BTNodePtr BTBinaryTree::InstantiateRecursive(uint32_t index, const NodeFactoryById& factory,
+                                             std::vector<bool>& visited) const {
+    // 循環参照・重複参照を防ぐ
+    if (visited[index]) {
+        return nullptr;
+    }
+    visited[index] = true;
+
+    const NodeRecord& record = nodes_[index];
+    BTNodePtr node = factory(record.typeId);
+    if (!node) {
+        return nullptr;
+    }
+
+    // パラメータはマップしたレコードから直接ノードのメンバーへ読み込む（Open で範囲は検証済み）
+    if (record.parameterCount > 0) {
+        node->ApplyParameters(BTParameters(parameters_ + record.parameterBegin, record.parameterCount, strings_));
+    }
+
+    if (record.flags & kHasDisplayName) {
+        node->SetName(std::string(strings_ + record.nameOffset, record.nameLength));
+    }
+
+    if (node->IsComposite() && record.childCount > 0) {
+        auto* composite = static_cast<BTComposite*>(node.get());
+        for (uint32_t i = 0; i < record.childCount; ++i) {
+            BTNodePtr childNode = InstantiateRecursive(children_[record.childBegin + i], factory, visited);
+            if (childNode) {
+                composite->AddChild(std::move(childNode));
+            }
+        }
+    }
+
+    return node;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "BTNode.h"
+#include "../../Common/MappedFile.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class BTTreeDefinition;
+
+/// <summary>
+/// プリコンパイル済みビヘイビアツリー（.btbin）
+/// ノードテーブル・タイプ ID・パラメータ・隣接リストを1つのバイナリにまとめ、
+/// 実行時はメモリマップしたまま JSON を経由せずにノードグラフを生成する
+/// パラメータは固定レイアウトのレコード（BTParameters::Record）で持ち、ノードのメンバーへ直接読み込む
+/// </summary>
+class BTBinaryTree {
+public:
+    /// <summary>
+    /// フォーマットのバージョン（レイアウトを変えたら更新する）
+    /// </summary>
+    static constexpr uint32_t kFormatVersion = 2;
+
+    /// <summary>
+    /// 無効なタイプ ID
+    /// </summary>
+    static constexpr uint16_t kInvalidTypeId = UINT16_MAX;
+
+    /// <summary>
+    /// 変換元ファイルの識別情報（古いバイナリの検出用）
+    /// </summary>
+    struct SourceStamp {
+        uint64_t size = 0;       // ファイルサイズ
+        int64_t writeTime = 0;   // 最終更新時刻
+    };
+
+    /// <summary>
+    /// ノードタイプ名 → タイプ ID の変換関数
+    /// </summary>
+    using TypeIdResolver = std::function<uint16_t(const std::string&)>;
+
+    /// <summary>
+    /// タイプ ID からノードを生成する関数
+    /// </summary>
+    using NodeFactoryById = std::function<BTNodePtr(uint16_t)>;
+
+    /// <summary>
+    /// ツリー定義をバイナリに書き出す
+    /// </summary>
+    /// <param name="filepath">出力先パス</param>
+    /// <param name="definition">ツリー定義</param>
+    /// <param name="resolver">タイプ ID の変換関数</param>
+    /// <param name="typeTableHash">タイプ ID 表のハッシュ（表が変わったら再生成させる）</param>
+    /// <param name="source">変換元ファイルの識別情報</param>
+    /// <returns>成功したら true（未知のノードタイプや、レコードで表せないパラメータがあれば失敗）</returns>
+    static bool Write(const std::string& filepath, const BTTreeDefinition& definition,
+                      const TypeIdResolver& resolver, uint32_t typeTableHash,
+                      const SourceStamp& source);
+
+    /// <summary>
+    /// 変換元ファイルの識別情報を取得
+    /// </summary>
+    /// <param name="filepath">ファイルパス</param>
+    /// <param name="stamp">識別情報の出力先</param>
+    /// <returns>ファイルが存在すれば true</returns>
+    static bool GetSourceStamp(const std::string& filepath, SourceStamp& stamp);
+
+    /// <summary>
+    /// バイナリをメモリマップして検証
+    /// </summary>
+    /// <param name="filepath">バイナリのパス</param>
+    /// <param name="typeTableHash">現在のタイプ ID 表のハッシュ</param>
+    /// <param name="expectedSource">変換元の識別情報（nullptr なら鮮度を確認しない）</param>
+    /// <returns>有効かつ最新なら true</returns>
+    bool Open(const std::string& filepath, uint32_t typeTableHash,
+              const SourceStamp* expectedSource);
+
+    /// <summary>
+    /// マップを解除
+    /// </summary>
+    void Close();
+
+    /// <summary>
+    /// ランタイムのノードグラフを生成
+    /// </summary>
+    /// <param name="factory">タイプ ID からのノード生成関数</param>
+    /// <returns>ルートノード（失敗時は nullptr）</returns>
+    BTNodePtr Instantiate(const NodeFactoryById& factory) const;
+
+    /// <summary>
+    /// 開いているかどうか
+    /// </summary>
+    /// <returns>検証済みのバイナリをマップしていれば true</returns>
+    bool IsOpen() const { return header_ != nullptr; }
+
+    /// <summary>
+    /// ノード数の取得
+    /// </summary>
+    /// <returns>ノード数</returns>
+    uint32_t GetNodeCount() const;
+
+private:
+    struct Header;
+    struct NodeRecord;
+
+    /// <summary>
+    /// ノードを再帰的に生成
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <param name="factory">ノード生成関数</param>
+    /// <param name="visited">訪問済みフラグ（循環・重複参照の防止）</param>
+    /// <returns>生成したノード</returns>
+    BTNodePtr InstantiateRecursive(uint32_t index, const NodeFactoryById& factory,
+                                   std::vector<bool>& visited) const;
+
+    // マップしたファイル
+    MappedFile file_;
+
+    // マップ内の各セクション（Open で検証済み）
+    const Header* header_ = nullptr;
+    const NodeRecord* nodes_ = nullptr;
+    const BTParameters::Record* parameters_ = nullptr;
+    const uint32_t* children_ = nullptr;
+    const char* strings_ = nullptr;
+};
@@ -3,14 +3,26 @@
 #include <any>
 #include <string>
 #include <optional>
+#include <vector>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include "Vector3.h"
+#include "BTBlackboardKey.h"
+#include "BTRandom.h"
 
 class Boss;
 class Player;
+class BTNode;
+class BTCompiledTree;
 
 /// <summary>
 /// ビヘイビアツリーのブラックボード
 /// ノード間でデータを共有するための仕組み
+/// int/float/Vector3 はシンボル ID で引く型別スロット配列に格納し、
+/// それ以外の型は any テーブルに格納する
 /// </summary>
 class BTBlackboard {
 public:
@@ -60,6 +72,90 @@ public:
     /// <returns>経過時間</returns>
     float GetDeltaTime() const { return deltaTime_; }
 
+    /// <summary>
+    /// 1フレーム分時間を進める（経過時間の設定と、エージェントの時計・フレーム数の更新）
+    /// </summary>
+    /// <param name="deltaTime">経過時間</param>
+    void AdvanceTime(float deltaTime) {
+        deltaTime_ = deltaTime;
+        time_ += deltaTime;
+        ++frame_;
+    }
+
+    /// <summary>
+    /// エージェントの経過時間（AdvanceTime の累計）
+    /// </summary>
+    /// <returns>秒</returns>
+    float GetTime() const { return time_; }
+
+    /// <summary>
+    /// エージェントのフレーム数（AdvanceTime の呼び出し回数）
+    /// </summary>
+    /// <returns>フレーム数</returns>
+    uint64_t GetFrame() const { return frame_; }
+
+    /// <summary>
+    /// エージェントの状態ブロックを設定
+    /// </summary>
+    /// <param name="block">状態ブロックの先頭（BTAgentStateBuffer が所有）</param>
+    void SetNodeStateBlock(std::byte* block) { nodeStateBlock_ = block; }
+
+    /// <summary>
+    /// エージェントの状態ブロックを取得
+    /// </summary>
+    /// <returns>状態ブロックの先頭（未設定なら nullptr）</returns>
+    std::byte* GetNodeStateBlock() const { return nodeStateBlock_; }
+
+    /// <summary>
+    /// ノードのランタイム状態を取得
+    /// </summary>
+    /// <template name="T">状態の型</template>
+    /// <param name="offset">状態ブロック内のオフセット</param>
+    /// <returns>状態（状態ブロック未設定なら nullptr）</returns>
+    template<typename T>
+    T* GetNodeState(uint32_t offset) const {
+        if (!nodeStateBlock_) return nullptr;
+        return std::launder(reinterpret_cast<T*>(nodeStateBlock_ + offset));
+    }
+
+    /// <summary>
+    /// 評価中のツリーとノードを設定（BTCompiledTree がノードを呼ぶ直前、ノードグラフの直接評価ではルートを呼ぶ前にツリーだけを設定する）
+    /// ノードの状態オフセットはツリーごとに異なるため、ノード本体ではなくここで受け渡す
+    /// </summary>
+    /// <param name="tree">評価中のツリー（評価外なら nullptr）</param>
+    /// <param name="node">評価中のノード</param>
+    /// <param name="stateOffset">そのノードのこのツリーでの状態オフセット</param>
+    void SetActiveNode(const BTCompiledTree* tree, const BTNode* node, uint32_t stateOffset) {
+        activeTree_ = tree;
+        activeNode_ = node;
+        activeStateOffset_ = stateOffset;
+    }
+
+    /// <summary>
+    /// 評価中のツリーを取得
+    /// </summary>
+    /// <returns>評価中のツリー（評価外なら nullptr）</returns>
+    const BTCompiledTree* GetActiveTree() const { return activeTree_; }
+
+    /// <summary>
+    /// 評価中のノードを取得
+    /// </summary>
+    /// <returns>評価中のノード</returns>
+    const BTNode* GetActiveNode() const { return activeNode_; }
+
+    /// <summary>
+    /// 評価中のノードの状態オフセットを取得
+    /// </summary>
+    /// <returns>オフセット</returns>
+    uint32_t GetActiveStateOffset() const { return activeStateOffset_; }
+
+    /// <summary>
+    /// エージェントの乱数生成器を取得
+    /// 並列評価中も安全に使えるよう、ノードは RandomEngine ではなくこちらを使う
+    /// </summary>
+    /// <returns>乱数生成器</returns>
+    BTRandom& GetRandom() { return random_; }
+
     /// <summary>
     /// 汎用データの設定
     /// </summary>
@@ -67,8 +163,32 @@ public:
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
     template<typename T>
+    void SetValue(BTBlackboardKey key, const T& value) {
+        if constexpr (std::is_same_v<T, int>) {
+            SetInt(key, value);
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            SetFloat(key, value);
+        }
+        else if constexpr (std::is_same_v<T, Tako::Vector3>) {
+            SetVector3(key, value);
+        }
+        else {
+            if (!EnsureSlot(key)) return;
+            slotTypes_[key.GetId()] = SlotType::Any;
+            anyValues_[key.GetId()] = value;
+        }
+    }
+
+    /// <summary>
+    /// 汎用データの設定（文字列キー版）
+    /// </summary>
+    /// <template name="T">データ型</template>
+    /// <param name="key">キー</param>
+    /// <param name="value">値</param>
+    template<typename T>
     void SetValue(const std::string& key, const T& value) {
-        data_[key] = value;
+        SetValue<T>(BTBlackboardKey(key), value);
     }
 
     /// <summary>
@@ -76,28 +196,62 @@ public:
     /// </summary>
     /// <template name="T">データ型</template>
     /// <param name="key">キー</param>
-    /// <returns>値（存在しない場合は nullopt）</returns>
+    /// <returns>値（存在しない・型が異なる場合は nullopt）</returns>
     template<typename T>
-    std::optional<T> GetValue(const std::string& key) const {
-        auto it = data_.find(key);
-        if (it != data_.end()) {
-            try {
-                return std::any_cast<T>(it->second);
-            }
-            catch (const std::bad_any_cast&) {
-                return std::nullopt;
+    std::optional<T> GetValue(BTBlackboardKey key) const {
+        SlotType type = GetSlotType(key);
+        if constexpr (std::is_same_v<T, int>) {
+            if (type == SlotType::Int) return ints_[key.GetId()];
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            if (type == SlotType::Float) return floats_[key.GetId()];
+        }
+        else if constexpr (std::is_same_v<T, Tako::Vector3>) {
+            if (type == SlotType::Vector3) return vectors_[key.GetId()];
+        }
+        else {
+            if (type == SlotType::Any) {
+                auto it = anyValues_.find(key.GetId());
+                if (it != anyValues_.end()) {
+                    // ポインタ版 any_cast は型不一致でも例外を投げない
+                    if (const T* value = std::any_cast<T>(&it->second)) {
+                        return *value;
+                    }
+                }
             }
         }
         return std::nullopt;
     }
 
+    /// <summary>
+    /// 汎用データの取得（文字列キー版）
+    /// </summary>
+    /// <template name="T">データ型</template>
+    /// <param name="key">キー</param>
+    /// <returns>値（存在しない・型が異なる場合は nullopt）</returns>
+    template<typename T>
+    std::optional<T> GetValue(const std::string& key) const {
+        return GetValue<T>(BTBlackboardKey(key));
+    }
+
     /// <summary>
     /// 整数値の設定
     /// </summary>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
+    void SetInt(BTBlackboardKey key, int value) {
+        if (!EnsureSlot(key)) return;
+        SetSlotType(key.GetId(), SlotType::Int);
+        ints_[key.GetId()] = value;
+    }
+
+    /// <summary>
+    /// 整数値の設定（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <param name="value">値</param>
     void SetInt(const std::string& key, int value) {
-        data_[key] = value;
+        SetInt(BTBlackboardKey(key), value);
     }
 
     /// <summary>
@@ -106,9 +260,18 @@ public:
     /// <param name="key">キー</param>
     /// <param name="defaultValue">デフォルト値</param>
     /// <returns>値</returns>
+    int GetInt(BTBlackboardKey key, int defaultValue = 0) const {
+        return GetSlotType(key) == SlotType::Int ? ints_[key.GetId()] : defaultValue;
+    }
+
+    /// <summary>
+    /// 整数値の取得（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
     int GetInt(const std::string& key, int defaultValue = 0) const {
-        auto value = GetValue<int>(key);
-        return value.value_or(defaultValue);
+        return GetInt(BTBlackboardKey(key), defaultValue);
     }
 
     /// <summary>
@@ -116,8 +279,19 @@ public:
     /// </summary>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
+    void SetFloat(BTBlackboardKey key, float value) {
+        if (!EnsureSlot(key)) return;
+        SetSlotType(key.GetId(), SlotType::Float);
+        floats_[key.GetId()] = value;
+    }
+
+    /// <summary>
+    /// 浮動小数点値の設定（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <param name="value">値</param>
     void SetFloat(const std::string& key, float value) {
-        data_[key] = value;
+        SetFloat(BTBlackboardKey(key), value);
     }
 
     /// <summary>
@@ -126,9 +300,18 @@ public:
     /// <param name="key">キー</param>
     /// <param name="defaultValue">デフォルト値</param>
     /// <returns>値</returns>
+    float GetFloat(BTBlackboardKey key, float defaultValue = 0.0f) const {
+        return GetSlotType(key) == SlotType::Float ? floats_[key.GetId()] : defaultValue;
+    }
+
+    /// <summary>
+    /// 浮動小数点値の取得（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
     float GetFloat(const std::string& key, float defaultValue = 0.0f) const {
-        auto value = GetValue<float>(key);
-        return value.value_or(defaultValue);
+        return GetFloat(BTBlackboardKey(key), defaultValue);
     }
 
     /// <summary>
@@ -136,8 +319,19 @@ public:
     /// </summary>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
+    void SetVector3(BTBlackboardKey key, const Tako::Vector3& value) {
+        if (!EnsureSlot(key)) return;
+        SetSlotType(key.GetId(), SlotType::Vector3);
+        vectors_[key.GetId()] = value;
+    }
+
+    /// <summary>
+    /// ベクトル値の設定（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <param name="value">値</param>
     void SetVector3(const std::string& key, const Tako::Vector3& value) {
-        data_[key] = value;
+        SetVector3(BTBlackboardKey(key), value);
     }
 
     /// <summary>
@@ -146,9 +340,18 @@ public:
     /// <param name="key">キー</param>
     /// <param name="defaultValue">デフォルト値</param>
     /// <returns>値</returns>
+    Tako::Vector3 GetVector3(BTBlackboardKey key, const Tako::Vector3& defaultValue = Tako::Vector3()) const {
+        return GetSlotType(key) == SlotType::Vector3 ? vectors_[key.GetId()] : defaultValue;
+    }
+
+    /// <summary>
+    /// ベクトル値の取得（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
     Tako::Vector3 GetVector3(const std::string& key, const Tako::Vector3& defaultValue = Tako::Vector3()) const {
-        auto value = GetValue<Tako::Vector3>(key);
-        return value.value_or(defaultValue);
+        return GetVector3(BTBlackboardKey(key), defaultValue);
     }
 
     /// <summary>
@@ -156,23 +359,93 @@ public:
     /// </summary>
     /// <param name="key">キー</param>
     /// <returns>存在する場合 true</returns>
+    bool HasKey(BTBlackboardKey key) const {
+        return GetSlotType(key) != SlotType::None;
+    }
+
+    /// <summary>
+    /// キーが存在するかチェック（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <returns>存在する場合 true</returns>
     bool HasKey(const std::string& key) const {
-        return data_.find(key) != data_.end();
+        return HasKey(BTBlackboardKey(key));
     }
 
     /// <summary>
     /// キーの削除
     /// </summary>
     /// <param name="key">キー</param>
+    void RemoveKey(BTBlackboardKey key) {
+        if (GetSlotType(key) == SlotType::None) return;
+        SetSlotType(key.GetId(), SlotType::None);
+    }
+
+    /// <summary>
+    /// キーの削除（文字列キー版）
+    /// </summary>
+    /// <param name="key">キー</param>
     void RemoveKey(const std::string& key) {
-        data_.erase(key);
+        RemoveKey(BTBlackboardKey(key));
     }
 
     /// <summary>
     /// 全データのクリア
     /// </summary>
     void Clear() {
-        data_.clear();
+        slotTypes_.assign(slotTypes_.size(), SlotType::None);
+        anyValues_.clear();
+    }
+
+private:
+    /// <summary>
+    /// スロットに格納されている値の型
+    /// </summary>
+    enum class SlotType : uint8_t {
+        None,
+        Int,
+        Float,
+        Vector3,
+        Any
+    };
+
+    /// <summary>
+    /// スロットの型を取得（範囲外・無効キーは None）
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <returns>スロットの型</returns>
+    SlotType GetSlotType(BTBlackboardKey key) const {
+        return key.GetId() < slotTypes_.size() ? slotTypes_[key.GetId()] : SlotType::None;
+    }
+
+    /// <summary>
+    /// スロットの型を変更（any からの変更時は any テーブルからも削除）
+    /// </summary>
+    /// <param name="id">シンボル ID</param>
+    /// <param name="type">新しい型</param>
+    void SetSlotType(uint32_t id, SlotType type) {
+        if (slotTypes_[id] == SlotType::Any) {
+            anyValues_.erase(id);
+        }
+        slotTypes_[id] = type;
+    }
+
+    /// <summary>
+    /// キーに対応するスロットを確保
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <returns>有効なキーなら true</returns>
+    bool EnsureSlot(BTBlackboardKey key) {
+        if (!key.IsValid()) return false;
+        if (key.GetId() >= slotTypes_.size()) {
+            // 登録済みシンボル数まで一度に拡張し、再確保の回数を抑える
+            size_t size = std::max<size_t>(key.GetId() + 1, BTBlackboardKey::GetRegisteredCount());
+            slotTypes_.resize(size, SlotType::None);
+            ints_.resize(size, 0);
+            floats_.resize(size, 0.0f);
+            vectors_.resize(size);
+        }
+        return true;
     }
 
 private:
@@ -185,6 +458,29 @@ private:
     // フレームの経過時間
     float deltaTime_ = 0.0f;
 
-    // 汎用データストレージ
-    std::unordered_map<std::string, std::any> data_;
+    // エージェントの経過時間・フレーム数（条件のキャッシュや間引き評価の基準）
+    float time_ = 0.0f;
+    uint64_t frame_ = 0;
+
+    // エージェントの状態ブロック（非所有）
+    std::byte* nodeStateBlock_ = nullptr;
+
+    // 評価中のツリー・ノードと、そのノードの状態オフセット（非所有）
+    const BTCompiledTree* activeTree_ = nullptr;
+    const BTNode* activeNode_ = nullptr;
+    uint32_t activeStateOffset_ = UINT32_MAX;
+
+    // エージェントの乱数生成器
+    BTRandom random_;
+
+    // スロットの型（シンボル ID でインデックス）
+    std::vector<SlotType> slotTypes_;
+
+    // 型別スロット（シンボル ID でインデックス）
+    std::vector<int> ints_;
+    std::vector<float> floats_;
+    std::vector<Tako::Vector3> vectors_;
+
+    // int/float/Vector3 以外の値（シンボル ID → 値）
+    std::unordered_map<uint32_t, std::any> anyValues_;
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "BTBlackboardKey.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+/// <summary>
+/// シンボルテーブル（プロセス全体で共有）
+/// </summary>
+struct SymbolTable {
+    std::mutex mutex;
+    std::unordered_map<std::string, uint32_t> ids;
+    std::deque<std::string> names;  // ID → 名前（参照が無効化されないよう deque）
+};
+
+SymbolTable& GetSymbolTable() {
+    static SymbolTable table;
+    return table;
+}
+
+} // namespace
+
+const std::string& BTBlackboardKey::GetName() const {
+    static const std::string kEmpty;
+    if (id_ == kInvalidId) {
+        return kEmpty;
+    }
+
+    SymbolTable& table = GetSymbolTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return id_ < table.names.size() ? table.names[id_] : kEmpty;
+}
+
+uint32_t BTBlackboardKey::Intern(std::string_view name) {
+    SymbolTable& table = GetSymbolTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    std::string key(name);
+    auto it = table.ids.find(key);
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(table.names.size());
+    table.names.push_back(key);
+    table.ids.emplace(std::move(key), id);
+    return id;
+}
+
+size_t BTBlackboardKey::GetRegisteredCount() {
+    SymbolTable& table = GetSymbolTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.names.size();
+}
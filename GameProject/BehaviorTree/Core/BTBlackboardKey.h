@@ -0,0 +1,65 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/// <summary>
+/// ブラックボードのキー（文字列をインターンした整数シンボル）
+/// 登録は文字列で1度だけ行い、以降の比較・参照は整数 ID で行う
+/// </summary>
+class BTBlackboardKey {
+public:
+    /// <summary>
+    /// 無効なシンボル ID
+    /// </summary>
+    static constexpr uint32_t kInvalidId = UINT32_MAX;
+
+    /// <summary>
+    /// コンストラクタ（無効なキー）
+    /// </summary>
+    BTBlackboardKey() = default;
+
+    /// <summary>
+    /// コンストラクタ（名前をインターンしてキーを生成）
+    /// </summary>
+    /// <param name="name">キー名</param>
+    explicit BTBlackboardKey(std::string_view name) : id_(Intern(name)) {}
+
+    /// <summary>
+    /// シンボル ID の取得
+    /// </summary>
+    /// <returns>シンボル ID</returns>
+    uint32_t GetId() const { return id_; }
+
+    /// <summary>
+    /// 有効なキーかどうか
+    /// </summary>
+    /// <returns>登録済みのキーなら true</returns>
+    bool IsValid() const { return id_ != kInvalidId; }
+
+    /// <summary>
+    /// キー名の取得（デバッグ表示用）
+    /// </summary>
+    /// <returns>キー名（無効なキーは空文字列）</returns>
+    const std::string& GetName() const;
+
+    bool operator==(const BTBlackboardKey& other) const { return id_ == other.id_; }
+    bool operator!=(const BTBlackboardKey& other) const { return id_ != other.id_; }
+
+    /// <summary>
+    /// 名前をインターンしてシンボル ID を取得（未登録なら登録する）
+    /// </summary>
+    /// <param name="name">キー名</param>
+    /// <returns>シンボル ID</returns>
+    static uint32_t Intern(std::string_view name);
+
+    /// <summary>
+    /// 登録済みシンボル数の取得
+    /// </summary>
+    /// <returns>登録済みシンボル数</returns>
+    static size_t GetRegisteredCount();
+
+private:
+    // シンボル ID
+    uint32_t id_ = kInvalidId;
+};
@@ -0,0 +1,77 @@
+#include "BTCachedCondition.h"
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+BTNodeStatus BTCachedCondition::Execute(BTBlackboard* blackboard) {
+    BTConditionInputs inputs;
+    GatherInputs(blackboard, inputs);
+    if (!inputs.valid) {
+        return BTNodeStatus::Failure;
+    }
+
+    // 状態ブロックが無い（コンパイル前など）場合は毎回評価する
+    BTCachedConditionState* state = GetState(blackboard);
+    if (!state) {
+        return Evaluate(inputs) ? BTNodeStatus::Success : BTNodeStatus::Failure;
+    }
+
+    float now = blackboard->GetTime();
+    if (state->valid && state->version == version_ && state->inputs.Matches(inputs, inputTolerance_) &&
+        (cacheInterval_ <= 0.0f || now - state->evaluatedTime < cacheInterval_)) {
+        return state->status;
+    }
+
+    // 入力は評価したときの値を記録する（許容誤差内の変化が積み重なっても再評価されるように）
+    state->inputs = inputs;
+    state->evaluatedTime = now;
+    state->version = version_;
+    state->status = Evaluate(inputs) ? BTNodeStatus::Success : BTNodeStatus::Failure;
+    state->valid = true;
+    return state->status;
+}
+
+void BTCachedCondition::ApplyParameters(const BTParameters& params) {
+    if (params.contains("cacheInterval")) {
+        cacheInterval_ = params["cacheInterval"].get<float>();
+    }
+    if (params.contains("inputTolerance")) {
+        inputTolerance_ = params["inputTolerance"].get<float>();
+    }
+    ApplyConditionParameters(params);
+    InvalidateCache();
+}
+
+nlohmann::json BTCachedCondition::ExtractParameters() const {
+    nlohmann::json params = ExtractConditionParameters();
+    params["cacheInterval"] = cacheInterval_;
+    params["inputTolerance"] = inputTolerance_;
+    return params;
+}
+
+#ifdef _DEBUG
+bool BTCachedCondition::DrawImGui() {
+    bool changed = DrawConditionImGui();
+
+    // キャッシュ設定の編集
+    ImGui::Separator();
+    if (ImGui::DragFloat("Cache Interval##cache", &cacheInterval_, 0.05f, 0.0f, 10.0f, "%.2f s")) {
+        changed = true;
+    }
+    if (ImGui::DragFloat("Input Tolerance##cache", &inputTolerance_, 0.01f, 0.0f, 10.0f, "%.2f")) {
+        changed = true;
+    }
+    if (cacheInterval_ > 0.0f) {
+        ImGui::TextDisabled("Re-evaluate on input change or every %.2f s", cacheInterval_);
+    }
+    else {
+        ImGui::TextDisabled("Re-evaluate on input change");
+    }
+
+    if (changed) {
+        InvalidateCache();
+    }
+    return changed;
+}
+#endif
@@ -0,0 +1,170 @@
+#pragma once
+#include "BTStatefulNode.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/// <summary>
+/// 条件ノードが依存する入力値の集合
+/// 入力が前回の評価時と同じなら、結果も同じとみなして再評価を省略する
+/// </summary>
+struct BTConditionInputs {
+    /// <summary>
+    /// 保持できる入力の最大数
+    /// </summary>
+    static constexpr uint32_t kMaxInputs = 8;
+
+    std::array<float, kMaxInputs> values{};
+    uint32_t count = 0;
+    bool valid = true;
+
+    /// <summary>
+    /// 入力値を追加
+    /// </summary>
+    /// <param name="value">入力値</param>
+    void Add(float value) {
+        if (count < kMaxInputs) {
+            values[count++] = value;
+        }
+        else {
+            // 収まらない入力は比較できないため、キャッシュを使わせない
+            valid = false;
+        }
+    }
+
+    /// <summary>
+    /// 入力が取得できなかったことを記録（この場合は常に失敗扱い）
+    /// </summary>
+    void Invalidate() { valid = false; }
+
+    /// <summary>
+    /// 別の入力と一致するか
+    /// </summary>
+    /// <param name="other">比較する入力</param>
+    /// <param name="tolerance">各値の許容誤差（0 なら完全一致）</param>
+    /// <returns>一致すれば true</returns>
+    bool Matches(const BTConditionInputs& other, float tolerance) const {
+        if (!valid || !other.valid || count != other.count) {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            if (std::fabs(values[i] - other.values[i]) > tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/// <summary>
+/// キャッシュ付き条件ノードのエージェントごとの状態
+/// ツリーの完了をまたいで保持する
+/// </summary>
+struct BTCachedConditionState {
+    BTConditionInputs inputs;                       // 前回評価したときの入力
+    float evaluatedTime = 0.0f;                     // 前回評価した時刻（BTBlackboard::GetTime）
+    uint32_t version = 0;                           // 前回評価したときのパラメータの版
+    BTNodeStatus status = BTNodeStatus::Failure;    // 前回の結果
+    bool valid = false;                             // 結果を保持しているか
+};
+
+/// <summary>
+/// 評価結果をキャッシュする条件ノードの基底クラス
+/// 派生クラスは依存する入力を GatherInputs で宣言し、判定を Evaluate に実装する
+/// 入力が変わったとき・パラメータが変わったとき・再評価間隔が過ぎたときだけ Evaluate を呼ぶ
+/// </summary>
+class BTCachedCondition : public BTStatefulNode<BTCachedConditionState> {
+public:
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    virtual ~BTCachedCondition() = default;
+
+    /// <summary>
+    /// ノードの実行（キャッシュが有効なら前回の結果を返す）
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus Execute(BTBlackboard* blackboard) final;
+
+    /// <summary>
+    /// 評価キャッシュはツリーの完了後も使えるよう保持する
+    /// </summary>
+    /// <returns>true</returns>
+    bool IsStatePersistent() const final { return true; }
+
+    /// <summary>
+    /// パラメータを適用（キャッシュ設定と派生クラスのパラメータ）
+    /// </summary>
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) final;
+
+    /// <summary>
+    /// パラメータを JSON として抽出
+    /// </summary>
+    nlohmann::json ExtractParameters() const final;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// ImGui でパラメータ編集 UI を描画
+    /// </summary>
+    bool DrawImGui() final;
+#endif
+
+    // Getters/Setters
+    float GetCacheInterval() const { return cacheInterval_; }
+    void SetCacheInterval(float interval) { cacheInterval_ = interval; InvalidateCache(); }
+
+    float GetInputTolerance() const { return inputTolerance_; }
+    void SetInputTolerance(float tolerance) { inputTolerance_ = tolerance; InvalidateCache(); }
+
+protected:
+    /// <summary>
+    /// 判定に使う入力値を集める
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="inputs">入力の格納先（取得できなければ Invalidate する）</param>
+    virtual void GatherInputs(BTBlackboard* blackboard, BTConditionInputs& inputs) const = 0;
+
+    /// <summary>
+    /// 入力値から条件を判定
+    /// </summary>
+    /// <param name="inputs">GatherInputs で集めた入力</param>
+    /// <returns>条件を満たしていれば true</returns>
+    virtual bool Evaluate(const BTConditionInputs& inputs) const = 0;
+
+    /// <summary>
+    /// 派生クラスのパラメータを適用
+    /// </summary>
+    /// <param name="params">パラメータ</param>
+    virtual void ApplyConditionParameters(const BTParameters& params) = 0;
+
+    /// <summary>
+    /// 派生クラスのパラメータを抽出
+    /// </summary>
+    /// <returns>パラメータ JSON</returns>
+    virtual nlohmann::json ExtractConditionParameters() const = 0;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// 派生クラスのパラメータ編集 UI を描画
+    /// </summary>
+    /// <returns>パラメータ変更があれば true</returns>
+    virtual bool DrawConditionImGui() = 0;
+#endif
+
+    /// <summary>
+    /// 全エージェントのキャッシュを無効にする（判定に関わるパラメータを変えたとき）
+    /// </summary>
+    void InvalidateCache() { ++version_; }
+
+    // 再評価間隔（秒、0 以下なら入力が変わるまで再評価しない）
+    float cacheInterval_ = 0.0f;
+
+    // 入力の許容誤差（0 なら完全一致）
+    float inputTolerance_ = 0.0f;
+
+private:
+    // パラメータの版（変わったら全エージェントのキャッシュを無効にする）
+    uint32_t version_ = 0;
+};
@@ -0,0 +1,73 @@
+#include "BTCommandBuffer.h"
+#include <algorithm>
+
+namespace {
+
+// 現在のスレッドの記録先と評価中のエージェント
+thread_local BTCommandBuffer* currentBuffer = nullptr;
+thread_local uint32_t currentAgent = 0;
+
+} // namespace
+
+BTCommandBuffer::Scope::Scope(BTCommandBuffer* buffer, uint32_t agentIndex)
+    : previousBuffer_(currentBuffer), previousAgent_(currentAgent) {
+    currentBuffer = buffer;
+    currentAgent = agentIndex;
+}
+
+BTCommandBuffer::Scope::~Scope() {
+    currentBuffer = previousBuffer_;
+    currentAgent = previousAgent_;
+}
+
+BTCommandBuffer* BTCommandBuffer::GetCurrent() {
+    return currentBuffer;
+}
+
+uint32_t BTCommandBuffer::GetCurrentAgent() {
+    return currentAgent;
+}
+
+void BTCommandBuffer::Clear() {
+    commands_.clear();
+    payload_.clear();
+}
+
+size_t BTCommandBuffer::ExecuteMerged(std::span<BTCommandBuffer> buffers) {
+    struct MergedCommand {
+        const Command* command;
+        const std::byte* payload;
+    };
+
+    size_t total = 0;
+    for (const BTCommandBuffer& buffer : buffers) {
+        total += buffer.commands_.size();
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    std::vector<MergedCommand> merged;
+    merged.reserve(total);
+    for (const BTCommandBuffer& buffer : buffers) {
+        for (const Command& command : buffer.commands_) {
+            merged.push_back({ &command, buffer.payload_.data() });
+        }
+    }
+
+    // 1体のエージェントは1つのスレッドでしか評価されないため、
+    // エージェント番号で安定ソートすれば記録順も含めて一意に決まる
+    std::stable_sort(merged.begin(), merged.end(),
+        [](const MergedCommand& a, const MergedCommand& b) {
+            return a.command->agentIndex < b.command->agentIndex;
+        });
+
+    for (const MergedCommand& entry : merged) {
+        entry.command->invoke(entry.payload + entry.command->payloadOffset);
+    }
+
+    for (BTCommandBuffer& buffer : buffers) {
+        buffer.Clear();
+    }
+    return total;
+}
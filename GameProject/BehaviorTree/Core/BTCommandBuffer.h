@@ -0,0 +1,133 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// 遅延実行コマンドのバッファ
+/// 並列評価中のノードが共有システムへ及ぼす副作用（弾の生成・エミッター操作など）を
+/// ワーカースレッドごとに記録し、評価後にエージェント順で決定的に実行する
+/// </summary>
+class BTCommandBuffer {
+public:
+    /// <summary>
+    /// コマンドの実行関数
+    /// </summary>
+    /// <template name="T">ペイロードの型</template>
+    template<typename T>
+    using ApplyFunc = void(*)(const T&);
+
+    /// <summary>
+    /// 記録先を現在のスレッドに設定するスコープ
+    /// スコープ中に GetCurrent() がこのバッファを返す
+    /// </summary>
+    class Scope {
+    public:
+        /// <summary>
+        /// コンストラクタ
+        /// </summary>
+        /// <param name="buffer">記録先のバッファ</param>
+        /// <param name="agentIndex">評価中のエージェント番号</param>
+        Scope(BTCommandBuffer* buffer, uint32_t agentIndex);
+
+        /// <summary>
+        /// デストラクタ（以前の記録先に戻す）
+        /// </summary>
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        BTCommandBuffer* previousBuffer_;
+        uint32_t previousAgent_;
+    };
+
+    /// <summary>
+    /// 現在のスレッドの記録先を取得
+    /// </summary>
+    /// <returns>記録先（並列評価中でなければ nullptr）</returns>
+    static BTCommandBuffer* GetCurrent();
+
+    /// <summary>
+    /// コマンドを記録（エージェント番号は現在のスコープのものを使う）
+    /// </summary>
+    /// <template name="T">ペイロードの型（トリビアルコピー可能な型）</template>
+    /// <param name="payload">ペイロード</param>
+    /// <param name="apply">実行関数（キャプチャなしラムダ可）</param>
+    template<typename T>
+    void Push(const T& payload, std::type_identity_t<ApplyFunc<T>> apply) {
+        static_assert(std::is_trivially_copyable_v<T>, "コマンドのペイロードはトリビアルコピー可能な型にする");
+
+        Entry<T> entry{ apply, payload };
+        Command command;
+        command.agentIndex = GetCurrentAgent();
+        command.payloadOffset = static_cast<uint32_t>(payload_.size());
+        command.invoke = &Invoke<T>;
+        payload_.resize(payload_.size() + sizeof(Entry<T>));
+        std::memcpy(payload_.data() + command.payloadOffset, &entry, sizeof(Entry<T>));
+        commands_.push_back(command);
+    }
+
+    /// <summary>
+    /// 記録済みコマンドを破棄（確保済みの領域は再利用する）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 記録済みコマンド数の取得
+    /// </summary>
+    /// <returns>コマンド数</returns>
+    size_t GetCommandCount() const { return commands_.size(); }
+
+    /// <summary>
+    /// 複数バッファのコマンドをエージェント番号順に並べて実行し、バッファをクリア
+    /// 同じエージェントのコマンドは記録順を保つため、スレッド数や割り当てによらず結果が同じになる
+    /// </summary>
+    /// <param name="buffers">ワーカーごとのバッファ</param>
+    /// <returns>実行したコマンド数</returns>
+    static size_t ExecuteMerged(std::span<BTCommandBuffer> buffers);
+
+private:
+    /// <summary>
+    /// 実行関数とペイロードの組（payload_ にバイト列として格納）
+    /// </summary>
+    template<typename T>
+    struct Entry {
+        ApplyFunc<T> apply;
+        T payload;
+    };
+
+    /// <summary>
+    /// 記録したコマンド
+    /// </summary>
+    struct Command {
+        uint32_t agentIndex = 0;                          // 記録したエージェント
+        uint32_t payloadOffset = 0;                       // payload_ 内の位置
+        void (*invoke)(const std::byte*) = nullptr;       // 型を復元して実行する関数
+    };
+
+    /// <summary>
+    /// バイト列から Entry を復元して実行
+    /// </summary>
+    template<typename T>
+    static void Invoke(const std::byte* data) {
+        Entry<T> entry;
+        std::memcpy(&entry, data, sizeof(Entry<T>));
+        entry.apply(entry.payload);
+    }
+
+    /// <summary>
+    /// 現在のスレッドで評価中のエージェント番号
+    /// </summary>
+    static uint32_t GetCurrentAgent();
+
+    // 記録順のコマンド
+    std::vector<Command> commands_;
+
+    // ペイロード
+    std::vector<std::byte> payload_;
+};
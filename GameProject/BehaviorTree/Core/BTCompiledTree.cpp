@@ -0,0 +1,418 @@
+#include "BTCompiledTree.h"
+#include "BTBlackboard.h"
+#include "BTComposite.h"
+#include "BTProfiler.h"
+#include "../Composites/BTSelector.h"
+#include "../Composites/BTSequence.h"
+#include "../Composites/BTRandomSelector.h"
+#include "../Decorators/BTTimeSlice.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+using namespace Tako;
+
+bool BTCompiledTree::Compile(const BTNodePtr& root) {
+    Clear();
+    if (!root) {
+        return false;
+    }
+
+    root_ = root;
+    Flatten(root);
+
+    // 状態ブロックのサイズをアライメントの倍数に揃える（エージェントを連続配置するため）
+    stateSize_ = (stateSize_ + stateAlignment_ - 1) / stateAlignment_ * stateAlignment_;
+    return true;
+}
+
+void BTCompiledTree::Clear() {
+    root_.reset();
+    ownedNodes_.clear();
+    nodes_.clear();
+    childIndices_.clear();
+    statefulNodes_.clear();
+    statefulOffsets_.clear();
+    stateSize_ = 0;
+    stateAlignment_ = alignof(FlatState);
+}
+
+uint32_t BTCompiledTree::AllocateState(size_t size, size_t alignment) {
+    stateAlignment_ = std::max(stateAlignment_, alignment);
+    size_t offset = (stateSize_ + alignment - 1) / alignment * alignment;
+    stateSize_ = offset + size;
+    return static_cast<uint32_t>(offset);
+}
+
+uint32_t BTCompiledTree::AllocateNodeState(const BTNodePtr& node, bool recursive) {
+    uint32_t offset = BTNode::kNoStateOffset;
+    if (node->GetStateSize() > 0) {
+        offset = AllocateState(node->GetStateSize(), node->GetStateAlignment());
+        statefulNodes_.push_back(node.get());
+        statefulOffsets_.push_back(offset);
+    }
+
+    // 展開しない部分木（未知のコンポジット配下）も状態ブロックに載せる
+    if (recursive && node->IsComposite()) {
+        for (const BTNodePtr& child : static_cast<const BTComposite*>(node.get())->GetChildren()) {
+            if (child) {
+                ownedNodes_.push_back(child);
+                AllocateNodeState(child, true);
+            }
+        }
+    }
+    return offset;
+}
+
+uint32_t BTCompiledTree::Flatten(const BTNodePtr& nodePtr) {
+    BTNode* node = nodePtr.get();
+    ownedNodes_.push_back(nodePtr);
+
+    uint32_t index = static_cast<uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    nodes_[index].node = node;
+    nodes_[index].stateOffset = AllocateState(sizeof(FlatState), alignof(FlatState));
+
+    // コンポジットの種別判定はコンパイル時に1度だけ行う
+    const BTComposite* composite = node->IsComposite() ? dynamic_cast<const BTComposite*>(node) : nullptr;
+    NodeKind kind = NodeKind::Leaf;
+    if (dynamic_cast<const BTRandomSelector*>(node)) {
+        kind = NodeKind::RandomSelector;
+    }
+    else if (dynamic_cast<const BTTimeSlice*>(node)) {
+        kind = NodeKind::TimeSlice;
+    }
+    else if (dynamic_cast<const BTSelector*>(node)) {
+        kind = NodeKind::Selector;
+    }
+    else if (dynamic_cast<const BTSequence*>(node)) {
+        kind = NodeKind::Sequence;
+    }
+    // 未知のコンポジットは葉として扱い、自身の Execute に評価を委ねる
+    nodes_[index].kind = kind;
+
+    if (composite && kind != NodeKind::Leaf) {
+        const auto& children = composite->GetChildren();
+        uint32_t childBegin = static_cast<uint32_t>(childIndices_.size());
+        uint32_t childCount = static_cast<uint32_t>(children.size());
+        nodes_[index].childBegin = childBegin;
+        nodes_[index].childCount = childCount;
+
+        if (kind == NodeKind::RandomSelector) {
+            nodes_[index].orderOffset = AllocateState(sizeof(uint32_t) * childCount, alignof(uint32_t));
+        }
+        // 間引き評価の記録はデコレーター自身の状態に置く
+        if (kind == NodeKind::TimeSlice) {
+            nodes_[index].nodeStateOffset = AllocateNodeState(nodePtr, false);
+        }
+
+        // 子インデックスの領域を先に確保し、子の部分木を続けて配置
+        childIndices_.resize(childIndices_.size() + childCount);
+        for (uint32_t i = 0; i < childCount; ++i) {
+            childIndices_[childBegin + i] = Flatten(children[i]);
+        }
+    }
+    else {
+        nodes_[index].nodeStateOffset = AllocateNodeState(nodePtr, node->IsComposite());
+    }
+
+    nodes_[index].subtreeEnd = static_cast<uint32_t>(nodes_.size());
+    return index;
+}
+
+void BTCompiledTree::InitializeState(std::byte* block) const {
+    InitializeFlatStates(block);
+
+    for (size_t i = 0; i < statefulNodes_.size(); ++i) {
+        statefulNodes_[i]->InitializeState(block + statefulOffsets_[i]);
+    }
+}
+
+void BTCompiledTree::ResetState(std::byte* block) const {
+    InitializeFlatStates(block);
+
+    for (size_t i = 0; i < statefulNodes_.size(); ++i) {
+        if (!statefulNodes_[i]->IsStatePersistent()) {
+            statefulNodes_[i]->InitializeState(block + statefulOffsets_[i]);
+        }
+    }
+}
+
+void BTCompiledTree::InitializeFlatStates(std::byte* block) const {
+    for (const FlatNode& flat : nodes_) {
+        new (block + flat.stateOffset) FlatState();
+
+        // RandomSelector の評価順は子の並び順で初期化
+        if (flat.kind == NodeKind::RandomSelector) {
+            uint32_t* order = reinterpret_cast<uint32_t*>(block + flat.orderOffset);
+            for (uint32_t i = 0; i < flat.childCount; ++i) {
+                order[i] = i;
+            }
+        }
+    }
+}
+
+uint32_t BTCompiledTree::FindNodeStateOffset(const BTNode* node) const {
+    for (size_t i = 0; i < statefulNodes_.size(); ++i) {
+        if (statefulNodes_[i] == node) {
+            return statefulOffsets_[i];
+        }
+    }
+    return BTNode::kNoStateOffset;
+}
+
+bool BTCompiledTree::MigrateState(const BTCompiledTree& previous, const std::byte* previousBlock,
+                                  std::byte* block) const {
+    if (nodes_.empty() || previous.nodes_.empty() || !previousBlock || !block) {
+        return false;
+    }
+
+    // ルートが差し替えられていれば引き継ぐ経路がない
+    if (nodes_[0].node != previous.nodes_[0].node) {
+        return false;
+    }
+    return MigrateNode(0, previous, 0, previousBlock, block);
+}
+
+bool BTCompiledTree::MigrateNode(uint32_t index, const BTCompiledTree& previous, uint32_t previousIndex,
+                                 const std::byte* previousBlock, std::byte* block) const {
+    const FlatNode& flat = nodes_[index];
+    const FlatNode& previousFlat = previous.nodes_[previousIndex];
+    const FlatState& previousState = GetFlatState(previousBlock, previousFlat);
+
+    // 完了済みのノードの状態はルートの完了時に初期化されるため、実行中の経路だけを引き継ぐ
+    if (previousState.status != BTNodeStatus::Running || flat.kind != previousFlat.kind) {
+        return false;
+    }
+
+    FlatState& state = GetFlatState(block, flat);
+
+    if (flat.kind == NodeKind::Leaf) {
+        CopyNodeState(flat.node, previous, previousBlock, block, true);
+        state.status = BTNodeStatus::Running;
+        return true;
+    }
+
+    uint32_t previousPosition = previousState.currentChild;
+    if (previousFlat.kind == NodeKind::RandomSelector) {
+        previousPosition = GetOrder(previousBlock, previousFlat)[previousPosition];
+    }
+    uint32_t previousChild = previous.childIndices_[previousFlat.childBegin + previousPosition];
+    const BTNode* runningChild = previous.nodes_[previousChild].node;
+
+    if (flat.kind == NodeKind::RandomSelector) {
+        // 評価順は子の位置の並べ替えなので、子の並びが同じ場合だけ引き継ぐ
+        if (flat.childCount != previousFlat.childCount) {
+            return false;
+        }
+        for (uint32_t i = 0; i < flat.childCount; ++i) {
+            if (nodes_[childIndices_[flat.childBegin + i]].node !=
+                previous.nodes_[previous.childIndices_[previousFlat.childBegin + i]].node) {
+                return false;
+            }
+        }
+        if (!MigrateNode(childIndices_[flat.childBegin + previousPosition], previous, previousChild,
+                         previousBlock, block)) {
+            return false;
+        }
+
+        std::copy_n(GetOrder(previousBlock, previousFlat), flat.childCount, GetOrder(block, flat));
+        state = previousState;
+        return true;
+    }
+
+    // Selector / Sequence / TimeSlice: 実行中の子の新しい位置から続行する
+    for (uint32_t i = 0; i < flat.childCount; ++i) {
+        uint32_t child = childIndices_[flat.childBegin + i];
+        if (nodes_[child].node != runningChild) {
+            continue;
+        }
+        if (!MigrateNode(child, previous, previousChild, previousBlock, block)) {
+            return false;
+        }
+        CopyNodeState(flat.node, previous, previousBlock, block, false);
+        state.currentChild = i;
+        state.status = BTNodeStatus::Running;
+        return true;
+    }
+    return false;
+}
+
+void BTCompiledTree::CopyNodeState(const BTNode* node, const BTCompiledTree& previous,
+                                   const std::byte* previousBlock, std::byte* block, bool recursive) const {
+    if (node->GetStateSize() > 0) {
+        uint32_t previousOffset = previous.FindNodeStateOffset(node);
+        uint32_t offset = FindNodeStateOffset(node);
+        if (previousOffset != BTNode::kNoStateOffset && offset != BTNode::kNoStateOffset) {
+            // 状態は破棄処理を必要としない型に限定しているためバイト列のコピーで移せる
+            std::memcpy(block + offset, previousBlock + previousOffset, node->GetStateSize());
+        }
+    }
+
+    // 展開しない部分木（未知のコンポジット配下）の状態も移す
+    if (recursive && node->IsComposite()) {
+        for (const BTNodePtr& child : static_cast<const BTComposite*>(node)->GetChildren()) {
+            if (child) {
+                CopyNodeState(child.get(), previous, previousBlock, block, true);
+            }
+        }
+    }
+}
+
+BTNodeStatus BTCompiledTree::Tick(BTBlackboard* blackboard) const {
+    std::byte* block = blackboard->GetNodeStateBlock();
+    if (nodes_.empty() || !block) {
+        return BTNodeStatus::Failure;
+    }
+
+    BTNodeStatus status = TickNode(0, blackboard, block);
+    blackboard->SetActiveNode(nullptr, nullptr, BTNode::kNoStateOffset);
+    return status;
+}
+
+BTNodeStatus BTCompiledTree::TickNode(uint32_t index, BTBlackboard* blackboard, std::byte* block) const {
+#if BT_PROFILER_ENABLED
+    BTProfiler::Scope profile(nodes_[index].node);
+    return profile.Finish(EvaluateNode(index, blackboard, block));
+#else
+    return EvaluateNode(index, blackboard, block);
+#endif
+}
+
+BTNodeStatus BTCompiledTree::EvaluateNode(uint32_t index, BTBlackboard* blackboard, std::byte* block) const {
+    const FlatNode& flat = nodes_[index];
+    FlatState& state = GetFlatState(block, flat);
+
+    switch (flat.kind) {
+    case NodeKind::Leaf:
+        blackboard->SetActiveNode(this, flat.node, flat.nodeStateOffset);
+        state.status = flat.node->Execute(blackboard);
+        return state.status;
+
+    case NodeKind::Selector:
+        // 前回 Running だった子から続行し、最初の成功で停止
+        for (uint32_t i = state.currentChild; i < flat.childCount; ++i) {
+            BTNodeStatus childStatus = TickNode(childIndices_[flat.childBegin + i], blackboard, block);
+            if (childStatus == BTNodeStatus::Success) {
+                state.currentChild = 0;
+                state.status = BTNodeStatus::Success;
+                return state.status;
+            }
+            if (childStatus == BTNodeStatus::Running) {
+                state.currentChild = i;
+                state.status = BTNodeStatus::Running;
+                return state.status;
+            }
+        }
+        state.currentChild = 0;
+        state.status = BTNodeStatus::Failure;
+        return state.status;
+
+    case NodeKind::Sequence:
+        // 前回 Running だった子から続行し、最初の失敗で停止
+        for (uint32_t i = state.currentChild; i < flat.childCount; ++i) {
+            BTNodeStatus childStatus = TickNode(childIndices_[flat.childBegin + i], blackboard, block);
+            if (childStatus == BTNodeStatus::Failure) {
+                state.currentChild = 0;
+                state.status = BTNodeStatus::Failure;
+                return state.status;
+            }
+            if (childStatus == BTNodeStatus::Running) {
+                state.currentChild = i;
+                state.status = BTNodeStatus::Running;
+                return state.status;
+            }
+        }
+        state.currentChild = 0;
+        state.status = BTNodeStatus::Success;
+        return state.status;
+
+    case NodeKind::RandomSelector: {
+        if (flat.childCount == 0) {
+            state.status = BTNodeStatus::Failure;
+            return state.status;
+        }
+
+        // 新しい選択サイクルの開始時のみ子の評価順をシャッフル
+        uint32_t* order = GetOrder(block, flat);
+        if (state.needsShuffle) {
+            ShuffleOrder(order, flat.childCount, blackboard->GetRandom());
+            state.needsShuffle = false;
+            state.currentChild = 0;
+        }
+
+        for (uint32_t i = state.currentChild; i < flat.childCount; ++i) {
+            BTNodeStatus childStatus = TickNode(childIndices_[flat.childBegin + order[i]], blackboard, block);
+            if (childStatus == BTNodeStatus::Success) {
+                state.needsShuffle = true;
+                state.status = BTNodeStatus::Success;
+                return state.status;
+            }
+            if (childStatus == BTNodeStatus::Running) {
+                state.currentChild = i;
+                state.status = BTNodeStatus::Running;
+                return state.status;
+            }
+        }
+        state.needsShuffle = true;
+        state.status = BTNodeStatus::Failure;
+        return state.status;
+    }
+
+    case NodeKind::TimeSlice: {
+        if (flat.childCount == 0) {
+            state.status = BTNodeStatus::Failure;
+            return state.status;
+        }
+
+        // 間隔内は前回の結果を返し、子の部分木を評価しない
+        const auto* slice = static_cast<const BTTimeSlice*>(flat.node);
+        BTNodeStatus cachedStatus;
+        blackboard->SetActiveNode(this, flat.node, flat.nodeStateOffset);
+        if (slice->TryGetCachedStatus(blackboard, cachedStatus)) {
+            state.status = cachedStatus;
+            return state.status;
+        }
+
+        state.currentChild = 0;
+        state.status = TickNode(childIndices_[flat.childBegin], blackboard, block);
+        // 子の評価で評価中のノードが切り替わっているため設定し直す
+        blackboard->SetActiveNode(this, flat.node, flat.nodeStateOffset);
+        slice->StoreStatus(blackboard, state.status);
+        return state.status;
+    }
+    }
+
+    return BTNodeStatus::Failure;
+}
+
+void BTCompiledTree::ShuffleOrder(uint32_t* order, uint32_t count, BTRandom& random) {
+    // Fisher-Yates シャッフル（エージェントの乱数を使い、並列評価でも競合しない）
+    for (uint32_t i = count - 1; i > 0; --i) {
+        uint32_t j = static_cast<uint32_t>(random.GetInt(0, static_cast<int>(i)));
+        std::swap(order[i], order[j]);
+    }
+}
+
+uint32_t BTCompiledTree::FindRunningNodeIndex(const std::byte* block) const {
+    if (nodes_.empty() || !block || GetFlatState(block, nodes_[0]).status != BTNodeStatus::Running) {
+        return kInvalidIndex;
+    }
+
+    // Running の子をたどって最深の実行中ノードを求める
+    uint32_t index = 0;
+    while (nodes_[index].kind != NodeKind::Leaf) {
+        const FlatNode& flat = nodes_[index];
+        const FlatState& state = GetFlatState(block, flat);
+        uint32_t position = state.currentChild;
+        if (flat.kind == NodeKind::RandomSelector) {
+            position = GetOrder(block, flat)[position];
+        }
+        uint32_t child = childIndices_[flat.childBegin + position];
+        if (GetFlatState(block, nodes_[child]).status != BTNodeStatus::Running) {
+            break;
+        }
+        index = child;
+    }
+    return index;
+}
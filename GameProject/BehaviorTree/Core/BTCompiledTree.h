@@ -0,0 +1,291 @@
+#pragma once
+#include "BTNode.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+class BTBlackboard;
+class BTRandom;
+
+/// <summary>
+/// コンパイル済みビヘイビアツリー
+/// shared_ptr で構成されたノードグラフを前順序（pre-order）の連続配列に展開し、
+/// インデックスベースで評価する（参照カウント操作・RTTI キャストなし）
+/// コンパイル後は不変で、実行状態（コンポジットの進行位置・各ノードのランタイム状態）は
+/// すべてエージェントごとの状態ブロックに置くため、1つのツリーを複数のエージェントで共有できる
+/// 各ノードの状態オフセットもツリー側の配列に持ち、評価時にブラックボード経由で渡すため、
+/// 同じノードを複数のツリーにコンパイルしてもノード本体は書き換わらない
+/// </summary>
+class BTCompiledTree {
+public:
+    /// <summary>
+    /// 無効なインデックス
+    /// </summary>
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    /// <summary>
+    /// コンパイル済みノードの種別
+    /// </summary>
+    enum class NodeKind : uint8_t {
+        Leaf,            // 葉ノード（BTNode::Execute を直接呼ぶ）
+        Selector,        // BTSelector 相当
+        Sequence,        // BTSequence 相当
+        RandomSelector,  // BTRandomSelector 相当
+        TimeSlice        // BTTimeSlice 相当（子は1つ目のみ評価）
+    };
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    BTCompiledTree() = default;
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~BTCompiledTree() = default;
+
+    /// <summary>
+    /// ノードグラフからフラット配列と状態ブロックのレイアウトを構築
+    /// 各ノードの状態オフセットもここで割り当てる（ノード本体は変更しない）
+    /// </summary>
+    /// <param name="root">ルートノード（ツリーが所有を引き継ぐ）</param>
+    /// <returns>構築に成功したら true</returns>
+    bool Compile(const BTNodePtr& root);
+
+    /// <summary>
+    /// コンパイル結果の破棄
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// ツリーを1回評価（状態はブラックボードに設定された状態ブロックを使う）
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <returns>ルートの実行結果</returns>
+    BTNodeStatus Tick(BTBlackboard* blackboard) const;
+
+    /// <summary>
+    /// 状態ブロックを初期状態で構築
+    /// </summary>
+    /// <param name="block">状態ブロック（GetStateSize バイト）</param>
+    void InitializeState(std::byte* block) const;
+
+    /// <summary>
+    /// 実行の進行に関わる状態だけを初期状態に戻す（ツリーの完了時・リセット時）
+    /// IsStatePersistent なノードの状態（評価キャッシュなど）は保持する
+    /// </summary>
+    /// <param name="block">状態ブロック（InitializeState 済み）</param>
+    void ResetState(std::byte* block) const;
+
+    /// <summary>
+    /// 以前のツリーの状態ブロックから実行中の経路（Running の子をたどった各ノード）の状態を引き継ぐ
+    /// ノードを共有したまま構造だけを変えたツリー（ホットリロード・エディタでの編集）で、
+    /// 実行中のアクションを中断せずに差し替えるために使う
+    /// 実行中のノードが新しいツリーに無い場合や、子の並びが変わった RandomSelector を
+    /// 経路に含む場合は引き継がない
+    /// </summary>
+    /// <param name="previous">以前のツリー</param>
+    /// <param name="previousBlock">以前のツリーでの状態ブロック</param>
+    /// <param name="block">このツリーの状態ブロック（InitializeState 済み）</param>
+    /// <returns>実行中の経路を引き継いだら true（false の場合 block は初期状態のまま）</returns>
+    bool MigrateState(const BTCompiledTree& previous, const std::byte* previousBlock, std::byte* block) const;
+
+    /// <summary>
+    /// 現在実行中の最深ノードのインデックスを検索
+    /// </summary>
+    /// <param name="block">エージェントの状態ブロック</param>
+    /// <returns>実行中ノードのインデックス（なければ kInvalidIndex）</returns>
+    uint32_t FindRunningNodeIndex(const std::byte* block) const;
+
+    /// <summary>
+    /// インデックスから元のノードを取得
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <returns>元のノード（範囲外なら nullptr）</returns>
+    BTNode* GetNode(uint32_t index) const {
+        return index < nodes_.size() ? nodes_[index].node : nullptr;
+    }
+
+    /// <summary>
+    /// ルートノードの取得
+    /// </summary>
+    /// <returns>ルートノード</returns>
+    const BTNodePtr& GetRoot() const { return root_; }
+
+    /// <summary>
+    /// コンパイル済みかどうか
+    /// </summary>
+    /// <returns>ノードが1つ以上あれば true</returns>
+    bool IsCompiled() const { return !nodes_.empty(); }
+
+    /// <summary>
+    /// ノード数の取得
+    /// </summary>
+    /// <returns>フラット配列のノード数</returns>
+    size_t GetNodeCount() const { return nodes_.size(); }
+
+    /// <summary>
+    /// エージェント1体分の状態ブロックのサイズ
+    /// </summary>
+    /// <returns>バイト数</returns>
+    size_t GetStateSize() const { return stateSize_; }
+
+    /// <summary>
+    /// 状態ブロックに必要なアライメント
+    /// </summary>
+    /// <returns>アライメント（バイト）</returns>
+    size_t GetStateAlignment() const { return stateAlignment_; }
+
+    /// <summary>
+    /// 独自のランタイム状態を持つノードの、このツリーでの状態オフセットを検索
+    /// フラット配列に展開されない部分木のノードが状態を引くときに使う（線形探索）
+    /// </summary>
+    /// <param name="node">ノード</param>
+    /// <returns>オフセット（状態を持たない・含まれない場合は BTNode::kNoStateOffset）</returns>
+    uint32_t FindNodeStateOffset(const BTNode* node) const;
+
+private:
+    /// <summary>
+    /// フラット配列の1要素（評価に必要な不変情報のみ保持）
+    /// </summary>
+    struct FlatNode {
+        BTNode* node = nullptr;                       // 元のノード（root_ が所有）
+        uint32_t childBegin = 0;                      // childIndices_ 内の開始位置
+        uint32_t childCount = 0;                      // 子ノード数
+        uint32_t subtreeEnd = 0;                      // 部分木の終端（次の兄弟のインデックス）
+        uint32_t stateOffset = 0;                     // 状態ブロック内の FlatState の位置
+        uint32_t nodeStateOffset = BTNode::kNoStateOffset; // ノード独自のランタイム状態の位置
+        uint32_t orderOffset = 0;                     // RandomSelector の評価順配列の位置
+        NodeKind kind = NodeKind::Leaf;               // ノード種別
+    };
+
+    /// <summary>
+    /// エージェントごとのフラットノード状態（状態ブロックに置く）
+    /// </summary>
+    struct FlatState {
+        uint32_t currentChild = 0;                    // 実行中の子（評価順での位置）
+        BTNodeStatus status = BTNodeStatus::Failure;  // 直近の実行結果
+        bool needsShuffle = true;                     // RandomSelector 用シャッフル要求
+    };
+
+    /// <summary>
+    /// ノードを前順序で再帰的に配置
+    /// </summary>
+    /// <param name="node">配置するノード</param>
+    /// <returns>配置したインデックス</returns>
+    uint32_t Flatten(const BTNodePtr& node);
+
+    /// <summary>
+    /// ノード（と展開しない部分木）のランタイム状態を状態ブロックに割り当て
+    /// </summary>
+    /// <param name="node">対象ノード</param>
+    /// <param name="recursive">子孫も割り当てるか（未知のコンポジット用）</param>
+    /// <returns>対象ノードの状態オフセット（状態を持たなければ BTNode::kNoStateOffset）</returns>
+    uint32_t AllocateNodeState(const BTNodePtr& node, bool recursive);
+
+    /// <summary>
+    /// フラットノードの状態（と RandomSelector の評価順）を初期化
+    /// </summary>
+    /// <param name="block">状態ブロック</param>
+    void InitializeFlatStates(std::byte* block) const;
+
+    /// <summary>
+    /// 実行中の経路を1ノード分引き継ぎ、Running の子へ再帰する
+    /// </summary>
+    /// <param name="index">このツリーでのインデックス</param>
+    /// <param name="previous">以前のツリー</param>
+    /// <param name="previousIndex">以前のツリーでのインデックス（同じノード）</param>
+    /// <param name="previousBlock">以前のツリーでの状態ブロック</param>
+    /// <param name="block">このツリーの状態ブロック</param>
+    /// <returns>引き継いだら true</returns>
+    bool MigrateNode(uint32_t index, const BTCompiledTree& previous, uint32_t previousIndex,
+                     const std::byte* previousBlock, std::byte* block) const;
+
+    /// <summary>
+    /// ノード（と展開しない部分木）の独自のランタイム状態をコピー
+    /// </summary>
+    /// <param name="node">対象ノード</param>
+    /// <param name="previous">以前のツリー</param>
+    /// <param name="previousBlock">以前のツリーでの状態ブロック</param>
+    /// <param name="block">このツリーの状態ブロック</param>
+    /// <param name="recursive">子孫もコピーするか（展開しない部分木用）</param>
+    void CopyNodeState(const BTNode* node, const BTCompiledTree& previous,
+                       const std::byte* previousBlock, std::byte* block, bool recursive) const;
+
+    /// <summary>
+    /// 状態ブロック上の領域を確保
+    /// </summary>
+    /// <param name="size">サイズ</param>
+    /// <param name="alignment">アライメント</param>
+    /// <returns>オフセット</returns>
+    uint32_t AllocateState(size_t size, size_t alignment);
+
+    /// <summary>
+    /// インデックス指定でノードを評価
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="block">エージェントの状態ブロック</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus TickNode(uint32_t index, BTBlackboard* blackboard, std::byte* block) const;
+
+    /// <summary>
+    /// ノード種別ごとの評価本体（TickNode から計測区間の内側で呼ぶ）
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="block">エージェントの状態ブロック</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus EvaluateNode(uint32_t index, BTBlackboard* blackboard, std::byte* block) const;
+
+    /// <summary>
+    /// RandomSelector の子の評価順をシャッフル
+    /// </summary>
+    /// <param name="order">評価順配列（エージェントの状態ブロック内）</param>
+    /// <param name="count">子ノード数</param>
+    /// <param name="random">エージェントの乱数生成器</param>
+    static void ShuffleOrder(uint32_t* order, uint32_t count, BTRandom& random);
+
+    /// <summary>
+    /// 状態ブロック内の FlatState を取得
+    /// </summary>
+    static FlatState& GetFlatState(std::byte* block, const FlatNode& flat) {
+        return *std::launder(reinterpret_cast<FlatState*>(block + flat.stateOffset));
+    }
+
+    static const FlatState& GetFlatState(const std::byte* block, const FlatNode& flat) {
+        return *std::launder(reinterpret_cast<const FlatState*>(block + flat.stateOffset));
+    }
+
+    /// <summary>
+    /// 状態ブロック内の評価順配列を取得
+    /// </summary>
+    static uint32_t* GetOrder(std::byte* block, const FlatNode& flat) {
+        return std::launder(reinterpret_cast<uint32_t*>(block + flat.orderOffset));
+    }
+    static const uint32_t* GetOrder(const std::byte* block, const FlatNode& flat) {
+        return std::launder(reinterpret_cast<const uint32_t*>(block + flat.orderOffset));
+    }
+
+    // ノードグラフのルート
+    BTNodePtr root_;
+
+    // コンパイル時に含まれていた全ノード（コンパイル後に子が付け替えられても、
+    // フラット配列が参照するノードの寿命を保証する）
+    std::vector<BTNodePtr> ownedNodes_;
+
+    // 前順序で並べたノード配列
+    std::vector<FlatNode> nodes_;
+
+    // 各ノードの子インデックス（childBegin/childCount で参照）
+    std::vector<uint32_t> childIndices_;
+
+    // 独自のランタイム状態を持つノードと、このツリーでの状態オフセット（初期化・引き継ぎ用）
+    std::vector<BTNode*> statefulNodes_;
+    std::vector<uint32_t> statefulOffsets_;
+
+    // 状態ブロックのサイズ・アライメント
+    size_t stateSize_ = 0;
+    size_t stateAlignment_ = alignof(FlatState);
+};
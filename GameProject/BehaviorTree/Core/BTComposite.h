@@ -58,6 +58,17 @@ public:
     /// </summary>
     void Reset() override;
 
+    /// <summary>
+    /// 実行中の子ノードを取得（ノードグラフ評価時の実行中ノード追跡用）
+    /// </summary>
+    /// <returns>Running を返した子ノード（実行中でなければ nullptr）</returns>
+    virtual BTNode* GetRunningChild() const {
+        if (status_ != BTNodeStatus::Running || currentChildIndex_ >= children_.size()) {
+            return nullptr;
+        }
+        return children_[currentChildIndex_].get();
+    }
+
 protected:
     // 子ノードのリスト
     std::vector<BTNodePtr> children_;
@@ -1,8 +1,11 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
 #include <json.hpp>
+#include "BTParameters.h"
 
 class BTBlackboard;
 
@@ -81,10 +84,11 @@ public:
     virtual bool IsComposite() const { return false; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
+    /// JSON（エディタ・ホットリロード）と .btbin のパラメータレコードのどちらからも同じ関数で適用する
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    virtual void ApplyParameters(const nlohmann::json& params) {
+    /// <param name="params">パラメータ</param>
+    virtual void ApplyParameters(const BTParameters& params) {
         // デフォルトは何もしない（パラメータを持たないノード用）
         (void)params;
     }
@@ -98,6 +102,37 @@ public:
         return {};
     }
 
+    /// <summary>
+    /// ランタイム状態を持たないことを示すオフセット
+    /// </summary>
+    static constexpr uint32_t kNoStateOffset = UINT32_MAX;
+
+    /// <summary>
+    /// エージェントごとのランタイム状態のサイズ
+    /// ノード自身はパラメータのみを持ち、実行中の状態はエージェントの状態ブロックに置く
+    /// </summary>
+    /// <returns>状態のバイト数（0 なら状態を持たない）</returns>
+    virtual size_t GetStateSize() const { return 0; }
+
+    /// <summary>
+    /// ランタイム状態のアライメント
+    /// </summary>
+    /// <returns>アライメント（バイト）</returns>
+    virtual size_t GetStateAlignment() const { return 1; }
+
+    /// <summary>
+    /// 状態ブロック上にランタイム状態を初期値で構築
+    /// </summary>
+    /// <param name="state">状態の格納先（GetStateSize バイト）</param>
+    virtual void InitializeState(void* state) const { (void)state; }
+
+    /// <summary>
+    /// ランタイム状態をツリーの完了・リセットをまたいで保持するか
+    /// （条件の評価キャッシュなど、実行の進行ではなく評価の省略に使う状態）
+    /// </summary>
+    /// <returns>保持するなら true</returns>
+    virtual bool IsStatePersistent() const { return false; }
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGui でパラメータ編集 UI を描画
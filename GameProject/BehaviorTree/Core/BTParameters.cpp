@@ -0,0 +1,129 @@
+#include "BTParameters.h"
+#include <cstring>
+#include <limits>
+
+namespace {
+
+/// <summary>
+/// レコードが占める数（入れ子の中身を含む）
+/// </summary>
+uint32_t GetSpan(const BTParameters::Record& record) {
+    return record.kind == static_cast<uint8_t>(BTParameters::Kind::Object) ? record.size + 1 : 1;
+}
+
+/// <summary>
+/// 文字列を文字列領域に追加して位置を返す
+/// </summary>
+uint32_t AppendString(std::string& strings, const std::string& value) {
+    uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings += value;
+    return offset;
+}
+
+} // namespace
+
+bool BTParameters::contains(const char* key) const {
+    if (json_) {
+        return json_->contains(key);
+    }
+    return FindMember(key) != nullptr;
+}
+
+BTParameters BTParameters::operator[](const char* key) const {
+    if (json_) {
+        static const nlohmann::json kNull;
+        auto it = json_->find(key);
+        return BTParameters(it != json_->end() ? *it : kNull);
+    }
+
+    BTParameters member;
+    member.strings_ = strings_;
+    if (const Record* record = FindMember(key)) {
+        member.value_ = record;
+        if (record->kind == static_cast<uint8_t>(Kind::Object)) {
+            member.members_ = record + 1;
+            member.memberCount_ = record->size;
+        }
+    }
+    return member;
+}
+
+const BTParameters::Record* BTParameters::FindMember(const char* key) const {
+    size_t keyLength = std::strlen(key);
+    for (uint32_t i = 0; i < memberCount_; i += GetSpan(members_[i])) {
+        const Record& record = members_[i];
+        if (record.keyLength == keyLength &&
+            std::memcmp(strings_ + record.keyOffset, key, keyLength) == 0) {
+            return &record;
+        }
+    }
+    return nullptr;
+}
+
+bool BTParameters::Flatten(const nlohmann::json& json, std::vector<Record>& records, std::string& strings) {
+    if (!json.is_object()) {
+        return false;
+    }
+
+    for (const auto& [key, value] : json.items()) {
+        if (value.is_null()) {
+            continue;
+        }
+        if (key.size() > std::numeric_limits<uint16_t>::max()) {
+            return false;
+        }
+
+        Record record{};
+        record.keyOffset = AppendString(strings, key);
+        record.keyLength = static_cast<uint16_t>(key.size());
+
+        if (value.is_number() || value.is_boolean()) {
+            record.kind = static_cast<uint8_t>(Kind::Number);
+            record.number = value.is_boolean() ? (value.get<bool>() ? 1.0 : 0.0) : value.get<double>();
+            records.push_back(record);
+        }
+        else if (value.is_string()) {
+            const std::string& text = value.get_ref<const std::string&>();
+            record.kind = static_cast<uint8_t>(Kind::String);
+            record.size = static_cast<uint32_t>(text.size());
+            record.stringOffset = AppendString(strings, text);
+            records.push_back(record);
+        }
+        else if (value.is_object()) {
+            // 中身を続けて書いてから、入れ子のレコード数を埋める
+            record.kind = static_cast<uint8_t>(Kind::Object);
+            size_t index = records.size();
+            records.push_back(record);
+            if (!Flatten(value, records, strings)) {
+                return false;
+            }
+            records[index].size = static_cast<uint32_t>(records.size() - index - 1);
+        }
+        else {
+            // 配列などノードのパラメータで使わない値
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BTParameters::Validate(const Record* records, uint32_t count, uint32_t stringBytes) {
+    for (uint32_t i = 0; i < count; ) {
+        const Record& record = records[i];
+        if (record.kind > static_cast<uint8_t>(Kind::Object) ||
+            uint64_t(record.keyOffset) + record.keyLength > stringBytes) {
+            return false;
+        }
+        if (record.kind == static_cast<uint8_t>(Kind::String) &&
+            uint64_t(record.stringOffset) + record.size > stringBytes) {
+            return false;
+        }
+        if (record.kind == static_cast<uint8_t>(Kind::Object) &&
+            (uint64_t(i) + 1 + record.size > count ||
+             !Validate(records + i + 1, record.size, stringBytes))) {
+            return false;
+        }
+        i += GetSpan(record);
+    }
+    return true;
+}
@@ -0,0 +1,144 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <json.hpp>
+
+/// <summary>
+/// ノードに適用するパラメータの読み取り口
+/// JSON（エディタ・ホットリロード・JSON からの読み込み）と、.btbin に埋め込んだ固定レイアウトの
+/// パラメータレコードのどちらからでも、同じ ApplyParameters で値を取り出せるようにする
+/// レコードからの読み取りはマップしたファイルを直接参照し、JSON の DOM を作らない
+/// ノード側の記述を JSON と同じにするため、contains / operator[] / get は nlohmann::json に合わせた名前にしている
+/// </summary>
+class BTParameters {
+public:
+    /// <summary>
+    /// レコードの値の種類
+    /// </summary>
+    enum class Kind : uint8_t {
+        Number,     // 数値（整数・真偽値も含む）
+        String,     // 文字列
+        Object      // 入れ子のオブジェクト（直後の size 個のレコードが中身）
+    };
+
+    /// <summary>
+    /// 固定レイアウトのパラメータレコード（.btbin にそのまま並べる）
+    /// オブジェクトは深さ優先で平坦化し、Object のレコードの直後に中身のレコードを続ける
+    /// </summary>
+    struct Record {
+        uint32_t keyOffset;     // キーの位置（文字列領域内）
+        uint16_t keyLength;     // キーの長さ
+        uint8_t kind;           // Kind
+        uint8_t reserved;
+        uint32_t size;          // Object: 直後に続く入れ子のレコード数 / String: 文字列の長さ
+        uint32_t stringOffset;  // String: 値の位置（文字列領域内）
+        double number;          // Number: 値
+    };
+
+    /// <summary>
+    /// JSON を参照するパラメータ（暗黙変換で既存の JSON をそのまま渡せる）
+    /// </summary>
+    /// <param name="json">パラメータ JSON</param>
+    BTParameters(const nlohmann::json& json) : json_(&json) {}
+
+    /// <summary>
+    /// パラメータレコードの並びを1つのオブジェクトとして参照するパラメータ
+    /// </summary>
+    /// <param name="members">オブジェクトのメンバーのレコード（平坦化済み）</param>
+    /// <param name="memberCount">レコード数（入れ子の中身を含む）</param>
+    /// <param name="strings">文字列領域</param>
+    BTParameters(const Record* members, uint32_t memberCount, const char* strings)
+        : members_(members), memberCount_(memberCount), strings_(strings) {}
+
+    /// <summary>
+    /// キーを持つかどうか
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <returns>オブジェクトで、キーを持てば true</returns>
+    bool contains(const char* key) const;
+
+    /// <summary>
+    /// メンバーの取得
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <returns>メンバーの値（無ければ空の値）</returns>
+    BTParameters operator[](const char* key) const;
+
+    /// <summary>
+    /// 値の取り出し
+    /// レコードでは型が合わなければ既定値を返す（JSON では nlohmann::json::get と同じく例外）
+    /// </summary>
+    /// <typeparam name="T">数値型・列挙型・std::string</typeparam>
+    /// <returns>値</returns>
+    template <class T>
+    T get() const {
+        if (json_) {
+            return json_->get<T>();
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (value_ && value_->kind == static_cast<uint8_t>(Kind::String)) {
+                return std::string(strings_ + value_->stringOffset, value_->size);
+            }
+            return {};
+        }
+        else {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "unsupported parameter type");
+            if (value_ && value_->kind == static_cast<uint8_t>(Kind::Number)) {
+                if constexpr (std::is_same_v<T, bool>) {
+                    return value_->number != 0.0;
+                }
+                else {
+                    return static_cast<T>(value_->number);
+                }
+            }
+            return T{};
+        }
+    }
+
+    /// <summary>
+    /// 数値への暗黙変換（JSON と同じく `value_ = params["key"];` と書けるようにする）
+    /// </summary>
+    template <class T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int> = 0>
+    operator T() const {
+        return get<T>();
+    }
+
+    /// <summary>
+    /// JSON オブジェクトをパラメータレコードに平坦化
+    /// </summary>
+    /// <param name="json">パラメータ JSON（オブジェクト）</param>
+    /// <param name="records">レコードの追加先</param>
+    /// <param name="strings">キーと文字列値の追加先</param>
+    /// <returns>成功したら true（配列など表せない値があれば失敗）</returns>
+    static bool Flatten(const nlohmann::json& json, std::vector<Record>& records, std::string& strings);
+
+    /// <summary>
+    /// パラメータレコードの参照範囲を検証
+    /// </summary>
+    /// <param name="records">オブジェクトのメンバーのレコード</param>
+    /// <param name="count">レコード数</param>
+    /// <param name="stringBytes">文字列領域のバイト数</param>
+    /// <returns>入れ子の範囲と文字列の位置がすべて収まっていれば true</returns>
+    static bool Validate(const Record* records, uint32_t count, uint32_t stringBytes);
+
+private:
+    BTParameters() = default;
+
+    /// <summary>
+    /// メンバーのレコードを探す
+    /// </summary>
+    /// <param name="key">キー</param>
+    /// <returns>見つかったレコード（無ければ nullptr）</returns>
+    const Record* FindMember(const char* key) const;
+
+    // JSON を参照する場合
+    const nlohmann::json* json_ = nullptr;
+
+    // レコードを参照する場合
+    const Record* value_ = nullptr;     // 値のレコード（最上位のオブジェクトは nullptr）
+    const Record* members_ = nullptr;   // オブジェクトのメンバー
+    uint32_t memberCount_ = 0;
+    const char* strings_ = nullptr;
+};
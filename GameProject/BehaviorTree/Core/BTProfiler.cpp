@@ -0,0 +1,248 @@
+#include "BTProfiler.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <json.hpp>
+
+namespace {
+
+// 現在のスレッドで実行中のノードの深さ
+thread_local uint16_t currentDepth = 0;
+
+const char* GetStatusName(BTNodeStatus status) {
+    switch (status) {
+    case BTNodeStatus::Success: return "Success";
+    case BTNodeStatus::Failure: return "Failure";
+    case BTNodeStatus::Running: return "Running";
+    default:                    return "Unknown";
+    }
+}
+
+} // namespace
+
+thread_local BTProfiler::ThreadRing* BTProfiler::threadRing_ = nullptr;
+
+void BTProfiler::Scope::Begin(const BTNode* node) {
+    // リングバッファの登録（初回のみ確保が走る）を計測区間に含めない
+    GetInstance()->GetThreadRing();
+
+    node_ = node;
+    depth_ = currentDepth++;
+    beginNs_ = Now();
+}
+
+void BTProfiler::Scope::End() {
+    uint64_t endNs = Now();
+    --currentDepth;
+
+    Event event;
+    event.node = node_;
+    event.beginNs = beginNs_;
+    event.durationNs = static_cast<uint32_t>(std::min<uint64_t>(endNs - beginNs_, UINT32_MAX));
+    event.depth = depth_;
+    event.status = status_;
+    GetInstance()->Record(event);
+}
+
+BTProfiler* BTProfiler::GetInstance() {
+    static BTProfiler instance;
+    return &instance;
+}
+
+uint64_t BTProfiler::Now() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+BTProfiler::ThreadRing* BTProfiler::GetThreadRing() {
+    if (threadRing_) {
+        return threadRing_;
+    }
+
+    // スレッドごとに1回だけ登録する（以後の記録はロックしない）
+    auto ring = std::make_unique<ThreadRing>();
+    ring->events = std::make_unique<Event[]>(kRingCapacity);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ring->threadIndex = static_cast<uint32_t>(rings_.size());
+    threadRing_ = ring.get();
+    rings_.push_back(std::move(ring));
+    return threadRing_;
+}
+
+void BTProfiler::Record(const Event& event) {
+    ThreadRing* ring = GetThreadRing();
+
+    // 単一生産者・単一消費者のリング：読み出しが追いつかなければ捨てる
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    if (head - tail >= kRingCapacity) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ring->events[head & (kRingCapacity - 1)] = event;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void BTProfiler::Collect() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& ring : rings_) {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        for (uint64_t i = tail; i < head; ++i) {
+            Accumulate(*ring, ring->events[i & (kRingCapacity - 1)]);
+        }
+        ring->tail.store(head, std::memory_order_release);
+    }
+}
+
+void BTProfiler::Accumulate(ThreadRing& ring, const Event& event) {
+    auto [it, inserted] = statsIndices_.try_emplace(event.node, static_cast<uint32_t>(stats_.size()));
+    if (inserted) {
+        stats_.push_back({});
+        stats_.back().name = event.node->GetName();
+    }
+    NodeStats& stats = stats_[it->second];
+
+    // 子ノードは親より先に終わるため、同じスレッドのイベントを終了順に見れば
+    // 1つ深い階層に積んだ時間がそのまま直前に実行した子の合計になる
+    if (ring.childNs.size() < static_cast<size_t>(event.depth) + 2) {
+        ring.childNs.resize(static_cast<size_t>(event.depth) + 2, 0);
+    }
+    uint64_t childNs = ring.childNs[event.depth + 1];
+    ring.childNs[event.depth + 1] = 0;
+    ring.childNs[event.depth] += event.durationNs;
+    uint64_t selfNs = event.durationNs > childNs ? event.durationNs - childNs : 0;
+
+    ++stats.tickCount;
+    stats.totalNs += event.durationNs;
+    stats.selfNs += selfNs;
+    stats.peakNs = std::max(stats.peakNs, event.durationNs);
+    ++stats.statusCounts[static_cast<size_t>(event.status)];
+    maxSelfNs_ = std::max(maxSelfNs_, stats.selfNs);
+
+    // Chrome トレース用（古いものから上書き）
+    if (trace_.empty()) {
+        trace_.resize(kTraceCapacity);
+    }
+    trace_[traceWritten_ % kTraceCapacity] = { it->second, ring.threadIndex, event.beginNs, event.durationNs, event.status };
+    ++traceWritten_;
+}
+
+void BTProfiler::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // 未集計のイベントは破棄したノードを指している可能性があるため読まずに捨てる
+    for (auto& ring : rings_) {
+        ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+        ring->dropped.store(0, std::memory_order_relaxed);
+        ring->childNs.clear();
+    }
+
+    statsIndices_.clear();
+    stats_.clear();
+    maxSelfNs_ = 0;
+    traceWritten_ = 0;
+}
+
+const BTProfiler::NodeStats* BTProfiler::GetNodeStats(const BTNode* node) const {
+    auto it = statsIndices_.find(node);
+    if (it == statsIndices_.end()) {
+        return nullptr;
+    }
+    return &stats_[it->second];
+}
+
+uint64_t BTProfiler::GetDroppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t dropped = 0;
+    for (const auto& ring : rings_) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+bool BTProfiler::ExportChromeTrace(const std::string& filepath) const {
+    try {
+        nlohmann::json json;
+        json["displayTimeUnit"] = "ns";
+        nlohmann::json& events = json["traceEvents"];
+        events = nlohmann::json::array();
+
+        // スレッド名のメタデータ
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& ring : rings_) {
+                events.push_back({
+                    { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", ring->threadIndex },
+                    { "args", { { "name", "BT worker " + std::to_string(ring->threadIndex) } } }
+                });
+            }
+        }
+
+        // 保持中のイベントを古い順に出力（ts / dur はマイクロ秒）
+        uint64_t count = std::min<uint64_t>(traceWritten_, kTraceCapacity);
+        for (uint64_t i = traceWritten_ - count; i < traceWritten_; ++i) {
+            const TraceEvent& event = trace_[i % kTraceCapacity];
+            events.push_back({
+                { "name", stats_[event.statsIndex].name }, { "cat", "bt" }, { "ph", "X" },
+                { "ts", static_cast<double>(event.beginNs) / 1000.0 },
+                { "dur", static_cast<double>(event.durationNs) / 1000.0 },
+                { "pid", 1 }, { "tid", event.threadIndex },
+                { "args", { { "status", GetStatusName(event.status) } } }
+            });
+        }
+
+        std::filesystem::path path(filepath);
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+        std::ofstream file(filepath);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << json.dump();
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool BTProfiler::ExportStatsJSON(const std::string& filepath) const {
+    try {
+        nlohmann::json json;
+        json["droppedEvents"] = GetDroppedCount();
+        json["nodes"] = nlohmann::json::array();
+        for (const NodeStats& stats : stats_) {
+            json["nodes"].push_back({
+                { "name", stats.name },
+                { "ticks", stats.tickCount },
+                { "totalUs", static_cast<double>(stats.totalNs) / 1000.0 },
+                { "selfUs", static_cast<double>(stats.selfNs) / 1000.0 },
+                { "peakUs", static_cast<double>(stats.peakNs) / 1000.0 },
+                { "success", stats.statusCounts[static_cast<size_t>(BTNodeStatus::Success)] },
+                { "failure", stats.statusCounts[static_cast<size_t>(BTNodeStatus::Failure)] },
+                { "running", stats.statusCounts[static_cast<size_t>(BTNodeStatus::Running)] }
+            });
+        }
+
+        std::filesystem::path path(filepath);
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+        std::ofstream file(filepath);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << json.dump(2);
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
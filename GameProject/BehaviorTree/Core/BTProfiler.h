@@ -0,0 +1,262 @@
+#pragma once
+#include "BTNode.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ノード単位の計測を組み込むか（0 なら計測コードはすべてコンパイル時に取り除かれる）
+// 既定ではデバッグビルドのみ有効。リリースやヘッドレスで計測する場合は BT_PROFILER_ENABLED=1 を定義する
+#ifndef BT_PROFILER_ENABLED
+#ifdef _DEBUG
+#define BT_PROFILER_ENABLED 1
+#else
+#define BT_PROFILER_ENABLED 0
+#endif
+#endif
+
+/// <summary>
+/// ビヘイビアツリーのノード単位プロファイラ
+/// ノードの実行区間を評価スレッドごとのロックフリーなリングバッファに記録し、
+/// Collect でメインスレッドがノードごとの統計（実行回数・累計/最大時間・結果の内訳）に集計する
+/// 統計はノードのポインタで引くため、ツリーを共有する全エージェントの合計になる
+/// </summary>
+class BTProfiler {
+public:
+    /// <summary>
+    /// スレッドごとのリングバッファの容量（イベント数、2 の累乗）
+    /// </summary>
+    static constexpr uint32_t kRingCapacity = 1u << 14;
+
+    /// <summary>
+    /// Chrome トレース用に保持するイベント数
+    /// </summary>
+    static constexpr uint32_t kTraceCapacity = 1u << 16;
+
+    /// <summary>
+    /// ノードごとの統計
+    /// </summary>
+    struct NodeStats {
+        std::string name;                       // ノード名（集計時に複製）
+        uint64_t tickCount = 0;                 // 実行回数
+        uint64_t totalNs = 0;                   // 累計時間（子ノードを含む）
+        uint64_t selfNs = 0;                    // 累計時間（子ノードを除く）
+        uint32_t peakNs = 0;                    // 1回の実行の最大時間（子ノードを含む）
+        std::array<uint64_t, 3> statusCounts{}; // 結果ごとの回数（BTNodeStatus の順）
+    };
+
+    /// <summary>
+    /// 1回の実行区間
+    /// </summary>
+    struct Event {
+        const BTNode* node = nullptr;           // 実行したノード
+        uint64_t beginNs = 0;                   // 開始時刻（プロファイラ起動からの経過）
+        uint32_t durationNs = 0;                // 実行時間
+        uint16_t depth = 0;                     // 呼び出しの深さ（自己時間の算出用）
+        BTNodeStatus status = BTNodeStatus::Failure;
+    };
+
+    /// <summary>
+    /// ノード1回分の実行区間を記録するスコープ
+    /// 計測が無効なときはフラグを1回読むだけで何もしない
+    /// </summary>
+    class Scope {
+    public:
+        /// <summary>
+        /// コンストラクタ（計測開始）
+        /// </summary>
+        /// <param name="node">実行するノード</param>
+        explicit Scope(const BTNode* node) {
+            if (IsEnabled()) {
+                Begin(node);
+            }
+        }
+
+        /// <summary>
+        /// デストラクタ（計測終了・記録）
+        /// </summary>
+        ~Scope() {
+            if (node_) {
+                End();
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /// <summary>
+        /// 実行結果を設定してそのまま返す
+        /// </summary>
+        /// <param name="status">実行結果</param>
+        /// <returns>status</returns>
+        BTNodeStatus Finish(BTNodeStatus status) {
+            status_ = status;
+            return status;
+        }
+
+    private:
+        void Begin(const BTNode* node);
+        void End();
+
+        const BTNode* node_ = nullptr;
+        uint64_t beginNs_ = 0;
+        uint16_t depth_ = 0;
+        BTNodeStatus status_ = BTNodeStatus::Failure;
+    };
+
+    /// <summary>
+    /// インスタンスの取得
+    /// </summary>
+    /// <returns>インスタンス</returns>
+    static BTProfiler* GetInstance();
+
+    /// <summary>
+    /// 計測の有効/無効を設定
+    /// </summary>
+    /// <param name="enabled">有効にするなら true</param>
+    static void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    /// <summary>
+    /// 計測が有効か
+    /// </summary>
+    /// <returns>有効なら true</returns>
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// <summary>
+    /// 全スレッドのリングバッファを読み出して統計に集計（メインスレッドから呼ぶ）
+    /// 記録されたノードを破棄する前に呼ぶこと
+    /// </summary>
+    void Collect();
+
+    /// <summary>
+    /// 統計と保持中のイベントを破棄
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// ノードの統計を取得
+    /// </summary>
+    /// <param name="node">ノード</param>
+    /// <returns>統計（一度も記録されていなければ nullptr）</returns>
+    const NodeStats* GetNodeStats(const BTNode* node) const;
+
+    /// <summary>
+    /// 全ノードの統計を取得
+    /// </summary>
+    /// <returns>統計の配列</returns>
+    const std::vector<NodeStats>& GetAllStats() const { return stats_; }
+
+    /// <summary>
+    /// 自己時間の最大値（ヒートマップの正規化用）
+    /// </summary>
+    /// <returns>全ノード中で最大の累計自己時間</returns>
+    uint64_t GetMaxSelfNs() const { return maxSelfNs_; }
+
+    /// <summary>
+    /// リングバッファが満杯で捨てたイベント数
+    /// </summary>
+    /// <returns>イベント数</returns>
+    uint64_t GetDroppedCount() const;
+
+    /// <summary>
+    /// 保持中のイベントを Chrome トレース形式（chrome://tracing / Perfetto）で書き出す
+    /// </summary>
+    /// <param name="filepath">出力先</param>
+    /// <returns>成功したら true</returns>
+    bool ExportChromeTrace(const std::string& filepath) const;
+
+    /// <summary>
+    /// ノードごとの統計を JSON で書き出す
+    /// </summary>
+    /// <param name="filepath">出力先</param>
+    /// <returns>成功したら true</returns>
+    bool ExportStatsJSON(const std::string& filepath) const;
+
+private:
+    /// <summary>
+    /// 評価スレッド1つ分のリングバッファ（書き込みは評価スレッド、読み出しは Collect のみ）
+    /// </summary>
+    struct ThreadRing {
+        alignas(64) std::atomic<uint64_t> head{ 0 };   // 次の書き込み位置（評価スレッドが更新）
+        alignas(64) std::atomic<uint64_t> tail{ 0 };   // 次の読み出し位置（Collect が更新）
+        alignas(64) std::atomic<uint64_t> dropped{ 0 };
+        std::unique_ptr<Event[]> events;
+        uint32_t threadIndex = 0;
+
+        // 以下は Collect だけが触る
+        std::vector<uint64_t> childNs;                 // 深さごとの子ノードの累計時間
+    };
+
+    /// <summary>
+    /// Chrome トレース用に保持するイベント
+    /// </summary>
+    struct TraceEvent {
+        uint32_t statsIndex = 0;
+        uint32_t threadIndex = 0;
+        uint64_t beginNs = 0;
+        uint32_t durationNs = 0;
+        BTNodeStatus status = BTNodeStatus::Failure;
+    };
+
+    BTProfiler() = default;
+    ~BTProfiler() = default;
+    BTProfiler(const BTProfiler&) = delete;
+    BTProfiler& operator=(const BTProfiler&) = delete;
+
+    /// <summary>
+    /// 現在のスレッドのリングバッファを取得（初回に登録）
+    /// </summary>
+    ThreadRing* GetThreadRing();
+
+    /// <summary>
+    /// イベントを現在のスレッドのリングバッファに追加
+    /// </summary>
+    void Record(const Event& event);
+
+    /// <summary>
+    /// 1イベントを統計に加算
+    /// </summary>
+    void Accumulate(ThreadRing& ring, const Event& event);
+
+    /// <summary>
+    /// 現在時刻（プロファイラ起動からの経過ナノ秒）
+    /// </summary>
+    static uint64_t Now();
+
+    static inline std::atomic<bool> enabled_{ false };
+
+    // 現在のスレッドのリングバッファ
+    static thread_local ThreadRing* threadRing_;
+
+    // 登録済みのリングバッファ（スレッド終了後も Collect で読めるように所有する）
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+
+    // 集計結果
+    std::unordered_map<const BTNode*, uint32_t> statsIndices_;
+    std::vector<NodeStats> stats_;
+    uint64_t maxSelfNs_ = 0;
+
+    // Chrome トレース用に保持するイベント（古いものから上書き）
+    std::vector<TraceEvent> trace_;
+    uint64_t traceWritten_ = 0;
+};
+
+/// <summary>
+/// ノードを実行（計測が組み込まれていれば実行区間を記録）
+/// </summary>
+/// <param name="node">実行するノード</param>
+/// <param name="blackboard">ブラックボード</param>
+/// <returns>実行結果</returns>
+inline BTNodeStatus BTExecuteNode(BTNode* node, BTBlackboard* blackboard) {
+#if BT_PROFILER_ENABLED
+    BTProfiler::Scope scope(node);
+    return scope.Finish(node->Execute(blackboard));
+#else
+    return node->Execute(blackboard);
+#endif
+}
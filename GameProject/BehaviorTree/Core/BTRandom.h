@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+
+/// <summary>
+/// エージェントごとの乱数生成器（PCG32）
+/// 共有の RandomEngine と違いエージェントごとに独立しているため、
+/// 複数エージェントを並列に評価しても競合せず、シードが同じなら結果も再現する
+/// </summary>
+class BTRandom {
+public:
+    /// <summary>
+    /// 既定のシード
+    /// </summary>
+    static constexpr uint64_t kDefaultSeed = 0x853c49e6748fea9bULL;
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="seed">シード</param>
+    explicit BTRandom(uint64_t seed = kDefaultSeed) { Seed(seed); }
+
+    /// <summary>
+    /// シードを設定
+    /// </summary>
+    /// <param name="seed">シード</param>
+    void Seed(uint64_t seed) {
+        state_ = 0;
+        NextUInt();
+        state_ += seed;
+        NextUInt();
+    }
+
+    /// <summary>
+    /// 32bit の乱数を生成
+    /// </summary>
+    /// <returns>乱数</returns>
+    uint32_t NextUInt() {
+        uint64_t old = state_;
+        state_ = old * kMultiplier + kIncrement;
+        uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = static_cast<uint32_t>(old >> 59u);
+        return (xorShifted >> rot) | (xorShifted << ((~rot + 1u) & 31u));
+    }
+
+    /// <summary>
+    /// 範囲内の整数を生成（min, max を含む）
+    /// </summary>
+    /// <param name="min">最小値</param>
+    /// <param name="max">最大値</param>
+    /// <returns>乱数</returns>
+    int GetInt(int min, int max) {
+        if (max <= min) {
+            return min;
+        }
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+        return static_cast<int>(min + static_cast<int64_t>((static_cast<uint64_t>(NextUInt()) * range) >> 32));
+    }
+
+    /// <summary>
+    /// 範囲内の実数を生成
+    /// </summary>
+    /// <param name="min">最小値</param>
+    /// <param name="max">最大値</param>
+    /// <returns>乱数</returns>
+    float GetFloat(float min, float max) {
+        // 上位 24bit から [0, 1) の値を作る
+        float t = static_cast<float>(NextUInt() >> 8) * (1.0f / 16777216.0f);
+        return min + (max - min) * t;
+    }
+
+    /// <summary>
+    /// 指定した確率で true を返す
+    /// </summary>
+    /// <param name="probability">true になる確率（0.0〜1.0）</param>
+    /// <returns>判定結果</returns>
+    bool GetBool(float probability = 0.5f) {
+        return GetFloat(0.0f, 1.0f) < probability;
+    }
+
+private:
+    static constexpr uint64_t kMultiplier = 6364136223846793005ULL;
+    static constexpr uint64_t kIncrement = 1442695040888963407ULL;
+
+    // 内部状態
+    uint64_t state_ = 0;
+};
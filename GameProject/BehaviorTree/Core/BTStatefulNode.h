@@ -0,0 +1,61 @@
+#pragma once
+#include "BTNode.h"
+#include "BTBlackboard.h"
+#include "BTCompiledTree.h"
+#include <new>
+#include <type_traits>
+
+/// <summary>
+/// エージェントごとのランタイム状態を持つノードの基底クラス
+/// ノード本体（パラメータ）は複数のエージェントで共有し、
+/// TState はブラックボードに設定された状態ブロックから参照する
+/// </summary>
+/// <template name="TState">ランタイム状態の型（既定値で初期化できる単純な構造体）</template>
+/// <template name="TBase">基底のノード型（子を持つ場合は BTComposite）</template>
+template<typename TState, typename TBase = BTNode>
+class BTStatefulNode : public TBase {
+    static_assert(std::is_trivially_destructible_v<TState>,
+                  "BTStatefulNode の状態は破棄処理を必要としない型にする");
+
+public:
+    /// <summary>
+    /// ランタイム状態のサイズ
+    /// </summary>
+    /// <returns>sizeof(TState)</returns>
+    size_t GetStateSize() const override { return sizeof(TState); }
+
+    /// <summary>
+    /// ランタイム状態のアライメント
+    /// </summary>
+    /// <returns>alignof(TState)</returns>
+    size_t GetStateAlignment() const override { return alignof(TState); }
+
+    /// <summary>
+    /// 状態ブロック上にランタイム状態を初期値で構築
+    /// </summary>
+    /// <param name="state">状態の格納先</param>
+    void InitializeState(void* state) const override { new (state) TState(); }
+
+protected:
+    /// <summary>
+    /// 実行中エージェントのランタイム状態を取得
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <returns>状態（コンパイル済みツリーの評価外・状態ブロック未設定なら nullptr）</returns>
+    TState* GetState(BTBlackboard* blackboard) const {
+        // ツリーが直接呼んだノードは渡されたオフセットを使い、
+        // 展開されない部分木（未知のコンポジット配下）のノードは評価中のツリーから引く
+        uint32_t offset = BTNode::kNoStateOffset;
+        if (blackboard->GetActiveNode() == this) {
+            offset = blackboard->GetActiveStateOffset();
+        }
+        else if (const BTCompiledTree* tree = blackboard->GetActiveTree()) {
+            offset = tree->FindNodeStateOffset(this);
+        }
+
+        if (offset == BTNode::kNoStateOffset) {
+            return nullptr;
+        }
+        return blackboard->GetNodeState<TState>(offset);
+    }
+};
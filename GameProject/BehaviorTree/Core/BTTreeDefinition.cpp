@@ -0,0 +1,179 @@
+#include "BTTreeDefinition.h"
+#include "BTComposite.h"
+#include <fstream>
+#include <unordered_map>
+
+bool BTTreeDefinition::LoadFromFile(const std::string& filepath) {
+    try {
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        nlohmann::json json;
+        file >> json;
+        file.close();
+
+        return LoadFromJSON(json);
+    }
+    catch (const std::exception&) {
+        Clear();
+        return false;
+    }
+}
+
+bool BTTreeDefinition::LoadFromJSON(nlohmann::json& json) {
+    Clear();
+
+    try {
+        // バージョンチェック
+        if (!json.contains("version") || json["version"] != "1.0") {
+            return false;
+        }
+
+        // ノードテーブルを作成（ID → インデックス）
+        std::unordered_map<int, uint32_t> idToIndex;
+        auto nodesIt = json.find("nodes");
+        if (nodesIt != json.end()) {
+            nodes_.reserve(nodesIt->size());
+            idToIndex.reserve(nodesIt->size());
+
+            for (auto& nodeJson : *nodesIt) {
+                NodeDef def;
+                def.id = nodeJson["id"].get<int>();
+                def.type = nodeJson["type"].get<std::string>();
+
+                auto nameIt = nodeJson.find("displayName");
+                if (nameIt != nodeJson.end()) {
+                    def.displayName = nameIt->get<std::string>();
+                    def.hasDisplayName = true;
+                }
+
+                // パラメータは DOM からコピーせずに移す
+                auto paramsIt = nodeJson.find("parameters");
+                if (paramsIt != nodeJson.end()) {
+                    def.parameters = std::move(*paramsIt);
+                }
+
+                // 重複 ID は最初のノードを採用
+                if (idToIndex.emplace(def.id, static_cast<uint32_t>(nodes_.size())).second) {
+                    nodes_.push_back(std::move(def));
+                }
+            }
+        }
+
+        if (nodes_.empty()) {
+            return false;
+        }
+
+        // リンクを1回走査して（親, 子）のインデックス対と子の数を集計
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        std::vector<bool> hasParent(nodes_.size(), false);
+        auto linksIt = json.find("links");
+        if (linksIt != json.end()) {
+            edges.reserve(linksIt->size());
+
+            for (const auto& link : *linksIt) {
+                auto sourceIt = idToIndex.find(link["sourceNodeId"].get<int>());
+                auto targetIt = idToIndex.find(link["targetNodeId"].get<int>());
+                if (targetIt != idToIndex.end()) {
+                    hasParent[targetIt->second] = true;
+                }
+                if (sourceIt == idToIndex.end() || targetIt == idToIndex.end()) {
+                    continue;
+                }
+
+                edges.emplace_back(sourceIt->second, targetIt->second);
+                ++nodes_[sourceIt->second].childCount;
+            }
+        }
+
+        // 子の数の累積和から各ノードの開始位置を決め、リンクの記述順を保って配置
+        uint32_t offset = 0;
+        for (NodeDef& def : nodes_) {
+            def.childBegin = offset;
+            offset += def.childCount;
+        }
+        children_.resize(edges.size());
+        std::vector<uint32_t> cursor(nodes_.size(), 0);
+        for (const auto& [parent, child] : edges) {
+            children_[nodes_[parent].childBegin + cursor[parent]++] = child;
+        }
+
+        // ルートノードを探す（親リンクを持たない最初のノード）
+        rootIndex_ = 0;
+        for (uint32_t i = 0; i < nodes_.size(); ++i) {
+            if (!hasParent[i]) {
+                rootIndex_ = i;
+                break;
+            }
+        }
+
+        return true;
+    }
+    catch (const std::exception&) {
+        Clear();
+        return false;
+    }
+}
+
+void BTTreeDefinition::Clear() {
+    nodes_.clear();
+    children_.clear();
+    rootIndex_ = kInvalidIndex;
+}
+
+BTNodePtr BTTreeDefinition::Instantiate(const NodeFactory& factory, std::vector<BTNodePtr>* instances) const {
+    if (rootIndex_ == kInvalidIndex || !factory) {
+        return nullptr;
+    }
+
+    if (instances) {
+        instances->assign(nodes_.size(), nullptr);
+    }
+
+    std::vector<bool> visited(nodes_.size(), false);
+    return InstantiateRecursive(rootIndex_, factory, visited, instances);
+}
+
+BTNodePtr BTTreeDefinition::InstantiateRecursive(uint32_t index, const NodeFactory& factory,
+                                                 std::vector<bool>& visited, std::vector<BTNodePtr>* instances) const {
+    // 循環参照・重複参照を防ぐ
+    if (visited[index]) {
+        return nullptr;
+    }
+    visited[index] = true;
+
+    const NodeDef& def = nodes_[index];
+    BTNodePtr node = factory(def.type);
+    if (!node) {
+        return nullptr;
+    }
+
+    // パラメータを適用（ポリモーフィズムで各ノードが自己処理）
+    if (!def.parameters.is_null()) {
+        node->ApplyParameters(def.parameters);
+    }
+
+    // 表示名を設定（オプション）
+    if (def.hasDisplayName) {
+        node->SetName(def.displayName);
+    }
+
+    if (instances) {
+        (*instances)[index] = node;
+    }
+
+    // コンポジットノードの場合、隣接リストから子ノードを追加
+    if (node->IsComposite() && def.childCount > 0) {
+        auto* composite = static_cast<BTComposite*>(node.get());
+        for (uint32_t childIndex : GetChildren(index)) {
+            BTNodePtr childNode = InstantiateRecursive(childIndex, factory, visited, instances);
+            if (childNode) {
+                composite->AddChild(std::move(childNode));
+            }
+        }
+    }
+
+    return node;
+}
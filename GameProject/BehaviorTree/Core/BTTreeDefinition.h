@@ -0,0 +1,121 @@
+#pragma once
+#include "BTNode.h"
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+#include <json.hpp>
+
+/// <summary>
+/// ビヘイビアツリーの定義データ（JSON を1度だけ走査して作る中間表現）
+/// ノードテーブルと子ノードの隣接リスト（CSR 形式）を保持し、
+/// そこから O(N) でランタイムのノードグラフを生成する
+/// </summary>
+class BTTreeDefinition {
+public:
+    /// <summary>
+    /// 無効なインデックス
+    /// </summary>
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    /// <summary>
+    /// ノード定義
+    /// </summary>
+    struct NodeDef {
+        int id = -1;                      // JSON 上のノード ID
+        std::string type;                 // ノードタイプ名（"BTSelector"等）
+        std::string displayName;          // 表示名
+        bool hasDisplayName = false;      // 表示名が指定されているか
+        nlohmann::json parameters;        // パラメータ（null なら未指定）
+        uint32_t childBegin = 0;          // children_ 内の開始位置
+        uint32_t childCount = 0;          // 子ノード数
+    };
+
+    /// <summary>
+    /// ノードタイプ名からノードを生成する関数
+    /// </summary>
+    using NodeFactory = std::function<BTNodePtr(const std::string&)>;
+
+    /// <summary>
+    /// JSON ファイルから読み込み
+    /// </summary>
+    /// <param name="filepath">JSON ファイルのパス</param>
+    /// <returns>成功したら true</returns>
+    bool LoadFromFile(const std::string& filepath);
+
+    /// <summary>
+    /// パース済み JSON から読み込み（パラメータは JSON から move される）
+    /// </summary>
+    /// <param name="json">ツリー JSON</param>
+    /// <returns>成功したら true</returns>
+    bool LoadFromJSON(nlohmann::json& json);
+
+    /// <summary>
+    /// 定義のクリア
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// ランタイムのノードグラフを生成
+    /// </summary>
+    /// <param name="factory">ノード生成関数</param>
+    /// <param name="instances">生成したノードの出力先（ノードテーブルと同じ順序、未生成は nullptr。不要なら nullptr）</param>
+    /// <returns>ルートノード（失敗時は nullptr）</returns>
+    BTNodePtr Instantiate(const NodeFactory& factory, std::vector<BTNodePtr>* instances = nullptr) const;
+
+    /// <summary>
+    /// ノードテーブルの取得
+    /// </summary>
+    /// <returns>ノード定義の配列（ファイル内の順序）</returns>
+    const std::vector<NodeDef>& GetNodes() const { return nodes_; }
+
+    /// <summary>
+    /// 子ノードのインデックス列を取得
+    /// </summary>
+    /// <param name="index">親ノードのインデックス</param>
+    /// <returns>子ノードのインデックス列（リンクの記述順）</returns>
+    std::span<const uint32_t> GetChildren(uint32_t index) const {
+        const NodeDef& node = nodes_[index];
+        return std::span<const uint32_t>(children_.data() + node.childBegin, node.childCount);
+    }
+
+    /// <summary>
+    /// ルートノードのインデックスを取得
+    /// </summary>
+    /// <returns>ルートノードのインデックス（空なら kInvalidIndex）</returns>
+    uint32_t GetRootIndex() const { return rootIndex_; }
+
+    /// <summary>
+    /// ノード数の取得
+    /// </summary>
+    /// <returns>ノード数</returns>
+    size_t GetNodeCount() const { return nodes_.size(); }
+
+    /// <summary>
+    /// リンク数の取得
+    /// </summary>
+    /// <returns>有効なリンク数</returns>
+    size_t GetLinkCount() const { return children_.size(); }
+
+private:
+    /// <summary>
+    /// ノードを再帰的に生成
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <param name="factory">ノード生成関数</param>
+    /// <param name="visited">訪問済みフラグ（循環・重複参照の防止）</param>
+    /// <param name="instances">生成したノードの出力先（nullptr 可）</param>
+    /// <returns>生成したノード</returns>
+    BTNodePtr InstantiateRecursive(uint32_t index, const NodeFactory& factory,
+                                   std::vector<bool>& visited, std::vector<BTNodePtr>* instances) const;
+
+    // ノードテーブル（ファイル内の順序）
+    std::vector<NodeDef> nodes_;
+
+    // 子ノードの隣接リスト（各ノードの childBegin/childCount で参照）
+    std::vector<uint32_t> children_;
+
+    // ルートノードのインデックス
+    uint32_t rootIndex_ = kInvalidIndex;
+};
@@ -0,0 +1,200 @@
+#include "BTTreeHotReloader.h"
+#include "BTComposite.h"
+#include <unordered_set>
+#include <utility>
+
+BTTreeHotReloader::BTTreeHotReloader(std::string filepath, BTTreeDefinition::NodeFactory factory)
+    : filepath_(std::move(filepath)), factory_(std::move(factory)) {
+}
+
+bool BTTreeHotReloader::Load() {
+    lastPollTime_ = std::chrono::steady_clock::now();
+    BTBinaryTree::GetSourceStamp(filepath_, stamp_);
+
+    BTTreeDefinition definition;
+    if (!definition.LoadFromFile(filepath_)) {
+        return false;
+    }
+
+    std::vector<BTNodePtr> instances;
+    BTNodePtr root = definition.Instantiate(factory_, &instances);
+    if (!root) {
+        return false;
+    }
+
+    auto tree = std::make_shared<BTCompiledTree>();
+    if (!tree->Compile(root)) {
+        return false;
+    }
+
+    definition_ = std::move(definition);
+    instances_ = std::move(instances);
+    tree_ = std::move(tree);
+    ++generation_;
+    return true;
+}
+
+bool BTTreeHotReloader::CheckForChanges() {
+    // ファイルシステムへの問い合わせは一定間隔に抑える
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastPollTime_ < std::chrono::duration<float>(kPollInterval)) {
+        return false;
+    }
+    lastPollTime_ = now;
+
+    BTBinaryTree::SourceStamp stamp;
+    if (!HasSourceChanged(stamp)) {
+        return false;
+    }
+
+    // 書き込み途中などで読めなかった場合も同じ内容を繰り返し解析しないよう識別情報は更新する
+    stamp_ = stamp;
+    return Reload();
+}
+
+bool BTTreeHotReloader::HasSourceChanged(BTBinaryTree::SourceStamp& stamp) const {
+    if (!BTBinaryTree::GetSourceStamp(filepath_, stamp)) {
+        return false;
+    }
+    return stamp.size != stamp_.size || stamp.writeTime != stamp_.writeTime;
+}
+
+bool BTTreeHotReloader::Reload() {
+    if (!tree_) {
+        return Load();
+    }
+
+    BTTreeDefinition definition;
+    if (!definition.LoadFromFile(filepath_) || definition.GetRootIndex() == BTTreeDefinition::kInvalidIndex) {
+        return false;
+    }
+
+    // 以前の定義の ID → インデックス
+    const auto& previousNodes = definition_.GetNodes();
+    std::unordered_map<int, uint32_t> previousIndices;
+    previousIndices.reserve(previousNodes.size());
+    for (uint32_t i = 0; i < previousNodes.size(); ++i) {
+        previousIndices.emplace(previousNodes[i].id, i);
+    }
+
+    ReloadStats stats;
+    std::vector<bool> visited(definition.GetNodeCount(), false);
+    std::vector<BTNodePtr> instances(definition.GetNodeCount());
+    BTNodePtr root = ResolveRecursive(definition, definition.GetRootIndex(), previousIndices,
+                                      visited, instances, stats);
+    if (!root) {
+        // ルートのタイプが生成できない定義は反映しない
+        return false;
+    }
+
+    // ツリーから外れたノード（以前のツリーは古いコンパイル結果が所有し続ける）
+    std::unordered_set<const BTNode*> alive;
+    alive.reserve(instances.size());
+    for (const BTNodePtr& node : instances) {
+        if (node) {
+            alive.insert(node.get());
+        }
+    }
+    for (const BTNodePtr& node : instances_) {
+        if (node && !alive.contains(node.get())) {
+            ++stats.removedNodes;
+        }
+    }
+
+    // 子の付け替え・ルートの差し替えがあった場合だけコンパイルし直す
+    // パラメータ・表示名の変更はノードに直接適用済みなので、ツリーはそのまま使える
+    if (stats.relinkedNodes > 0 || root != tree_->GetRoot()) {
+        auto tree = std::make_shared<BTCompiledTree>();
+        if (!tree->Compile(root)) {
+            return false;
+        }
+        tree_ = std::move(tree);
+        ++generation_;
+        stats.recompiled = true;
+    }
+
+    definition_ = std::move(definition);
+    instances_ = std::move(instances);
+    lastStats_ = stats;
+    ++reloadCount_;
+    return true;
+}
+
+BTNodePtr BTTreeHotReloader::ResolveRecursive(const BTTreeDefinition& definition, uint32_t index,
+                                              const std::unordered_map<int, uint32_t>& previousIndices,
+                                              std::vector<bool>& visited, std::vector<BTNodePtr>& instances,
+                                              ReloadStats& stats) {
+    // 循環参照・重複参照を防ぐ
+    if (visited[index]) {
+        return nullptr;
+    }
+    visited[index] = true;
+
+    BTNodePtr node = ResolveNode(definition.GetNodes()[index], previousIndices, stats);
+    if (!node) {
+        return nullptr;
+    }
+    instances[index] = node;
+
+    if (!node->IsComposite()) {
+        return node;
+    }
+
+    std::vector<BTNodePtr> children;
+    children.reserve(definition.GetNodes()[index].childCount);
+    for (uint32_t childIndex : definition.GetChildren(index)) {
+        BTNodePtr childNode = ResolveRecursive(definition, childIndex, previousIndices, visited, instances, stats);
+        if (childNode) {
+            children.push_back(std::move(childNode));
+        }
+    }
+
+    // 子の並びが変わったコンポジットだけ付け替える
+    auto* composite = static_cast<BTComposite*>(node.get());
+    if (composite->GetChildren() != children) {
+        composite->ClearChildren();
+        for (BTNodePtr& child : children) {
+            composite->AddChild(std::move(child));
+        }
+        ++stats.relinkedNodes;
+    }
+
+    return node;
+}
+
+BTNodePtr BTTreeHotReloader::ResolveNode(const BTTreeDefinition::NodeDef& def,
+                                         const std::unordered_map<int, uint32_t>& previousIndices,
+                                         ReloadStats& stats) {
+    auto it = previousIndices.find(def.id);
+    if (it != previousIndices.end() && instances_[it->second]) {
+        const BTTreeDefinition::NodeDef& previous = definition_.GetNodes()[it->second];
+        if (previous.type == def.type) {
+            // 同じノードを使い続け、変わった値だけ適用する
+            // （JSON から消えたパラメータは既定値に戻さず、現在の値を維持する）
+            const BTNodePtr& node = instances_[it->second];
+            if (!def.parameters.is_null() && def.parameters != previous.parameters) {
+                node->ApplyParameters(def.parameters);
+                ++stats.updatedNodes;
+            }
+            if (def.hasDisplayName && (!previous.hasDisplayName || def.displayName != previous.displayName)) {
+                node->SetName(def.displayName);
+                ++stats.renamedNodes;
+            }
+            return node;
+        }
+    }
+
+    // 新しい ID・タイプが変わったノードは生成し直す
+    BTNodePtr node = factory_(def.type);
+    if (!node) {
+        return nullptr;
+    }
+    if (!def.parameters.is_null()) {
+        node->ApplyParameters(def.parameters);
+    }
+    if (def.hasDisplayName) {
+        node->SetName(def.displayName);
+    }
+    ++stats.createdNodes;
+    return node;
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "BTNode.h"
+#include "BTTreeDefinition.h"
+#include "BTCompiledTree.h"
+#include "BTBinaryTree.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// ツリー JSON のホットリロード
+/// ファイルの更新を監視し、新しい定義を現在のノードグラフと ID で突き合わせて差分だけを反映する
+/// ・同じ ID・同じタイプのノードは作り直さず、パラメータと表示名だけを適用する
+/// ・子の並びが変わったコンポジットだけ子を付け替え、新しい ID・タイプが変わったノードだけ生成する
+/// 構造が変わった場合のみツリーをコンパイルし直して世代を進めるので、
+/// 利用側は世代の変化を見て BTCompiledTree::MigrateState で実行状態を引き継ぐ
+/// ノードを直接書き換えるため、メインスレッドで評価の合間に呼ぶこと
+/// </summary>
+class BTTreeHotReloader {
+public:
+    /// <summary>
+    /// 更新を確認する間隔（秒）
+    /// </summary>
+    static constexpr float kPollInterval = 0.5f;
+
+    /// <summary>
+    /// 直近のリロードで反映した差分
+    /// </summary>
+    struct ReloadStats {
+        uint32_t updatedNodes = 0;     // パラメータを適用したノード数
+        uint32_t renamedNodes = 0;     // 表示名を変えたノード数
+        uint32_t createdNodes = 0;     // 新しく生成したノード数
+        uint32_t removedNodes = 0;     // ツリーから外れたノード数
+        uint32_t relinkedNodes = 0;    // 子を付け替えたコンポジット数
+        bool recompiled = false;       // ツリーをコンパイルし直したか
+    };
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="filepath">監視する JSON ファイルのパス</param>
+    /// <param name="factory">ノード生成関数</param>
+    BTTreeHotReloader(std::string filepath, BTTreeDefinition::NodeFactory factory);
+
+    /// <summary>
+    /// ファイルからツリー全体を生成（初回読み込み）
+    /// </summary>
+    /// <returns>成功したら true</returns>
+    bool Load();
+
+    /// <summary>
+    /// 一定間隔でファイルの更新を確認し、更新されていれば差分を反映
+    /// </summary>
+    /// <returns>リロードを行ったら true</returns>
+    bool CheckForChanges();
+
+    /// <summary>
+    /// ファイルを読み直して現在のノードグラフに差分を反映
+    /// 読み込みに失敗した場合は現在のツリーをそのまま使い続ける
+    /// </summary>
+    /// <returns>成功したら true</returns>
+    bool Reload();
+
+    /// <summary>
+    /// 現在のコンパイル済みツリーを取得
+    /// </summary>
+    /// <returns>コンパイル済みツリー</returns>
+    const std::shared_ptr<const BTCompiledTree>& GetTree() const { return tree_; }
+
+    /// <summary>
+    /// ツリーの世代（コンパイルし直すたびに進む）
+    /// </summary>
+    /// <returns>世代</returns>
+    uint32_t GetGeneration() const { return generation_; }
+
+    /// <summary>
+    /// 直近のリロードで反映した差分を取得
+    /// </summary>
+    /// <returns>差分の統計</returns>
+    const ReloadStats& GetLastStats() const { return lastStats_; }
+
+    /// <summary>
+    /// リロードした回数
+    /// </summary>
+    /// <returns>回数</returns>
+    uint32_t GetReloadCount() const { return reloadCount_; }
+
+    /// <summary>
+    /// 監視中のファイルパスを取得
+    /// </summary>
+    /// <returns>ファイルパス</returns>
+    const std::string& GetFilePath() const { return filepath_; }
+
+private:
+    /// <summary>
+    /// 新しい定義のノードを現在のノードに対応付けて再帰的に解決
+    /// （InstantiateRecursive と同じ順序・重複参照の扱いで子を付け替える）
+    /// </summary>
+    /// <param name="definition">新しい定義</param>
+    /// <param name="index">ノードインデックス</param>
+    /// <param name="previousIndices">以前の定義の ID → インデックス</param>
+    /// <param name="visited">訪問済みフラグ</param>
+    /// <param name="instances">解決したノードの出力先</param>
+    /// <param name="stats">差分の統計</param>
+    /// <returns>解決したノード</returns>
+    BTNodePtr ResolveRecursive(const BTTreeDefinition& definition, uint32_t index,
+                               const std::unordered_map<int, uint32_t>& previousIndices,
+                               std::vector<bool>& visited, std::vector<BTNodePtr>& instances,
+                               ReloadStats& stats);
+
+    /// <summary>
+    /// ノード1つを既存のノードの再利用か新規生成で解決し、変わったパラメータ・表示名を適用
+    /// </summary>
+    /// <param name="def">新しいノード定義</param>
+    /// <param name="previousIndices">以前の定義の ID → インデックス</param>
+    /// <param name="stats">差分の統計</param>
+    /// <returns>ノード（生成できなければ nullptr）</returns>
+    BTNodePtr ResolveNode(const BTTreeDefinition::NodeDef& def,
+                          const std::unordered_map<int, uint32_t>& previousIndices, ReloadStats& stats);
+
+    /// <summary>
+    /// ファイルの識別情報が前回の読み込み時から変わったか
+    /// </summary>
+    /// <param name="stamp">現在の識別情報の出力先</param>
+    /// <returns>変わっていれば true</returns>
+    bool HasSourceChanged(BTBinaryTree::SourceStamp& stamp) const;
+
+    // 監視するファイルとノード生成関数
+    std::string filepath_;
+    BTTreeDefinition::NodeFactory factory_;
+
+    // 現在の定義と、定義のノードテーブル順に並べた生成済みノード
+    BTTreeDefinition definition_;
+    std::vector<BTNodePtr> instances_;
+
+    // 現在のコンパイル済みツリーと世代
+    std::shared_ptr<const BTCompiledTree> tree_;
+    uint32_t generation_ = 0;
+
+    // 前回読み込んだファイルの識別情報と、最後に確認した時刻
+    BTBinaryTree::SourceStamp stamp_;
+    std::chrono::steady_clock::time_point lastPollTime_{};
+
+    // 直近のリロード結果
+    ReloadStats lastStats_;
+    uint32_t reloadCount_ = 0;
+};
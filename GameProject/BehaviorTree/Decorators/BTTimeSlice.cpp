@@ -0,0 +1,83 @@
+#include "BTTimeSlice.h"
+#include "../Core/BTProfiler.h"
+#include <algorithm>
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+BTTimeSlice::BTTimeSlice() {
+    name_ = "TimeSlice";
+}
+
+BTNodeStatus BTTimeSlice::Execute(BTBlackboard* blackboard) {
+    if (children_.empty()) {
+        status_ = BTNodeStatus::Failure;
+        return status_;
+    }
+
+    // 間隔内は前回の結果を返し、子の部分木を評価しない
+    BTNodeStatus cachedStatus;
+    if (TryGetCachedStatus(blackboard, cachedStatus)) {
+        status_ = cachedStatus;
+        return status_;
+    }
+
+    currentChildIndex_ = 0;
+    status_ = BTExecuteNode(children_[0].get(), blackboard);
+    StoreStatus(blackboard, status_);
+    return status_;
+}
+
+bool BTTimeSlice::TryGetCachedStatus(BTBlackboard* blackboard, BTNodeStatus& status) const {
+    const BTTimeSliceState* state = GetState(blackboard);
+    // 実行中の子は止めずに毎フレーム進める
+    if (!state || !state->valid || state->status == BTNodeStatus::Running) {
+        return false;
+    }
+    if (blackboard->GetFrame() - state->lastFrame >= intervalFrames_) {
+        return false;
+    }
+    status = state->status;
+    return true;
+}
+
+void BTTimeSlice::StoreStatus(BTBlackboard* blackboard, BTNodeStatus status) const {
+    BTTimeSliceState* state = GetState(blackboard);
+    if (!state) {
+        return;
+    }
+    state->lastFrame = blackboard->GetFrame();
+    state->status = status;
+    state->valid = true;
+}
+
+void BTTimeSlice::ApplyParameters(const BTParameters& params) {
+    if (params.contains("intervalFrames")) {
+        intervalFrames_ = std::max(params["intervalFrames"].get<uint32_t>(), 1u);
+    }
+}
+
+nlohmann::json BTTimeSlice::ExtractParameters() const {
+    return {
+        {"intervalFrames", intervalFrames_}
+    };
+}
+
+#ifdef _DEBUG
+bool BTTimeSlice::DrawImGui() {
+    bool changed = false;
+
+    // 評価間隔の編集
+    int interval = static_cast<int>(intervalFrames_);
+    if (ImGui::DragInt("Interval Frames##slice", &interval, 1, 1, 120)) {
+        intervalFrames_ = static_cast<uint32_t>(std::max(interval, 1));
+        changed = true;
+    }
+
+    // 補助テキスト
+    ImGui::TextDisabled("Child evaluated every %u frame(s)", intervalFrames_);
+
+    return changed;
+}
+#endif
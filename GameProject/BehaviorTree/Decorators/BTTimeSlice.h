@@ -0,0 +1,86 @@
+#pragma once
+#include "../Core/BTComposite.h"
+#include "../Core/BTStatefulNode.h"
+#include <cstdint>
+
+/// <summary>
+/// タイムスライスデコレーターのエージェントごとの状態
+/// ツリーの完了をまたいで保持する
+/// </summary>
+struct BTTimeSliceState {
+    uint64_t lastFrame = 0;                         // 子を最後に評価したフレーム（BTBlackboard::GetFrame）
+    BTNodeStatus status = BTNodeStatus::Failure;    // 子の最後の結果
+    bool valid = false;                             // 結果を保持しているか
+};
+
+/// <summary>
+/// タイムスライスデコレーター
+/// 重い部分木の評価を N フレームに1回へ間引き、間のフレームは前回の結果を返す
+/// 子が Running の間は毎フレーム評価する（子は1つ目のみ使用）
+/// </summary>
+class BTTimeSlice : public BTStatefulNode<BTTimeSliceState, BTComposite> {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    BTTimeSlice();
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    virtual ~BTTimeSlice() = default;
+
+    /// <summary>
+    /// ノードの実行
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus Execute(BTBlackboard* blackboard) override;
+
+    /// <summary>
+    /// 間引きの記録はツリーの完了後も使えるよう保持する
+    /// </summary>
+    /// <returns>true</returns>
+    bool IsStatePersistent() const override { return true; }
+
+    /// <summary>
+    /// 間隔内であれば前回の子の結果を取得
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="status">前回の結果の出力先</param>
+    /// <returns>前回の結果を使えるなら true（子を評価する必要がなければ true）</returns>
+    bool TryGetCachedStatus(BTBlackboard* blackboard, BTNodeStatus& status) const;
+
+    /// <summary>
+    /// 子を評価した結果を記録
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="status">子の結果</param>
+    void StoreStatus(BTBlackboard* blackboard, BTNodeStatus status) const;
+
+    /// <summary>
+    /// パラメータを適用
+    /// </summary>
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override;
+
+    /// <summary>
+    /// パラメータを JSON として抽出
+    /// </summary>
+    nlohmann::json ExtractParameters() const override;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// ImGui でパラメータ編集 UI を描画
+    /// </summary>
+    bool DrawImGui() override;
+#endif
+
+    // Getters/Setters
+    uint32_t GetIntervalFrames() const { return intervalFrames_; }
+    void SetIntervalFrames(uint32_t frames) { intervalFrames_ = frames; }
+
+private:
+    // 子を評価する間隔（フレーム、1 なら毎フレーム）
+    uint32_t intervalFrames_ = 4;
+};
@@ -0,0 +1,252 @@
+#include "BakedCameraTrack.h"
+#include "Vec3Func.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+using namespace Tako;
+
+namespace {
+    constexpr float kUnsignedSteps = static_cast<float>(std::numeric_limits<uint16_t>::max());
+
+    /// <summary>
+    /// オイラー角の各成分の差の最大値（ラジアン）
+    /// </summary>
+    float RotationError(const Vector3& a, const Vector3& b) {
+        return std::max({ std::abs(a.x - b.x), std::abs(a.y - b.y), std::abs(a.z - b.z) });
+    }
+
+    /// <summary>
+    /// 角度を 2π の倍数だけずらして、基準の角度に最も近い値にする
+    /// </summary>
+    float UnwrapAngle(float angle, float reference) {
+        constexpr float kTwoPi = 2.0f * std::numbers::pi_v<float>;
+        return angle + kTwoPi * std::round((reference - angle) / kTwoPi);
+    }
+}
+
+/// <summary>
+/// 一定間隔のサンプルからトラックを作成
+/// </summary>
+bool BakedCameraTrack::Build(const std::vector<Sample>& sourceSamples, const BakeSettings& settings) {
+    Clear();
+    if (sourceSamples.size() < 2 || settings.sampleRate <= 0.0f) {
+        return false;
+    }
+    sampleRate_ = settings.sampleRate;
+
+    // オイラー角を直接補間するので、±π をまたぐところで逆回りしないよう前のサンプルに連続させる
+    std::vector<Sample> samples = sourceSamples;
+    for (size_t i = 1; i < samples.size(); ++i) {
+        const Vector3& previous = samples[i - 1].rotation;
+        Vector3& rotation = samples[i].rotation;
+        rotation = { UnwrapAngle(rotation.x, previous.x), UnwrapAngle(rotation.y, previous.y), UnwrapAngle(rotation.z, previous.z) };
+    }
+
+    // 先頭から、間のサンプルを誤差の範囲内で補間できる限り遠くのサンプルまでを1区間にする
+    std::vector<uint32_t> selected;
+    selected.push_back(0);
+    size_t start = 0;
+    while (start + 1 < samples.size()) {
+        size_t end = start + 1;
+        if (settings.reduceKeys) {
+            while (end + 1 < samples.size() && IsWithinTolerance(samples, start, end + 1, settings)) {
+                ++end;
+            }
+        }
+        selected.push_back(static_cast<uint32_t>(end));
+        start = end;
+    }
+
+    keyFrames_ = selected;
+    keyCursor_ = 0;
+
+    isQuantized_ = settings.quantize;
+    if (isQuantized_) {
+        // 残ったキーの範囲で量子化の段階を決める
+        Vector3 positionMax = samples[selected[0]].position;
+        Vector3 rotationMax = samples[selected[0]].rotation;
+        positionMin_ = positionMax;
+        rotationMin_ = rotationMax;
+        fovMin_ = samples[selected[0]].fov;
+        float fovMax = fovMin_;
+        for (uint32_t index : selected) {
+            const Sample& sample = samples[index];
+            positionMin_ = { std::min(positionMin_.x, sample.position.x), std::min(positionMin_.y, sample.position.y), std::min(positionMin_.z, sample.position.z) };
+            positionMax = { std::max(positionMax.x, sample.position.x), std::max(positionMax.y, sample.position.y), std::max(positionMax.z, sample.position.z) };
+            rotationMin_ = { std::min(rotationMin_.x, sample.rotation.x), std::min(rotationMin_.y, sample.rotation.y), std::min(rotationMin_.z, sample.rotation.z) };
+            rotationMax = { std::max(rotationMax.x, sample.rotation.x), std::max(rotationMax.y, sample.rotation.y), std::max(rotationMax.z, sample.rotation.z) };
+            fovMin_ = std::min(fovMin_, sample.fov);
+            fovMax = std::max(fovMax, sample.fov);
+        }
+        positionScale_ = (positionMax - positionMin_) / kUnsignedSteps;
+        rotationScale_ = (rotationMax - rotationMin_) / kUnsignedSteps;
+        fovScale_ = (fovMax - fovMin_) / kUnsignedSteps;
+
+        quantizedKeys_.reserve(selected.size());
+        coordinateTypes_.reserve(selected.size());
+        for (uint32_t index : selected) {
+            quantizedKeys_.push_back(Quantize(samples[index]));
+            coordinateTypes_.push_back(samples[index].coordinateType);
+        }
+    }
+    else {
+        keys_.reserve(selected.size());
+        for (uint32_t index : selected) {
+            keys_.push_back(samples[index]);
+        }
+    }
+
+    // 全サンプルの時刻で再生した結果と比べて誤差を記録
+    stats_.sampleCount = static_cast<uint32_t>(samples.size());
+    stats_.keyCount = static_cast<uint32_t>(keyFrames_.size());
+    stats_.byteSize = keyFrames_.size() * sizeof(uint32_t) +
+        (isQuantized_ ? quantizedKeys_.size() * (sizeof(QuantizedKey) + sizeof(CameraKeyframe::CoordinateType)) : keys_.size() * sizeof(Sample));
+    for (size_t i = 0; i < samples.size(); ++i) {
+        Sample baked = Evaluate(static_cast<float>(i) / sampleRate_);
+        stats_.maxPositionError = std::max(stats_.maxPositionError, Vec3::Length(baked.position - samples[i].position));
+        stats_.maxRotationError = std::max(stats_.maxRotationError, RotationError(baked.rotation, samples[i].rotation));
+        stats_.maxFovError = std::max(stats_.maxFovError, std::abs(baked.fov - samples[i].fov));
+    }
+    return true;
+}
+
+/// <summary>
+/// トラックを破棄
+/// </summary>
+void BakedCameraTrack::Clear() {
+    keyFrames_.clear();
+    keys_.clear();
+    quantizedKeys_.clear();
+    coordinateTypes_.clear();
+    isQuantized_ = false;
+    keyCursor_ = 0;
+    stats_ = {};
+}
+
+/// <summary>
+/// 指定時刻の状態を求める
+/// </summary>
+BakedCameraTrack::Sample BakedCameraTrack::Evaluate(float time) const {
+    if (keyFrames_.empty()) {
+        return {};
+    }
+
+    float frame = std::clamp(time * sampleRate_, 0.0f, static_cast<float>(keyFrames_.back()));
+    size_t index = FindKey(frame);
+
+    // 前後のキーの間を線形補間
+    float span = static_cast<float>(keyFrames_[index + 1] - keyFrames_[index]);
+    float t = (frame - static_cast<float>(keyFrames_[index])) / span;
+    if (isQuantized_) {
+        return Interpolate(Dequantize(quantizedKeys_[index], coordinateTypes_[index]),
+            Dequantize(quantizedKeys_[index + 1], coordinateTypes_[index + 1]), t);
+    }
+    return Interpolate(keys_[index], keys_[index + 1], t);
+}
+
+/// <summary>
+/// フレーム位置を含むキーの区間を探す
+/// </summary>
+size_t BakedCameraTrack::FindKey(float frame) const {
+    // 区間 i はキー i から i + 1 まで（最後のフレームは最後の区間の終端として扱う）
+    const size_t spanCount = keyFrames_.size() - 1;
+    auto isInSpan = [&](size_t i) {
+        return static_cast<float>(keyFrames_[i]) <= frame && (i + 1 == spanCount || frame < static_cast<float>(keyFrames_[i + 1]));
+    };
+
+    // 再生中は前回の区間の近くにいることがほとんどなので、まずカーソルを前後に動かして探す
+    size_t cursor = std::min(keyCursor_, spanCount - 1);
+    for (int step = 0; step < CameraConfig::Animation::KEYFRAME_CURSOR_SEARCH_LIMIT && !isInSpan(cursor); ++step) {
+        cursor = (static_cast<float>(keyFrames_[cursor]) > frame) ? cursor - 1 : cursor + 1;
+    }
+
+    // 離れている場合は二分探索
+    if (!isInSpan(cursor)) {
+        auto it = std::upper_bound(keyFrames_.begin(), keyFrames_.begin() + spanCount, frame,
+            [](float f, uint32_t keyFrame) {
+                return f < static_cast<float>(keyFrame);
+            });
+        cursor = (it == keyFrames_.begin()) ? 0 : static_cast<size_t>(it - keyFrames_.begin()) - 1;
+    }
+    keyCursor_ = cursor;
+    return cursor;
+}
+
+/// <summary>
+/// サンプル a から b までを線形補間したとき、間のサンプルがすべて誤差の範囲内か
+/// </summary>
+bool BakedCameraTrack::IsWithinTolerance(const std::vector<Sample>& samples, size_t a, size_t b, const BakeSettings& settings) {
+    const Sample& first = samples[a];
+    const Sample& last = samples[b];
+
+    const float span = static_cast<float>(b - a);
+    for (size_t i = a + 1; i < b; ++i) {
+        // 座標系タイプが変わるサンプルは必ずキーにする
+        const Sample& sample = samples[i];
+        if (sample.coordinateType != first.coordinateType) {
+            return false;
+        }
+
+        Sample interpolated = Interpolate(first, last, static_cast<float>(i - a) / span);
+        if (Vec3::Length(interpolated.position - sample.position) > settings.positionTolerance ||
+            std::abs(interpolated.fov - sample.fov) > settings.fovTolerance ||
+            RotationError(interpolated.rotation, sample.rotation) > settings.rotationTolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// <summary>
+/// 2つのサンプルを補間
+/// </summary>
+BakedCameraTrack::Sample BakedCameraTrack::Interpolate(const Sample& a, const Sample& b, float t) {
+    Sample result;
+    result.position = a.position + (b.position - a.position) * t;
+    result.rotation = a.rotation + (b.rotation - a.rotation) * t;
+    result.fov = a.fov + (b.fov - a.fov) * t;
+    result.coordinateType = a.coordinateType;
+    return result;
+}
+
+/// <summary>
+/// キーを量子化
+/// </summary>
+BakedCameraTrack::QuantizedKey BakedCameraTrack::Quantize(const Sample& sample) const {
+    auto toUnsigned = [](float value, float min, float scale) {
+        return static_cast<uint16_t>(scale > 0.0f ? std::lround(std::clamp((value - min) / scale, 0.0f, kUnsignedSteps)) : 0);
+    };
+
+    QuantizedKey key;
+    key.position[0] = toUnsigned(sample.position.x, positionMin_.x, positionScale_.x);
+    key.position[1] = toUnsigned(sample.position.y, positionMin_.y, positionScale_.y);
+    key.position[2] = toUnsigned(sample.position.z, positionMin_.z, positionScale_.z);
+    key.rotation[0] = toUnsigned(sample.rotation.x, rotationMin_.x, rotationScale_.x);
+    key.rotation[1] = toUnsigned(sample.rotation.y, rotationMin_.y, rotationScale_.y);
+    key.rotation[2] = toUnsigned(sample.rotation.z, rotationMin_.z, rotationScale_.z);
+    key.fov = toUnsigned(sample.fov, fovMin_, fovScale_);
+    return key;
+}
+
+/// <summary>
+/// キーを復元
+/// </summary>
+BakedCameraTrack::Sample BakedCameraTrack::Dequantize(const QuantizedKey& key, CameraKeyframe::CoordinateType coordinateType) const {
+    Sample sample;
+    sample.position = {
+        positionMin_.x + key.position[0] * positionScale_.x,
+        positionMin_.y + key.position[1] * positionScale_.y,
+        positionMin_.z + key.position[2] * positionScale_.z
+    };
+    sample.rotation = {
+        rotationMin_.x + key.rotation[0] * rotationScale_.x,
+        rotationMin_.y + key.rotation[1] * rotationScale_.y,
+        rotationMin_.z + key.rotation[2] * rotationScale_.z
+    };
+    sample.fov = fovMin_ + key.fov * fovScale_;
+    sample.coordinateType = coordinateType;
+    return sample;
+}
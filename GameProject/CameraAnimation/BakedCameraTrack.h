@@ -0,0 +1,142 @@
+#pragma once
+#include "CameraKeyframe.h"
+#include "CameraSystem/CameraConfig.h"
+#include "Vector3.h"
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// カメラアニメーションを一定間隔でサンプリングして詰めたトラック
+/// 出荷用のカットシーンで、キーフレーム・イージング・区間の評価を毎フレーム行う代わりに使う
+/// 線形補間で誤差の範囲内に収まるサンプルは削除し、残ったキーの間を線形補間して再生する
+/// 再生時は前回の区間の近くからキーの区間を探し、離れていればキーのサンプル番号を二分探索する
+/// 回転はカメラに適用するオイラー角のままキーに持ち、再生時に三角関数を使わない
+/// </summary>
+class BakedCameraTrack {
+public:
+    /// <summary>
+    /// カメラの状態（位置は座標系タイプに応じてワールド座標またはターゲットからのオフセット）
+    /// </summary>
+    struct Sample {
+        Tako::Vector3 position;                 ///< 位置
+        Tako::Vector3 rotation;                 ///< 回転（オイラー角、ラジアン）
+        float fov = 0.0f;                       ///< 視野角（ラジアン）
+        CameraKeyframe::CoordinateType coordinateType = CameraKeyframe::CoordinateType::WORLD;  ///< 座標系タイプ
+    };
+
+    /// <summary>
+    /// ベイク設定
+    /// </summary>
+    struct BakeSettings {
+        float sampleRate = CameraConfig::Animation::BAKE_SAMPLE_RATE;                ///< サンプリングレート（Hz）
+        bool reduceKeys = true;                                                      ///< 誤差の範囲内で補間できるサンプルを削除するか
+        float positionTolerance = CameraConfig::Animation::BAKE_POSITION_TOLERANCE;  ///< キー削減で許す位置の誤差
+        float rotationTolerance = CameraConfig::Animation::BAKE_ROTATION_TOLERANCE;  ///< キー削減で許すオイラー角の各成分の誤差（ラジアン）
+        float fovTolerance = CameraConfig::Animation::BAKE_FOV_TOLERANCE;            ///< キー削減で許す FOV の誤差（ラジアン）
+        bool quantize = false;                                                       ///< キーを 16 ビットに量子化するか
+    };
+
+    /// <summary>
+    /// 統計
+    /// </summary>
+    struct Stats {
+        uint32_t sampleCount = 0;       ///< サンプリングした数
+        uint32_t keyCount = 0;          ///< 削減後のキー数
+        size_t byteSize = 0;            ///< キーのデータの大きさ（バイト）
+        float maxPositionError = 0.0f;  ///< 全サンプルに対する位置の最大誤差
+        float maxRotationError = 0.0f;  ///< 全サンプルに対するオイラー角の各成分の最大誤差（ラジアン）
+        float maxFovError = 0.0f;       ///< 全サンプルに対する FOV の最大誤差（ラジアン）
+    };
+
+    /// <summary>
+    /// 一定間隔のサンプルからトラックを作成
+    /// </summary>
+    /// <param name="samples">時刻 0 から 1 / sampleRate 間隔のサンプル（2つ以上。オイラー角は隣のサンプルと連続するように 2π の倍数をずらす）</param>
+    /// <param name="settings">ベイク設定</param>
+    /// <returns>作成できたか</returns>
+    bool Build(const std::vector<Sample>& samples, const BakeSettings& settings);
+
+    /// <summary>
+    /// トラックを破棄
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 指定時刻の状態を求める
+    /// 時刻を含むキーの区間を探し、前後のキーを線形補間するだけで済ませる
+    /// </summary>
+    /// <param name="time">時刻（秒。範囲外は両端のキーになる）</param>
+    /// <returns>カメラの状態</returns>
+    Sample Evaluate(float time) const;
+
+    //-----------------------------------------Getter-----------------------------------------//
+
+    /// <summary>
+    /// トラックがあるか
+    /// </summary>
+    [[nodiscard]] bool IsValid() const { return !keyFrames_.empty(); }
+
+    /// <summary>
+    /// 量子化しているか
+    /// </summary>
+    [[nodiscard]] bool IsQuantized() const { return isQuantized_; }
+
+    /// <summary>
+    /// サンプリングレートを取得
+    /// </summary>
+    [[nodiscard]] float GetSampleRate() const { return sampleRate_; }
+
+    /// <summary>
+    /// 統計を取得
+    /// </summary>
+    [[nodiscard]] const Stats& GetStats() const { return stats_; }
+
+private:
+    /// <summary>
+    /// 量子化したキー（位置・回転・FOV とも、トラック全体の範囲に対する符号なし 16 ビット）
+    /// </summary>
+    struct QuantizedKey {
+        uint16_t position[3];
+        uint16_t rotation[3];
+        uint16_t fov;
+    };
+
+    /// <summary>
+    /// サンプル a から b までを線形補間したとき、間のサンプルがすべて誤差の範囲内か
+    /// </summary>
+    static bool IsWithinTolerance(const std::vector<Sample>& samples, size_t a, size_t b, const BakeSettings& settings);
+
+    /// <summary>
+    /// 2つのサンプルを補間（座標系タイプは a に合わせる）
+    /// </summary>
+    static Sample Interpolate(const Sample& a, const Sample& b, float t);
+
+    /// <summary>
+    /// キーを量子化 / 復元
+    /// </summary>
+    QuantizedKey Quantize(const Sample& sample) const;
+    Sample Dequantize(const QuantizedKey& key, CameraKeyframe::CoordinateType coordinateType) const;
+
+    /// <summary>
+    /// フレーム位置を含むキーの区間を探す（前回の区間の隣から探し、離れていれば二分探索）
+    /// </summary>
+    size_t FindKey(float frame) const;
+
+    std::vector<uint32_t> keyFrames_;                            ///< キーのサンプル番号（昇順）
+    std::vector<Sample> keys_;                                   ///< キー（量子化しない場合）
+    std::vector<QuantizedKey> quantizedKeys_;                    ///< キー（量子化する場合）
+    std::vector<CameraKeyframe::CoordinateType> coordinateTypes_; ///< キーごとの座標系タイプ（量子化する場合）
+
+    // 量子化の範囲
+    Tako::Vector3 positionMin_;                                  ///< 位置の最小値
+    Tako::Vector3 positionScale_;                                ///< 位置の 1 段階の大きさ
+    Tako::Vector3 rotationMin_;                                  ///< 回転の最小値
+    Tako::Vector3 rotationScale_;                                ///< 回転の 1 段階の大きさ
+    float fovMin_ = 0.0f;                                        ///< FOV の最小値
+    float fovScale_ = 0.0f;                                      ///< FOV の 1 段階の大きさ
+
+    float sampleRate_ = CameraConfig::Animation::BAKE_SAMPLE_RATE;  ///< サンプリングレート（Hz）
+    bool isQuantized_ = false;                                   ///< 量子化しているか
+    mutable size_t keyCursor_ = 0;                               ///< 直前に見つけた区間の前のキー
+    Stats stats_;                                                ///< 統計
+};
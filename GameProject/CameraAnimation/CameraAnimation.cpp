@@ -1,6 +1,8 @@
 #include "CameraAnimation.h"
 #include "Vec3Func.h"
 #include "QuatFunc.h"
+#include "CameraPoseMath.h"
+#include "CameraAnimationBinary.h"
 #include "CameraSystem/CameraConfig.h"
 
 #include <algorithm>
@@ -18,6 +20,35 @@
 
 using namespace Tako;
 
+namespace {
+    constexpr float kClosedPathEpsilon = 1e-4f;     // 最初と最後のキーフレームを同じ位置とみなす距離
+    constexpr float kKnotIntervalEpsilon = 1e-4f;   // これより短いノット間隔は隣の区間の値で置き換える
+
+    /// <summary>
+    /// 経路の種類と JSON の文字列の変換
+    /// </summary>
+    const char* PathTypeToString(CameraAnimation::PathType type) {
+        switch (type) {
+        case CameraAnimation::PathType::CATMULL_ROM:
+            return "CATMULL_ROM";
+        case CameraAnimation::PathType::CENTRIPETAL:
+            return "CENTRIPETAL";
+        default:
+            return "LINEAR";
+        }
+    }
+
+    CameraAnimation::PathType PathTypeFromString(const std::string& str) {
+        if (str == "CATMULL_ROM") {
+            return CameraAnimation::PathType::CATMULL_ROM;
+        }
+        if (str == "CENTRIPETAL") {
+            return CameraAnimation::PathType::CENTRIPETAL;
+        }
+        return CameraAnimation::PathType::LINEAR; // デフォルト
+    }
+}
+
 /// <summary>
 /// コンストラクタ
 /// </summary>
@@ -72,10 +103,8 @@ void CameraAnimation::Update(float deltaTime) {
             }
             Vector3 position = Vec3::Lerp(blendStartPosition_, targetPosition, t);
 
-            // 回転の補間（クォータニオンで Slerp）
-            Quaternion q1 = EulerToQuaternion(blendStartRotation_);
-            Quaternion q2 = EulerToQuaternion(firstKf.rotation);
-            Quaternion qResult = Quat::Slerp(q1, q2, t);
+            // 回転の補間（開始時と最初のキーフレームのクォータニオンは作成済み）
+            Quaternion qResult = CameraPoseMath::Nlerp(blendStartQuaternion_, segments_[0].rotationStart, t);
             Vector3 rotation = QuaternionToEuler(qResult);
 
             // FOV の補間
@@ -135,44 +164,33 @@ void CameraAnimation::Update(float deltaTime) {
         }
     }
 
-    // キーフレーム間の補間を実行
-    size_t prevIndex = 0, nextIndex = 0;
-    if (FindKeyframeIndices(currentTime_, prevIndex, nextIndex)) {
-        const CameraKeyframe& prev = keyframes_[prevIndex];
-        const CameraKeyframe& next = keyframes_[nextIndex];
-
-        // 補間係数を計算（0.0～1.0）
-        float timeDiff = next.time - prev.time;
-        float t = 0.0f;
-        if (timeDiff > 0.0f) {
-            t = (currentTime_ - prev.time) / timeDiff;
-            t = std::clamp(t, 0.0f, 1.0f);
-
-            // イージング関数を適用
-            t = ApplyEasing(t, prev.interpolation);
-        }
-
-        // キーフレーム間を補間してカメラに適用
-        InterpolateKeyframes(prev, next, t);
-    }
+    // 現在時刻の状態をカメラに適用
+    ApplyCurrentTime();
 }
 
 /// <summary>
 /// キーフレームの追加
 /// </summary>
 void CameraAnimation::AddKeyframe(const CameraKeyframe& keyframe) {
-    keyframes_.push_back(keyframe);
-
-    // 自動ソートが有効な場合
-#ifdef _DEBUG
-    if (autoSortKeyframes_) {
-#endif
-        SortKeyframes();
+    // 自動ソートが無効な場合は末尾に追加
 #ifdef _DEBUG
+    if (!autoSortKeyframes_) {
+        keyframes_.push_back(keyframe);
+        UpdateDuration();
+        RebuildSegments();
+        return;
     }
 #endif
 
+    // 時刻順の位置（同じ時刻のキーフレームの後ろ）に挿入し、全体のソートはしない
+    auto it = std::upper_bound(keyframes_.begin(), keyframes_.end(), keyframe.time,
+        [](float time, const CameraKeyframe& kf) {
+            return time < kf.time;
+        });
+    keyframes_.insert(it, keyframe);
+
     UpdateDuration();
+    RebuildSegments();
 }
 
 /// <summary>
@@ -205,6 +223,7 @@ void CameraAnimation::RemoveKeyframe(size_t index) {
 
     keyframes_.erase(keyframes_.begin() + index);
     UpdateDuration();
+    RebuildSegments();
 }
 
 /// <summary>
@@ -226,6 +245,7 @@ void CameraAnimation::EditKeyframe(size_t index, const CameraKeyframe& keyframe)
 #endif
 
     UpdateDuration();
+    RebuildSegments();
 }
 
 /// <summary>
@@ -233,6 +253,9 @@ void CameraAnimation::EditKeyframe(size_t index, const CameraKeyframe& keyframe)
 /// </summary>
 void CameraAnimation::ClearKeyframes() {
     keyframes_.clear();
+    segments_.clear();
+    arcLengths_.clear();
+    keyframeCursor_ = 0;
     duration_ = 0.0f;
     currentTime_ = 0.0f;
     playState_ = PlayState::STOPPED;
@@ -270,6 +293,7 @@ void CameraAnimation::Play() {
         // SMOOTH_BLEND: 現在のカメラ状態を保存してブレンド開始
         blendStartPosition_ = camera_->GetTranslate();
         blendStartRotation_ = camera_->GetRotate();
+        blendStartQuaternion_ = EulerToQuaternion(blendStartRotation_);
         blendStartFov_ = camera_->GetFovY();
         blendProgress_ = 0.0f;
         isBlending_ = true;
@@ -324,6 +348,40 @@ void CameraAnimation::Reset() {
     currentTime_ = 0.0f;
 }
 
+/// <summary>
+/// 経路の種類の設定
+/// </summary>
+void CameraAnimation::SetPathType(PathType type) {
+    if (pathType_ != type) {
+        pathType_ = type;
+        RebuildSegments();
+    }
+}
+
+/// <summary>
+/// 曲線の区間を一定の速さで進むかの設定
+/// </summary>
+void CameraAnimation::SetConstantSpeed(bool constantSpeed) {
+    if (constantSpeed_ != constantSpeed) {
+        constantSpeed_ = constantSpeed;
+        RebuildSegments();
+    }
+}
+
+/// <summary>
+/// 指定時刻の位置を取得
+/// </summary>
+Vector3 CameraAnimation::SamplePosition(float time) const {
+    if (keyframes_.empty()) {
+        return { 0.0f, 0.0f, 0.0f };
+    }
+    size_t prevIndex = 0, nextIndex = 0;
+    FindKeyframeIndices(time, prevIndex, nextIndex);
+    const Segment& segment = segments_[prevIndex];
+    float t = std::clamp((time - segment.startTime) * segment.inverseDuration, 0.0f, 1.0f);
+    return EvaluatePosition(segment, ApplyEasing(t, segment.interpolation));
+}
+
 /// <summary>
 /// 現在時刻の設定（シーク）
 /// </summary>
@@ -335,26 +393,8 @@ void CameraAnimation::SetCurrentTime(float time) {
         return;
     }
 
-    // キーフレーム間の補間を実行
-    size_t prevIndex = 0, nextIndex = 0;
-    if (FindKeyframeIndices(currentTime_, prevIndex, nextIndex)) {
-        const CameraKeyframe& prev = keyframes_[prevIndex];
-        const CameraKeyframe& next = keyframes_[nextIndex];
-
-        // 補間係数を計算（0.0～1.0）
-        float timeDiff = next.time - prev.time;
-        float t = 0.0f;
-        if (timeDiff > 0.0f) {
-            t = (currentTime_ - prev.time) / timeDiff;
-            t = std::clamp(t, 0.0f, 1.0f);
-
-            // イージング関数を適用
-            t = ApplyEasing(t, prev.interpolation);
-        }
-
-        // キーフレーム間を補間してカメラに適用
-        InterpolateKeyframes(prev, next, t);
-    }
+    // 現在時刻の状態をカメラに適用
+    ApplyCurrentTime();
 }
 
 /// <summary>
@@ -384,21 +424,39 @@ void CameraAnimation::UpdateDuration() {
 /// 現在時刻に対応する2つのキーフレームを検索
 /// </summary>
 bool CameraAnimation::FindKeyframeIndices(float time, size_t& prevIndex, size_t& nextIndex) const {
-    if (keyframes_.size() < 2) {
+    const size_t count = keyframes_.size();
+    if (count < 2) {
         return false;
     }
 
-    // 時刻以下の最大のキーフレームを探す
-    prevIndex = 0;
-    for (size_t i = 0; i < keyframes_.size(); ++i) {
-        if (keyframes_[i].time <= time) {
-            prevIndex = i;
-        }
-        else {
-            break;
-        }
+    // 区間 i は「i 番目の時刻以下で、次の時刻より前」（先頭より前・末尾以降の時刻は両端の区間に含める）
+    auto isInSegment = [&](size_t i) {
+        return (i == 0 || keyframes_[i].time <= time) && (i + 1 == count || time < keyframes_[i + 1].time);
+    };
+
+    // 再生中は前回の区間かその隣にいることがほとんどなので、まずカーソルを前後に動かして探す
+    size_t cursor = std::min(keyframeCursor_, count - 1);
+    for (int step = 0; step < CameraConfig::Animation::KEYFRAME_CURSOR_SEARCH_LIMIT && !isInSegment(cursor); ++step) {
+        cursor = (keyframes_[cursor].time > time) ? cursor - 1 : cursor + 1;
+    }
+
+    if (isInSegment(cursor)) {
+        ++lookupStats_.cursorHits;
+    }
+    else {
+        // シークやループでカーソルから離れた場合は、時刻以下の最後のキーフレームを二分探索
+        auto it = std::upper_bound(keyframes_.begin(), keyframes_.end(), time,
+            [](float t, const CameraKeyframe& kf) {
+                return t < kf.time;
+            });
+        size_t index = static_cast<size_t>(it - keyframes_.begin());
+        cursor = (index == 0) ? 0 : index - 1;
+        ++lookupStats_.binarySearches;
     }
 
+    keyframeCursor_ = cursor;
+    prevIndex = cursor;
+
     // 次のキーフレームを設定
     nextIndex = prevIndex + 1;
     if (nextIndex >= keyframes_.size()) {
@@ -417,40 +475,261 @@ bool CameraAnimation::FindKeyframeIndices(float time, size_t& prevIndex, size_t&
 }
 
 /// <summary>
-/// キーフレーム間の補間
+/// キーフレームから区間ごとの補間データを作り直す
 /// </summary>
-void CameraAnimation::InterpolateKeyframes(const CameraKeyframe& prev, const CameraKeyframe& next, float t) {
-    if (!camera_) {
+void CameraAnimation::RebuildSegments() {
+    // キーフレームが変わったらベイクしたトラックは古いので破棄する（エディタは常にキーフレームから再生する）
+    bakedTrack_.Clear();
+
+    segments_.resize(keyframes_.size());
+    arcLengths_.clear();
+    if (pathType_ != PathType::LINEAR && constantSpeed_) {
+        arcLengths_.reserve(keyframes_.size() * (CameraConfig::Animation::ARC_LENGTH_TABLE_DIVISIONS + 1));
+    }
+
+    for (size_t i = 0; i < keyframes_.size(); ++i) {
+        const CameraKeyframe& prev = keyframes_[i];
+
+        // 最後のキーフレームから始まる区間は常に最後のキーフレームの値になる（ループ時も次の区間へは時刻で移る）
+        const CameraKeyframe& next = (i + 1 < keyframes_.size()) ? keyframes_[i + 1] : prev;
+        float timeDiff = next.time - prev.time;
+
+        Segment& segment = segments_[i];
+        segment.startTime = prev.time;
+        segment.inverseDuration = (timeDiff > 0.0f) ? 1.0f / timeDiff : 0.0f;
+        segment.positionStart = prev.position;
+        segment.positionDelta = Vec3::Subtract(next.position, prev.position);
+        segment.fovStart = prev.fov;
+        segment.fovDelta = next.fov - prev.fov;
+        segment.interpolation = prev.interpolation;
+
+        // 座標系タイプは前のキーフレームを優先（両方のキーフレームが同じ座標系である必要がある）
+        segment.coordinateType = prev.coordinateType;
+
+        // 回転はクォータニオンにしておき、変化しない区間はオイラー角も作っておく
+        segment.rotationStart = EulerToQuaternion(prev.rotation);
+        segment.rotationEnd = EulerToQuaternion(next.rotation);
+        segment.isRotationConstant = (segment.inverseDuration == 0.0f) ||
+            (prev.rotation.x == next.rotation.x && prev.rotation.y == next.rotation.y && prev.rotation.z == next.rotation.z);
+        segment.rotationEuler = QuaternionToEuler(segment.rotationStart);
+
+        // スプライン経路では位置だけを曲線にする（座標系タイプが変わる区間は直線のまま）
+        segment.positionQuadratic = { 0.0f, 0.0f, 0.0f };
+        segment.positionCubic = { 0.0f, 0.0f, 0.0f };
+        segment.isCurved = (pathType_ != PathType::LINEAR) && (segment.inverseDuration > 0.0f) &&
+            (prev.coordinateType == next.coordinateType);
+        segment.hasArcLengthTable = false;
+        if (segment.isCurved) {
+            BuildCurve(i, segment);
+            if (constantSpeed_) {
+                BuildArcLengthTable(segment);
+            }
+        }
+    }
+}
+
+/// <summary>
+/// 曲線の区間の係数を Catmull-Rom スプラインとして求める
+/// </summary>
+void CameraAnimation::BuildCurve(size_t index, Segment& segment) const {
+    const size_t count = keyframes_.size();
+    const CameraKeyframe& k1 = keyframes_[index];
+    const CameraKeyframe& k2 = keyframes_[index + 1];
+    const Vector3& p1 = k1.position;
+    const Vector3& p2 = k2.position;
+
+    // 最初と最後のキーフレームが同じ位置なら閉じた経路として、端の区間も反対側のキーフレームにつなぐ
+    const bool isClosed = count >= 3 &&
+        keyframes_.front().coordinateType == keyframes_.back().coordinateType &&
+        Vec3::Length(keyframes_.front().position - keyframes_.back().position) <= kClosedPathEpsilon;
+
+    // 前後のキーフレームが無い（座標系タイプが違う）端では、区間を延長した点を使う
+    Vector3 p0 = p1 * 2.0f - p2;
+    if (index > 0 && keyframes_[index - 1].coordinateType == k1.coordinateType) {
+        p0 = keyframes_[index - 1].position;
+    }
+    else if (index == 0 && isClosed) {
+        p0 = keyframes_[count - 2].position;
+    }
+    Vector3 p3 = p2 * 2.0f - p1;
+    if (index + 2 < count && keyframes_[index + 2].coordinateType == k2.coordinateType) {
+        p3 = keyframes_[index + 2].position;
+    }
+    else if (index + 2 == count && isClosed) {
+        p3 = keyframes_[1].position;
+    }
+
+    // ノット間隔は点の間の距離の alpha 乗（一様は 0、求心は 0.5）
+    const float alpha = (pathType_ == PathType::CENTRIPETAL) ? 0.5f : 0.0f;
+    auto knotInterval = [alpha](const Vector3& a, const Vector3& b) {
+        return std::pow(Vec3::Length(b - a), alpha);
+    };
+    float dt1 = knotInterval(p1, p2);
+    if (dt1 < kKnotIntervalEpsilon) {
+        dt1 = 1.0f;
+    }
+    float dt0 = knotInterval(p0, p1);
+    if (dt0 < kKnotIntervalEpsilon) {
+        dt0 = dt1;
+    }
+    float dt2 = knotInterval(p2, p3);
+    if (dt2 < kKnotIntervalEpsilon) {
+        dt2 = dt1;
+    }
+
+    // 不等間隔のノットでの接線を区間 [0, 1] に合わせてから、3 次エルミートの係数にする
+    Vector3 m1 = ((p1 - p0) * (1.0f / dt0) - (p2 - p0) * (1.0f / (dt0 + dt1)) + (p2 - p1) * (1.0f / dt1)) * dt1;
+    Vector3 m2 = ((p2 - p1) * (1.0f / dt1) - (p3 - p1) * (1.0f / (dt1 + dt2)) + (p3 - p2) * (1.0f / dt2)) * dt1;
+    segment.positionDelta = m1;
+    segment.positionQuadratic = (p2 - p1) * 3.0f - m1 * 2.0f - m2;
+    segment.positionCubic = (p1 - p2) * 2.0f + m1 + m2;
+}
+
+/// <summary>
+/// 曲線の区間の弧長表を作る
+/// </summary>
+void CameraAnimation::BuildArcLengthTable(Segment& segment) {
+    constexpr size_t kDivisions = CameraConfig::Animation::ARC_LENGTH_TABLE_DIVISIONS;
+
+    // 分割点を折れ線で結んだ長さを積み上げる
+    segment.arcLengthOffset = static_cast<uint32_t>(arcLengths_.size());
+    arcLengths_.push_back(0.0f);
+    float length = 0.0f;
+    Vector3 previous = segment.positionStart;
+    for (size_t i = 1; i <= kDivisions; ++i) {
+        Vector3 point = EvaluatePosition(segment, static_cast<float>(i) / kDivisions);
+        length += Vec3::Length(point - previous);
+        arcLengths_.push_back(length);
+        previous = point;
+    }
+
+    // 動かない区間はパラメータのまま進める
+    if (length <= 0.0f) {
+        arcLengths_.resize(segment.arcLengthOffset);
+        return;
+    }
+    const float inverseLength = 1.0f / length;
+    for (size_t i = 1; i <= kDivisions; ++i) {
+        arcLengths_[segment.arcLengthOffset + i] *= inverseLength;
+    }
+    segment.hasArcLengthTable = true;
+}
+
+/// <summary>
+/// 区間内の位置を求める
+/// </summary>
+Vector3 CameraAnimation::EvaluatePosition(const Segment& segment, float t) const {
+    if (!segment.isCurved) {
+        return Vec3::Add(segment.positionStart, segment.positionDelta * t);
+    }
+
+    float u = segment.hasArcLengthTable ? ArcLengthToParameter(segment, t) : t;
+    return segment.positionStart + (segment.positionDelta + (segment.positionQuadratic + segment.positionCubic * u) * u) * u;
+}
+
+/// <summary>
+/// 区間の先頭からの距離の割合を曲線のパラメータに変換
+/// </summary>
+float CameraAnimation::ArcLengthToParameter(const Segment& segment, float distance) const {
+    constexpr size_t kDivisions = CameraConfig::Animation::ARC_LENGTH_TABLE_DIVISIONS;
+    const float* table = arcLengths_.data() + segment.arcLengthOffset;
+
+    // distance を含む分割を探し、分割内は長さの比で線形に求める
+    distance = std::clamp(distance, 0.0f, 1.0f);
+    const float* upper = std::upper_bound(table + 1, table + kDivisions + 1, distance);
+    size_t index = std::min(static_cast<size_t>(upper - table), kDivisions) - 1;
+    float span = table[index + 1] - table[index];
+    float local = (span > 0.0f) ? (distance - table[index]) / span : 0.0f;
+    return (static_cast<float>(index) + local) / kDivisions;
+}
+
+/// <summary>
+/// 区間を評価
+/// </summary>
+BakedCameraTrack::Sample CameraAnimation::EvaluateSegment(const Segment& segment, float time) const {
+    // 補間係数を計算（0.0～1.0）してイージング関数を適用
+    float t = std::clamp((time - segment.startTime) * segment.inverseDuration, 0.0f, 1.0f);
+    t = ApplyEasing(t, segment.interpolation);
+
+    // 位置（スプライン経路では曲線上）・回転（正規化線形補間）・FOV を同じ係数で補間
+    // 回転が変化しない区間は作成済みのオイラー角をそのまま使う
+    BakedCameraTrack::Sample sample;
+    sample.position = EvaluatePosition(segment, t);
+    sample.rotation = segment.isRotationConstant ? segment.rotationEuler
+        : QuaternionToEuler(CameraPoseMath::Nlerp(segment.rotationStart, segment.rotationEnd, t));
+    sample.fov = segment.fovStart + segment.fovDelta * t;
+    sample.coordinateType = segment.coordinateType;
+    return sample;
+}
+
+/// <summary>
+/// 区間を評価してカメラに適用
+/// </summary>
+void CameraAnimation::ApplySegment(const Segment& segment, float time) {
+    ApplyPose(EvaluateSegment(segment, time));
+}
+
+/// <summary>
+/// 現在時刻の状態をカメラに適用
+/// </summary>
+void CameraAnimation::ApplyCurrentTime() {
+    // ベイクしたトラックがあれば前後のキーの補間だけで済ませる
+    if (bakedTrack_.IsValid()) {
+        ApplyPose(bakedTrack_.Evaluate(currentTime_));
         return;
     }
 
-    // 位置の補間
-    Vector3 position = Vec3::Lerp(prev.position, next.position, t);
+    // キーフレーム間の補間を実行
+    size_t prevIndex = 0, nextIndex = 0;
+    if (FindKeyframeIndices(currentTime_, prevIndex, nextIndex)) {
+        // 前のキーフレームから始まる区間を評価してカメラに適用
+        ApplySegment(segments_[prevIndex], currentTime_);
+    }
+}
 
-    // 座標系タイプを考慮（両方のキーフレームが同じ座標系である必要がある）
-    // 異なる場合は前のキーフレームの座標系を優先
-    CameraKeyframe::CoordinateType coordinateType = prev.coordinateType;
+/// <summary>
+/// カメラの状態をカメラに適用
+/// </summary>
+void CameraAnimation::ApplyPose(const BakedCameraTrack::Sample& sample) {
+    if (!camera_) {
+        return;
+    }
 
     // TARGET_RELATIVE モードの場合、ターゲット位置を加算
-    if (coordinateType == CameraKeyframe::CoordinateType::TARGET_RELATIVE && targetTransform_) {
+    Vector3 position = sample.position;
+    if (sample.coordinateType == CameraKeyframe::CoordinateType::TARGET_RELATIVE && targetTransform_) {
         // position はオフセットとして扱う
         position = Vec3::Add(targetTransform_->translate, position);
     }
     // ターゲットが設定されていない場合は、ワールド座標として扱う
 
-    // 回転の補間（クォータニオンで Slerp）
-    Quaternion q1 = EulerToQuaternion(prev.rotation);
-    Quaternion q2 = EulerToQuaternion(next.rotation);
-    Quaternion qResult = Quat::Slerp(q1, q2, t);
-    Vector3 rotation = QuaternionToEuler(qResult);
-
-    // FOV の補間（線形補間）
-    float fov = Vec3::Lerp(prev.fov, next.fov, t);
-
     // カメラに適用
     camera_->SetTranslate(position);
-    camera_->SetRotate(rotation);
-    camera_->SetFovY(fov);
+    camera_->SetRotate(sample.rotation);
+    camera_->SetFovY(sample.fov);
+}
+
+/// <summary>
+/// 一定間隔でサンプリングしたトラックを作成
+/// </summary>
+bool CameraAnimation::Bake(const BakedCameraTrack::BakeSettings& settings) {
+    bakedTrack_.Clear();
+    if (keyframes_.size() < 2 || settings.sampleRate <= 0.0f) {
+        return false;
+    }
+
+    // 最後のキーフレームの時刻を含むところまで、キーフレームから一定間隔でサンプリング
+    size_t sampleCount = static_cast<size_t>(std::ceil(duration_ * settings.sampleRate)) + 1;
+    std::vector<BakedCameraTrack::Sample> samples;
+    samples.reserve(sampleCount);
+    for (size_t i = 0; i < sampleCount; ++i) {
+        float time = static_cast<float>(i) / settings.sampleRate;
+        size_t prevIndex = 0, nextIndex = 0;
+        FindKeyframeIndices(time, prevIndex, nextIndex);
+        samples.push_back(EvaluateSegment(segments_[prevIndex], time));
+    }
+
+    return bakedTrack_.Build(samples, settings);
 }
 
 /// <summary>
@@ -629,65 +908,24 @@ void CameraAnimation::ApplyKeyframeDirectly(const CameraKeyframe& kf) {
 /// JSON ファイルから読み込み
 /// </summary>
 bool CameraAnimation::LoadFromJson(const std::string& filepath) {
-    try {
-        // JSON ファイルパスを構築
-        std::filesystem::path jsonPath = "resources/Json/CameraAnimations/" + filepath;
-        if (!jsonPath.has_extension()) {
-            jsonPath += ".json";
-        }
-
-        // ファイルを開く
-        std::ifstream file(jsonPath);
-        if (!file.is_open()) {
-            // ファイルが開けなかった
-            return false;
-        }
-
-        // JSON パース
-        nlohmann::json json;
-        file >> json;
-        file.close();
-
-        // データを読み込み
-        animationName_ = json.value("animation_name", "Untitled");
-        isLooping_ = json.value("loop", false);
-        playSpeed_ = json.value("play_speed", 1.0f);
-
-        // 開始モード設定を読み込み（後方互換性のためデフォルト値を設定）
-        int startModeInt = json.value("start_mode", static_cast<int>(StartMode::JUMP_CUT));
-        startMode_ = static_cast<StartMode>(startModeInt);
-        blendDuration_ = json.value("blend_duration", CameraConfig::Animation::DEFAULT_BLEND_DURATION);
-
-        // キーフレームをクリア
-        keyframes_.clear();
+    std::string jsonPath = GetJsonPath(filepath);
+    FileData data;
+    if (!ReadJson(jsonPath, data)) {
+        return false;
+    }
 
-        // キーフレーム配列を読み込み
-        if (json.contains("keyframes")) {
-            for (const auto& kf : json["keyframes"]) {
-                CameraKeyframe keyframe = kf.get<CameraKeyframe>();
-                keyframes_.push_back(keyframe);
-            }
-        }
-
-        // キーフレームをソートして総時間を更新
-        SortKeyframes();
-        UpdateDuration();
+    // 次回以降の読み込み用にバイナリを書き出す
+    ExportBinary(jsonPath, data);
+    ApplyFileData(std::move(data));
 
 #ifdef _DEBUG
-        DebugUIManager::GetInstance()->AddLog(
-            " CameraAnimation: Loaded animation" + animationName_ + " from " + jsonPath.string(),
-            DebugUIManager::LogType::Info);
+    DebugUIManager::GetInstance()->AddLog(
+        " CameraAnimation: Loaded animation" + animationName_ + " from " + jsonPath,
+        DebugUIManager::LogType::Info);
 #endif
 
-        // 読み込み成功
-        return true;
-
-    }
-    catch (const std::exception& e) {
-        // エラー処理
-        (void)e; // 警告回避
-        return false;
-    }
+    // 読み込み成功
+    return true;
 }
 
 /// <summary>
@@ -706,6 +944,10 @@ bool CameraAnimation::SaveToJson(const std::string& filepath) const {
         json["start_mode"] = static_cast<int>(startMode_);
         json["blend_duration"] = blendDuration_;
 
+        // 経路の設定を保存
+        json["path_type"] = PathTypeToString(pathType_);
+        json["constant_speed"] = constantSpeed_;
+
         // キーフレーム配列を保存
         json["keyframes"] = nlohmann::json::array();
         for (const auto& kf : keyframes_) {
@@ -719,10 +961,7 @@ bool CameraAnimation::SaveToJson(const std::string& filepath) const {
         }
 
         // JSON ファイルパスを構築
-        std::filesystem::path jsonPath = dirPath / filepath;
-        if (!jsonPath.has_extension()) {
-            jsonPath += ".json";
-        }
+        std::string jsonPath = GetJsonPath(filepath);
 
         // ファイルに書き込み
         std::ofstream file(jsonPath);
@@ -734,10 +973,13 @@ bool CameraAnimation::SaveToJson(const std::string& filepath) const {
         file << json.dump(4);
         file.close();
 
+        // 保存した JSON に合わせてバイナリも書き出す
+        ExportBinary(jsonPath, MakeFileData());
+
 #ifdef _DEBUG
         // Debug ログ出力
         DebugUIManager::GetInstance()->AddLog(
-            " CameraAnimation: Saved animation " + animationName_ + " to " + jsonPath.string(),
+            " CameraAnimation: Saved animation " + animationName_ + " to " + jsonPath,
             DebugUIManager::LogType::Info);
 #endif
 
@@ -752,6 +994,159 @@ bool CameraAnimation::SaveToJson(const std::string& filepath) const {
     }
 }
 
+/// <summary>
+/// ファイルから読み込み（バイナリ優先）
+/// </summary>
+bool CameraAnimation::LoadFromFile(const std::string& name) {
+    FileData data;
+    if (!ReadFile(name, data)) {
+        return false;
+    }
+    ApplyFileData(std::move(data));
+
+#ifdef _DEBUG
+    DebugUIManager::GetInstance()->AddLog(
+        " CameraAnimation: Loaded animation " + animationName_ + " (" + name + ")",
+        DebugUIManager::LogType::Info);
+#endif
+
+    return true;
+}
+
+/// <summary>
+/// ファイルからアニメーションの内容を読み込む
+/// </summary>
+bool CameraAnimation::ReadFile(const std::string& name, FileData& data) {
+    // 変換元の JSON があれば、それより古いバイナリは使わない
+    std::string jsonPath = GetJsonPath(name);
+    CameraAnimationBinary::SourceStamp stamp;
+    bool hasSource = CameraAnimationBinary::GetSourceStamp(jsonPath, stamp);
+    if (CameraAnimationBinary::Read(GetBinaryPath(jsonPath), hasSource ? &stamp : nullptr, data)) {
+        return true;
+    }
+
+    // バイナリが無いか古ければ JSON から読み込んで作り直す
+    if (!hasSource || !ReadJson(jsonPath, data)) {
+        return false;
+    }
+    ExportBinary(jsonPath, data);
+    return true;
+}
+
+/// <summary>
+/// 読み込んだ内容を反映
+/// </summary>
+void CameraAnimation::ApplyFileData(FileData&& data) {
+    animationName_ = std::move(data.animationName);
+    isLooping_ = data.loop;
+    playSpeed_ = data.playSpeed;
+    startMode_ = data.startMode;
+    blendDuration_ = data.blendDuration;
+    pathType_ = data.pathType;
+    constantSpeed_ = data.constantSpeed;
+
+    keyframes_ = std::move(data.keyframes);
+    keyframeCursor_ = 0;
+
+    // キーフレームをソートして総時間を更新
+    SortKeyframes();
+    UpdateDuration();
+    RebuildSegments();
+}
+
+/// <summary>
+/// アニメーション名に対応する JSON のパスを取得
+/// </summary>
+std::string CameraAnimation::GetJsonPath(const std::string& name) {
+    std::filesystem::path jsonPath = "resources/Json/CameraAnimations/" + name;
+    if (!jsonPath.has_extension()) {
+        jsonPath += ".json";
+    }
+    return jsonPath.string();
+}
+
+/// <summary>
+/// JSON のパスに対応するバイナリのパスを取得
+/// </summary>
+std::string CameraAnimation::GetBinaryPath(const std::string& jsonPath) {
+    std::filesystem::path binaryPath = jsonPath;
+    binaryPath.replace_extension(".camanim");
+    return binaryPath.string();
+}
+
+/// <summary>
+/// JSON ファイルからアニメーションの内容を読み込む
+/// </summary>
+bool CameraAnimation::ReadJson(const std::string& jsonPath, FileData& data) {
+    try {
+        // ファイルを開く
+        std::ifstream file(jsonPath);
+        if (!file.is_open()) {
+            // ファイルが開けなかった
+            return false;
+        }
+
+        // JSON パース
+        nlohmann::json json;
+        file >> json;
+        file.close();
+
+        // データを読み込み
+        data.animationName = json.value("animation_name", "Untitled");
+        data.loop = json.value("loop", false);
+        data.playSpeed = json.value("play_speed", 1.0f);
+
+        // 開始モード設定を読み込み（後方互換性のためデフォルト値を設定）
+        int startModeInt = json.value("start_mode", static_cast<int>(StartMode::JUMP_CUT));
+        data.startMode = static_cast<StartMode>(startModeInt);
+        data.blendDuration = json.value("blend_duration", CameraConfig::Animation::DEFAULT_BLEND_DURATION);
+
+        // 経路の設定を読み込み（無ければ従来どおり直線）
+        data.pathType = PathTypeFromString(json.value("path_type", "LINEAR"));
+        data.constantSpeed = json.value("constant_speed", true);
+
+        // キーフレーム配列を読み込み
+        data.keyframes.clear();
+        if (json.contains("keyframes")) {
+            for (const auto& kf : json["keyframes"]) {
+                data.keyframes.push_back(kf.get<CameraKeyframe>());
+            }
+        }
+        return true;
+    }
+    catch (const std::exception& e) {
+        // エラー処理
+        (void)e; // 警告回避
+        return false;
+    }
+}
+
+/// <summary>
+/// JSON と同じ内容のバイナリを書き出す
+/// </summary>
+void CameraAnimation::ExportBinary(const std::string& jsonPath, const FileData& data) {
+    CameraAnimationBinary::SourceStamp stamp;
+    if (CameraAnimationBinary::GetSourceStamp(jsonPath, stamp)) {
+        CameraAnimationBinary::Write(GetBinaryPath(jsonPath), data, stamp);
+    }
+}
+
+/// <summary>
+/// 現在の内容を FileData にまとめる
+/// </summary>
+CameraAnimation::FileData CameraAnimation::MakeFileData() const {
+    FileData data;
+    data.animationName = animationName_;
+    data.loop = isLooping_;
+    data.playSpeed = playSpeed_;
+    data.startMode = startMode_;
+    data.blendDuration = blendDuration_;
+    data.pathType = pathType_;
+    data.constantSpeed = constantSpeed_;
+    data.keyframes = keyframes_;
+    return data;
+}
+
 #ifdef _DEBUG
 /// <summary>
 /// ImGui でのデバッグ表示
@@ -765,6 +1160,19 @@ void CameraAnimation::DrawImGui() {
     ImGui::Text("Current Time: %.2f", currentTime_);
     ImGui::Text("Keyframes: %zu", keyframes_.size());
 
+    // ベイク状態（キーフレームを編集すると破棄される）
+    if (bakedTrack_.IsValid()) {
+        const BakedCameraTrack::Stats& bakeStats = bakedTrack_.GetStats();
+        ImGui::Text("Baked: %u keys / %u samples (%zu bytes%s)", bakeStats.keyCount, bakeStats.sampleCount,
+            bakeStats.byteSize, bakedTrack_.IsQuantized() ? ", quantized" : "");
+        if (ImGui::Button("Clear Bake")) {
+            ClearBake();
+        }
+    }
+    else if (ImGui::Button("Bake")) {
+        Bake();
+    }
+
     ImGui::Separator();
 
     // 再生コントロール
@@ -863,6 +1271,7 @@ void CameraAnimation::DrawImGui() {
 
         if (ImGui::Button("Sort Keyframes")) {
             SortKeyframes();
+            RebuildSegments();
         }
         ImGui::SameLine();
         if (ImGui::Button("Clear All Keyframes")) {
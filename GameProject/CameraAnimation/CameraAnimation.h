@@ -1,9 +1,11 @@
 #pragma once
 #include "CameraKeyframe.h"
+#include "BakedCameraTrack.h"
 #include "CameraSystem/CameraConfig.h"
 #include "Camera.h"
 #include "Quaternion.h"
 #include "Transform.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -31,6 +33,37 @@ public:
         SMOOTH_BLEND     ///< 現在位置から最初のキーフレームまで補間
     };
 
+    /// <summary>
+    /// キーフレームの位置を結ぶ経路の種類
+    /// </summary>
+    enum class PathType {
+        LINEAR,         ///< 直線で結ぶ（従来の動作）
+        CATMULL_ROM,    ///< 一様 Catmull-Rom スプライン
+        CENTRIPETAL     ///< 求心 Catmull-Rom スプライン（キーの間隔が不揃いでも尖りや行き過ぎが出にくい）
+    };
+
+    /// <summary>
+    /// キーフレーム検索の統計
+    /// </summary>
+    struct LookupStats {
+        uint64_t cursorHits = 0;        ///< 前回の区間の近くで見つかった回数
+        uint64_t binarySearches = 0;    ///< 二分探索した回数
+    };
+
+    /// <summary>
+    /// ファイルから読み込んだアニメーションの内容（ApplyFileData で反映する）
+    /// </summary>
+    struct FileData {
+        std::string animationName = "Untitled";                                   ///< アニメーション名
+        bool loop = false;                                                        ///< ループ再生するか
+        float playSpeed = 1.0f;                                                   ///< 再生速度
+        StartMode startMode = StartMode::JUMP_CUT;                                ///< 開始モード
+        float blendDuration = CameraConfig::Animation::DEFAULT_BLEND_DURATION;    ///< ブレンド時間（秒）
+        PathType pathType = PathType::LINEAR;                                     ///< 経路の種類
+        bool constantSpeed = true;                                                ///< 曲線の区間を一定の速さで進むか
+        std::vector<CameraKeyframe> keyframes;                                    ///< キーフレーム
+    };
+
     /// <summary>
     /// コンストラクタ
     /// </summary>
@@ -116,6 +149,30 @@ public:
     /// </summary>
     void Reset();
 
+    /// <summary>
+    /// 現在時刻に対応する2つのキーフレームを検索
+    /// 前回見つけた区間（カーソル）から前後に数区間だけ探し、見つからなければ二分探索する
+    /// 通常再生・逆再生ではほぼカーソルの移動だけで済み、シークやスクラブでも O(log n) で求まる
+    /// </summary>
+    /// <param name="time">検索時刻</param>
+    /// <param name="prevIndex">前のキーフレームインデックス（出力）</param>
+    /// <param name="nextIndex">次のキーフレームインデックス（出力）</param>
+    /// <returns>キーフレームが見つかったか</returns>
+    bool FindKeyframeIndices(float time, size_t& prevIndex, size_t& nextIndex) const;
+
+    /// <summary>
+    /// 一定間隔でサンプリングしたトラックを作成し、以降の再生（Update・SetCurrentTime）はトラックで行う
+    /// キーフレームを変更するとトラックは破棄され、キーフレームからの再生に戻る
+    /// </summary>
+    /// <param name="settings">ベイク設定</param>
+    /// <returns>作成できたか（キーフレームが2つ未満なら失敗）</returns>
+    bool Bake(const BakedCameraTrack::BakeSettings& settings = {});
+
+    /// <summary>
+    /// ベイクしたトラックを破棄し、キーフレームからの再生に戻す
+    /// </summary>
+    void ClearBake() { bakedTrack_.Clear(); }
+
     /// <summary>
     /// JSON ファイルから読み込み
     /// </summary>
@@ -128,6 +185,27 @@ public:
     /// <param name="filepath">保存先ファイルパス</param>
     bool SaveToJson(const std::string& filepath) const;
 
+    /// <summary>
+    /// ファイルから読み込み（バイナリ優先、無いか古ければ JSON から読み込んでバイナリを書き出す）
+    /// </summary>
+    /// <param name="name">アニメーション名（拡張子なし）</param>
+    bool LoadFromFile(const std::string& name);
+
+    /// <summary>
+    /// ファイルからアニメーションの内容を読み込む（LoadFromFile と同じ順で探す）
+    /// メンバーに触れずログも出さないので、ワーカースレッドから呼べる
+    /// </summary>
+    /// <param name="name">アニメーション名（拡張子なし）</param>
+    /// <param name="data">内容の出力先</param>
+    /// <returns>読み込めたか</returns>
+    static bool ReadFile(const std::string& name, FileData& data);
+
+    /// <summary>
+    /// 読み込んだ内容を反映（キーフレームをソートして区間を作り直す）
+    /// </summary>
+    /// <param name="data">アニメーションの内容</param>
+    void ApplyFileData(FileData&& data);
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGui でのデバッグ表示
@@ -167,6 +245,22 @@ public:
     /// </summary>
     [[nodiscard]] bool IsLooping() const { return isLooping_; }
 
+    /// <summary>
+    /// 経路の種類を取得
+    /// </summary>
+    [[nodiscard]] PathType GetPathType() const { return pathType_; }
+
+    /// <summary>
+    /// 曲線の区間を一定の速さで進むかを取得
+    /// </summary>
+    [[nodiscard]] bool IsConstantSpeed() const { return constantSpeed_; }
+
+    /// <summary>
+    /// 指定時刻の位置を取得（経路の表示・確認用。TARGET_RELATIVE の区間はオフセットのまま）
+    /// </summary>
+    /// <param name="time">時刻（秒）</param>
+    [[nodiscard]] Tako::Vector3 SamplePosition(float time) const;
+
     /// <summary>
     /// アニメーション名を取得
     /// </summary>
@@ -207,6 +301,21 @@ public:
     /// </summary>
     [[nodiscard]] float GetBlendProgress() const { return blendProgress_; }
 
+    /// <summary>
+    /// ベイクしたトラックで再生しているか
+    /// </summary>
+    [[nodiscard]] bool IsBaked() const { return bakedTrack_.IsValid(); }
+
+    /// <summary>
+    /// ベイクしたトラックを取得
+    /// </summary>
+    [[nodiscard]] const BakedCameraTrack& GetBakedTrack() const { return bakedTrack_; }
+
+    /// <summary>
+    /// キーフレーム検索の統計を取得
+    /// </summary>
+    [[nodiscard]] const LookupStats& GetLookupStats() const { return lookupStats_; }
+
     //-----------------------------------------Setter-----------------------------------------//
 
     /// <summary>
@@ -247,7 +356,76 @@ public:
     /// <param name="duration">ブレンド時間（秒）</param>
     void SetBlendDuration(float duration) { blendDuration_ = duration; }
 
+    /// <summary>
+    /// 経路の種類の設定（区間を作り直す）
+    /// </summary>
+    /// <param name="type">経路の種類</param>
+    void SetPathType(PathType type);
+
+    /// <summary>
+    /// 曲線の区間を一定の速さで進むかの設定（区間を作り直す）
+    /// キーフレームの時刻はそのままで、区間内の進み方を曲線の長さに合わせる（イージングは進んだ距離に掛かる）
+    /// </summary>
+    /// <param name="constantSpeed">一定の速さで進む場合 true</param>
+    void SetConstantSpeed(bool constantSpeed);
+
 private:
+    /// <summary>
+    /// 1つのキーフレームから次のキーフレームまでの区間の補間データ
+    /// キーフレームの変更時に作っておき、再生中は時刻から係数を1つ求めて各チャンネルに掛けるだけにする
+    /// </summary>
+    struct Segment {
+        float startTime = 0.0f;                 ///< 区間の開始時刻
+        float inverseDuration = 0.0f;           ///< 区間の長さの逆数（長さが 0 以下の区間は 0 で、常に開始時の値になる）
+        Tako::Vector3 positionStart;            ///< 開始時の位置
+        Tako::Vector3 positionDelta;            ///< 位置の変化量（曲線の区間は 1 次の係数）
+        Tako::Vector3 positionQuadratic;        ///< 位置の 2 次の係数（直線の区間は 0）
+        Tako::Vector3 positionCubic;            ///< 位置の 3 次の係数（直線の区間は 0）
+        uint32_t arcLengthOffset = 0;           ///< 弧長表の開始位置（arcLengths_ 内）
+        bool isCurved = false;                  ///< 曲線の区間か
+        bool hasArcLengthTable = false;         ///< 弧長表を使って一定の速さで進むか
+        Tako::Quaternion rotationStart;         ///< 開始時の回転
+        Tako::Quaternion rotationEnd;           ///< 終了時の回転（開始時の回転と同じ半球にそろえる）
+        Tako::Vector3 rotationEuler;            ///< 回転が変化しない区間のオイラー角
+        bool isRotationConstant = false;        ///< 区間内で回転が変化しないか
+        float fovStart = 0.0f;                  ///< 開始時の FOV
+        float fovDelta = 0.0f;                  ///< FOV の変化量
+        CameraKeyframe::InterpolationType interpolation = CameraKeyframe::InterpolationType::LINEAR;  ///< イージング
+        CameraKeyframe::CoordinateType coordinateType = CameraKeyframe::CoordinateType::WORLD;        ///< 座標系タイプ
+    };
+
+    /// <summary>
+    /// アニメーション名に対応する JSON のパスを取得
+    /// </summary>
+    /// <param name="name">アニメーション名（拡張子付きも可）</param>
+    static std::string GetJsonPath(const std::string& name);
+
+    /// <summary>
+    /// JSON のパスに対応するバイナリ（.camanim）のパスを取得
+    /// </summary>
+    /// <param name="jsonPath">JSON ファイルパス</param>
+    static std::string GetBinaryPath(const std::string& jsonPath);
+
+    /// <summary>
+    /// JSON ファイルからアニメーションの内容を読み込む
+    /// </summary>
+    /// <param name="jsonPath">JSON ファイルパス</param>
+    /// <param name="data">内容の出力先</param>
+    /// <returns>読み込めたか</returns>
+    static bool ReadJson(const std::string& jsonPath, FileData& data);
+
+    /// <summary>
+    /// JSON と同じ内容のバイナリを書き出す（次回以降の読み込み用。失敗しても無視する）
+    /// </summary>
+    /// <param name="jsonPath">変換元の JSON ファイルパス</param>
+    /// <param name="data">アニメーションの内容</param>
+    static void ExportBinary(const std::string& jsonPath, const FileData& data);
+
+    /// <summary>
+    /// 現在の内容を FileData にまとめる
+    /// </summary>
+    FileData MakeFileData() const;
+
     /// <summary>
     /// キーフレームを時間でソート
     /// </summary>
@@ -259,21 +437,64 @@ private:
     void UpdateDuration();
 
     /// <summary>
-    /// 現在時刻に対応する2つのキーフレームを検索
+    /// キーフレームから区間ごとの補間データを作り直す（キーフレームを変更したら呼ぶ）
     /// </summary>
-    /// <param name="time">検索時刻</param>
-    /// <param name="prevIndex">前のキーフレームインデックス（出力）</param>
-    /// <param name="nextIndex">次のキーフレームインデックス（出力）</param>
-    /// <returns>キーフレームが見つかったか</returns>
-    bool FindKeyframeIndices(float time, size_t& prevIndex, size_t& nextIndex) const;
+    void RebuildSegments();
+
+    /// <summary>
+    /// 曲線の区間の係数（3 次エルミート）を Catmull-Rom スプラインとして求める
+    /// </summary>
+    /// <param name="index">区間の開始キーフレームのインデックス</param>
+    /// <param name="segment">係数の出力先</param>
+    void BuildCurve(size_t index, Segment& segment) const;
+
+    /// <summary>
+    /// 曲線の区間の弧長表を作る（区間の先頭から各分割点までの長さを全長で割ったもの）
+    /// </summary>
+    /// <param name="segment">区間</param>
+    void BuildArcLengthTable(Segment& segment);
+
+    /// <summary>
+    /// 区間内の位置を求める
+    /// </summary>
+    /// <param name="segment">区間</param>
+    /// <param name="t">イージング適用後の補間係数（弧長表があれば進んだ距離の割合）</param>
+    /// <returns>位置</returns>
+    Tako::Vector3 EvaluatePosition(const Segment& segment, float t) const;
+
+    /// <summary>
+    /// 区間の先頭からの距離の割合を曲線のパラメータに変換（弧長表の二分探索）
+    /// </summary>
+    /// <param name="segment">区間</param>
+    /// <param name="distance">距離の割合（0.0～1.0）</param>
+    /// <returns>曲線のパラメータ（0.0～1.0）</returns>
+    float ArcLengthToParameter(const Segment& segment, float distance) const;
 
     /// <summary>
-    /// キーフレーム間の補間
+    /// 区間を評価（位置は座標系タイプに応じたオフセットのまま）
     /// </summary>
-    /// <param name="prev">前のキーフレーム</param>
-    /// <param name="next">次のキーフレーム</param>
-    /// <param name="t">補間係数（0.0～1.0）</param>
-    void InterpolateKeyframes(const CameraKeyframe& prev, const CameraKeyframe& next, float t);
+    /// <param name="segment">区間</param>
+    /// <param name="time">時刻</param>
+    /// <returns>カメラの状態</returns>
+    BakedCameraTrack::Sample EvaluateSegment(const Segment& segment, float time) const;
+
+    /// <summary>
+    /// 区間を評価してカメラに適用
+    /// </summary>
+    /// <param name="segment">区間</param>
+    /// <param name="time">時刻</param>
+    void ApplySegment(const Segment& segment, float time);
+
+    /// <summary>
+    /// 現在時刻の状態をカメラに適用（ベイクしたトラックがあればトラック、なければキーフレームから求める）
+    /// </summary>
+    void ApplyCurrentTime();
+
+    /// <summary>
+    /// カメラの状態をカメラに適用
+    /// </summary>
+    /// <param name="sample">カメラの状態</param>
+    void ApplyPose(const BakedCameraTrack::Sample& sample);
 
     /// <summary>
     /// イージング関数の適用
@@ -312,6 +533,18 @@ private:
 
     std::vector<CameraKeyframe> keyframes_;  ///< キーフレーム配列
 
+    // キーフレーム検索用（カーソルは探索の起点にすぎないので、キーフレームが変わっても結果には影響しない）
+    mutable size_t keyframeCursor_ = 0;      ///< 直前に見つけた区間の前のキーフレームインデックス
+    mutable LookupStats lookupStats_;        ///< キーフレーム検索の統計
+
+    std::vector<Segment> segments_;          ///< キーフレームごとの、そこから始まる区間の補間データ
+    std::vector<float> arcLengths_;          ///< 曲線の区間の弧長表（区間ごとに ARC_LENGTH_TABLE_DIVISIONS + 1 個）
+
+    PathType pathType_ = PathType::LINEAR;   ///< 経路の種類
+    bool constantSpeed_ = true;              ///< 曲線の区間を一定の速さで進むか
+
+    BakedCameraTrack bakedTrack_;            ///< ベイクしたトラック（空ならキーフレームから再生）
+
     Tako::Camera* camera_ = nullptr;  ///< アニメーション対象のカメラ
 
     const Tako::Transform* targetTransform_ = nullptr;  ///< ターゲットトランスフォーム（相対座標の基準）
@@ -334,6 +567,7 @@ private:
     // ブレンド開始時のカメラ状態
     Tako::Vector3 blendStartPosition_;  ///< ブレンド開始時の位置
     Tako::Vector3 blendStartRotation_;  ///< ブレンド開始時の回転
+    Tako::Quaternion blendStartQuaternion_;  ///< ブレンド開始時の回転（クォータニオン）
     float blendStartFov_;         ///< ブレンド開始時の FOV
 
     // FOV 復元用
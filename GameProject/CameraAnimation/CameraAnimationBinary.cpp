@@ -0,0 +1,180 @@
+#include "CameraAnimationBinary.h"
+#include "Common/MappedFile.h"
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace Tako;
+
+// ファイルレイアウト（リトルエンディアン、各セクションは 4 バイト境界）
+//   Header
+//   KeyframeRecord[keyframeCount]      時刻順
+//   char name[nameLength]              アニメーション名
+
+struct CameraAnimationBinary::Header {
+    char magic[4];              // "CAMA"
+    uint32_t version;           // kFormatVersion
+    uint64_t sourceSize;        // 変換元ファイルのサイズ
+    int64_t sourceWriteTime;    // 変換元ファイルの更新時刻
+    uint32_t keyframeCount;     // キーフレーム数
+    uint32_t nameLength;        // アニメーション名の長さ
+    float playSpeed;            // 再生速度
+    float blendDuration;        // ブレンド時間（秒）
+    uint32_t flags;             // kLoop 等
+    uint32_t startMode;         // CameraAnimation::StartMode
+    uint32_t pathType;          // CameraAnimation::PathType
+    uint32_t reserved;
+};
+
+struct CameraAnimationBinary::KeyframeRecord {
+    float time;                 // 時刻（秒）
+    float position[3];          // 位置またはオフセット
+    float rotation[3];          // 回転（オイラー角、ラジアン）
+    float fov;                  // 視野角（ラジアン）
+    uint8_t interpolation;      // CameraKeyframe::InterpolationType
+    uint8_t coordinateType;     // CameraKeyframe::CoordinateType
+    uint16_t reserved;
+};
+
+namespace {
+
+constexpr char kMagic[4] = { 'C', 'A', 'M', 'A' };
+constexpr uint32_t kLoop = 1 << 0;
+constexpr uint32_t kConstantSpeed = 1 << 1;
+
+} // namespace
+
+bool CameraAnimationBinary::Write(const std::string& filepath, const CameraAnimation::FileData& data, const SourceStamp& source) {
+    try {
+        std::vector<KeyframeRecord> records;
+        records.reserve(data.keyframes.size());
+        for (const CameraKeyframe& keyframe : data.keyframes) {
+            KeyframeRecord record{};
+            record.time = keyframe.time;
+            record.position[0] = keyframe.position.x;
+            record.position[1] = keyframe.position.y;
+            record.position[2] = keyframe.position.z;
+            record.rotation[0] = keyframe.rotation.x;
+            record.rotation[1] = keyframe.rotation.y;
+            record.rotation[2] = keyframe.rotation.z;
+            record.fov = keyframe.fov;
+            record.interpolation = static_cast<uint8_t>(keyframe.interpolation);
+            record.coordinateType = static_cast<uint8_t>(keyframe.coordinateType);
+            records.push_back(record);
+        }
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFormatVersion;
+        header.sourceSize = source.size;
+        header.sourceWriteTime = source.writeTime;
+        header.keyframeCount = static_cast<uint32_t>(records.size());
+        header.nameLength = static_cast<uint32_t>(data.animationName.size());
+        header.playSpeed = data.playSpeed;
+        header.blendDuration = data.blendDuration;
+        header.flags = (data.loop ? kLoop : 0) | (data.constantSpeed ? kConstantSpeed : 0);
+        header.startMode = static_cast<uint32_t>(data.startMode);
+        header.pathType = static_cast<uint32_t>(data.pathType);
+
+        // 読み込み中のスレッドが書きかけを見ないよう、一時ファイルに書いてから置き換える
+        std::string tempPath = filepath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(KeyframeRecord));
+            file.write(data.animationName.data(), data.animationName.size());
+            if (!file) {
+                return false;
+            }
+        }
+        std::filesystem::rename(tempPath, filepath);
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool CameraAnimationBinary::Read(const std::string& filepath, const SourceStamp* expectedSource, CameraAnimation::FileData& data) {
+    static_assert(sizeof(Header) == 56, "camanim header layout changed");
+    static_assert(sizeof(KeyframeRecord) == 36, "camanim keyframe layout changed");
+
+    MappedFile file;
+    if (!file.Open(filepath) || file.GetSize() < sizeof(Header)) {
+        return false;
+    }
+
+    const uint8_t* bytes = file.GetData();
+    const auto* header = reinterpret_cast<const Header*>(bytes);
+
+    // フォーマット・変換元の鮮度を確認
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+        header->version != kFormatVersion ||
+        header->startMode > static_cast<uint32_t>(CameraAnimation::StartMode::SMOOTH_BLEND) ||
+        header->pathType > static_cast<uint32_t>(CameraAnimation::PathType::CENTRIPETAL)) {
+        return false;
+    }
+    if (expectedSource &&
+        (header->sourceSize != expectedSource->size ||
+         header->sourceWriteTime != expectedSource->writeTime)) {
+        return false;
+    }
+
+    // セクションサイズの整合性
+    uint64_t keyframesOffset = sizeof(Header);
+    uint64_t nameOffset = keyframesOffset + uint64_t(header->keyframeCount) * sizeof(KeyframeRecord);
+    uint64_t totalSize = nameOffset + header->nameLength;
+    if (totalSize != file.GetSize()) {
+        return false;
+    }
+
+    // 列挙値の範囲を確認してから取り出す
+    const auto* records = reinterpret_cast<const KeyframeRecord*>(bytes + keyframesOffset);
+    std::vector<CameraKeyframe> keyframes;
+    keyframes.reserve(header->keyframeCount);
+    for (uint32_t i = 0; i < header->keyframeCount; ++i) {
+        const KeyframeRecord& record = records[i];
+        if (record.interpolation > static_cast<uint8_t>(CameraKeyframe::InterpolationType::CUBIC_BEZIER) ||
+            record.coordinateType > static_cast<uint8_t>(CameraKeyframe::CoordinateType::TARGET_RELATIVE) ||
+            !std::isfinite(record.time)) {
+            return false;
+        }
+        keyframes.emplace_back(record.time,
+            Vector3{ record.position[0], record.position[1], record.position[2] },
+            Vector3{ record.rotation[0], record.rotation[1], record.rotation[2] },
+            record.fov,
+            static_cast<CameraKeyframe::InterpolationType>(record.interpolation),
+            static_cast<CameraKeyframe::CoordinateType>(record.coordinateType));
+    }
+
+    data.animationName.assign(reinterpret_cast<const char*>(bytes + nameOffset), header->nameLength);
+    data.loop = (header->flags & kLoop) != 0;
+    data.playSpeed = header->playSpeed;
+    data.startMode = static_cast<CameraAnimation::StartMode>(header->startMode);
+    data.blendDuration = header->blendDuration;
+    data.pathType = static_cast<CameraAnimation::PathType>(header->pathType);
+    data.constantSpeed = (header->flags & kConstantSpeed) != 0;
+    data.keyframes = std::move(keyframes);
+    return true;
+}
+
+bool CameraAnimationBinary::GetSourceStamp(const std::string& filepath, SourceStamp& stamp) {
+    std::error_code ec;
+    uint64_t size = std::filesystem::file_size(filepath, ec);
+    if (ec) {
+        return false;
+    }
+    auto writeTime = std::filesystem::last_write_time(filepath, ec);
+    if (ec) {
+        return false;
+    }
+
+    stamp.size = size;
+    stamp.writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "CameraAnimation.h"
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// カメラアニメーションのバイナリ（.camanim）
+/// 設定とキーフレームをそのままのレイアウトで並べ、JSON のパースを経由せずに読み込む
+/// JSON は編集・書き出し用の形式として残し、バイナリは JSON から生成する（変換元の更新を検出したら作り直す）
+/// </summary>
+class CameraAnimationBinary {
+public:
+    /// <summary>
+    /// フォーマットのバージョン（レイアウトを変えたら更新する）
+    /// </summary>
+    static constexpr uint32_t kFormatVersion = 2;
+
+    /// <summary>
+    /// 変換元ファイルの識別情報（古いバイナリの検出用）
+    /// </summary>
+    struct SourceStamp {
+        uint64_t size = 0;       ///< ファイルサイズ
+        int64_t writeTime = 0;   ///< 最終更新時刻
+    };
+
+    /// <summary>
+    /// バイナリに書き出す
+    /// </summary>
+    /// <param name="filepath">出力先パス</param>
+    /// <param name="data">アニメーションの内容</param>
+    /// <param name="source">変換元ファイルの識別情報</param>
+    /// <returns>成功したら true</returns>
+    static bool Write(const std::string& filepath, const CameraAnimation::FileData& data, const SourceStamp& source);
+
+    /// <summary>
+    /// バイナリを読み込んで検証
+    /// </summary>
+    /// <param name="filepath">バイナリのパス</param>
+    /// <param name="expectedSource">変換元の識別情報（nullptr なら鮮度を確認しない）</param>
+    /// <param name="data">アニメーションの内容の出力先</param>
+    /// <returns>有効かつ最新なら true</returns>
+    static bool Read(const std::string& filepath, const SourceStamp* expectedSource, CameraAnimation::FileData& data);
+
+    /// <summary>
+    /// 変換元ファイルの識別情報を取得
+    /// </summary>
+    /// <param name="filepath">ファイルパス</param>
+    /// <param name="stamp">識別情報の出力先</param>
+    /// <returns>ファイルが存在すれば true</returns>
+    static bool GetSourceStamp(const std::string& filepath, SourceStamp& stamp);
+
+private:
+    struct Header;
+    struct KeyframeRecord;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include "Quaternion.h"
+#include <cmath>
+
+/// <summary>
+/// カメラアニメーションの再生で使う、三角関数を使わないクォータニオン関数
+/// </summary>
+namespace CameraPoseMath {
+
+    /// <summary>
+    /// 内積
+    /// </summary>
+    inline float Dot(const Tako::Quaternion& a, const Tako::Quaternion& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    }
+
+    /// <summary>
+    /// 正規化
+    /// </summary>
+    inline Tako::Quaternion Normalize(const Tako::Quaternion& q) {
+        float inverseLength = 1.0f / std::sqrt(Dot(q, q));
+        return { q.x * inverseLength, q.y * inverseLength, q.z * inverseLength, q.w * inverseLength };
+    }
+
+    /// <summary>
+    /// 正規化線形補間（q1 は q0 と同じ半球にそろえてから補間する）
+    /// </summary>
+    inline Tako::Quaternion Nlerp(const Tako::Quaternion& q0, const Tako::Quaternion& q1, float t) {
+        float s1 = (Dot(q0, q1) < 0.0f) ? -t : t;
+        float s0 = 1.0f - t;
+        return Normalize({
+            q0.x * s0 + q1.x * s1,
+            q0.y * s0 + q1.y * s1,
+            q0.z * s0 + q1.z * s1,
+            q0.w * s0 + q1.w * s1
+        });
+    }
+
+}
@@ -558,6 +558,26 @@ void CameraAnimationEditor::DrawInspectorPanel() {
         ImGui::Separator();
     }
 
+    // Path Settings セクション
+    if (ImGui::CollapsingHeader("Path Settings", ImGuiTreeNodeFlags_DefaultOpen)) {
+        // 経路の種類選択
+        const char* pathTypes[] = { "Linear", "Catmull-Rom", "Centripetal" };
+        int pathTypeIndex = static_cast<int>(animation_->GetPathType());
+        if (ImGui::Combo("Path Type", &pathTypeIndex, pathTypes, 3)) {
+            animation_->SetPathType(static_cast<CameraAnimation::PathType>(pathTypeIndex));
+        }
+
+        // 曲線の区間を一定の速さで進むか
+        if (animation_->GetPathType() != CameraAnimation::PathType::LINEAR) {
+            bool constantSpeed = animation_->IsConstantSpeed();
+            if (ImGui::Checkbox("Constant Speed", &constantSpeed)) {
+                animation_->SetConstantSpeed(constantSpeed);
+            }
+        }
+
+        ImGui::Separator();
+    }
+
     // Target Settings セクション
     if (ImGui::CollapsingHeader("Target Settings", ImGuiTreeNodeFlags_DefaultOpen)) {
         // 現在のターゲット表示
@@ -123,11 +123,41 @@ namespace CameraConfig {
         /// </summary>
         inline constexpr size_t KEYFRAME_RESERVE_COUNT = 32;
 
+        /// <summary>
+        /// キーフレーム検索でカーソルを前後に動かす最大区間数（超えたら二分探索）
+        /// </summary>
+        inline constexpr int KEYFRAME_CURSOR_SEARCH_LIMIT = 4;
+
         /// <summary>
         /// デフォルト FOV（ラジアン）
         /// </summary>
         inline constexpr float DEFAULT_FOV = 0.45f;
 
+        /// <summary>
+        /// ベイク時のサンプリングレート（Hz）
+        /// </summary>
+        inline constexpr float BAKE_SAMPLE_RATE = 60.0f;
+
+        /// <summary>
+        /// ベイク時のキー削減で許す位置の誤差
+        /// </summary>
+        inline constexpr float BAKE_POSITION_TOLERANCE = 0.01f;
+
+        /// <summary>
+        /// ベイク時のキー削減で許す回転の誤差（ラジアン）
+        /// </summary>
+        inline constexpr float BAKE_ROTATION_TOLERANCE = 0.002f;
+
+        /// <summary>
+        /// ベイク時のキー削減で許す FOV の誤差（ラジアン）
+        /// </summary>
+        inline constexpr float BAKE_FOV_TOLERANCE = 0.001f;
+
+        /// <summary>
+        /// スプライン経路の弧長表の、1 区間あたりの分割数
+        /// </summary>
+        inline constexpr size_t ARC_LENGTH_TABLE_DIVISIONS = 32;
+
         /// <summary>
         /// デフォルトブレンド時間（秒）
         /// </summary>
@@ -1,4 +1,5 @@
 #include "CameraAnimationController.h"
+#include <chrono>
 
 using namespace Tako;
 
@@ -10,6 +11,9 @@ CameraAnimationController::CameraAnimationController() {
 }
 
 void CameraAnimationController::Update(float deltaTime) {
+    // 読み込みが終わった先読みを登録
+    InstallReadyPrefetches();
+
     auto* animation = GetCurrentAnimation();
     if (!animation || !camera_) {
         return;
@@ -87,6 +91,13 @@ void CameraAnimationController::SetAnimationTargetByName(const std::string& anim
     auto it = animations_.find(animationName);
     if (it != animations_.end()) {
         it->second->SetTarget(target);
+        return;
+    }
+
+    // 先読み中なら登録時に設定する
+    auto pending = pendingLoads_.find(animationName);
+    if (pending != pendingLoads_.end()) {
+        pending->second.target = target;
     }
 }
 
@@ -150,6 +161,13 @@ void CameraAnimationController::SetAnimationStartModeByName(const std::string& a
     if (it != animations_.end()) {
         it->second->SetStartMode(mode);
         it->second->SetBlendDuration(blendDuration);
+        return;
+    }
+
+    // 先読み中なら登録時に設定する（ファイルの設定より優先）
+    auto pending = pendingLoads_.find(animationName);
+    if (pending != pendingLoads_.end()) {
+        pending->second.startMode = std::make_pair(mode, blendDuration);
     }
 }
 
@@ -280,8 +298,8 @@ bool CameraAnimationController::CreateAnimation(const std::string& name) {
 }
 
 bool CameraAnimationController::SwitchAnimation(const std::string& name) {
-    // 存在チェック
-    if (animations_.find(name) == animations_.end()) {
+    // 未登録ならファイルから読み込む（先読み中なら完了を待つ）
+    if (animations_.find(name) == animations_.end() && !LoadAnimationFromFile(name)) {
         return false;
     }
 
@@ -385,20 +403,28 @@ bool CameraAnimationController::DuplicateAnimation(const std::string& sourceName
 
     // 設定をコピー
     animations_[newName]->SetLooping(source->IsLooping());
+    animations_[newName]->SetPathType(source->GetPathType());
+    animations_[newName]->SetConstantSpeed(source->IsConstantSpeed());
 
     return true;
 }
 
 bool CameraAnimationController::LoadAnimationFromFile(const std::string& name) {
+    // 先読み中なら、同じファイルを読み直さずに結果を待って登録する
+    auto pending = pendingLoads_.find(name);
+    if (pending != pendingLoads_.end()) {
+        return InstallPrefetch(pending);
+    }
+
     // 新規アニメーション作成
     if (!CreateAnimation(name)) {
         // 既に存在する場合は上書き確認が必要だが、ここでは単純に失敗とする
         return false;
     }
 
-    // JSON から読み込み（filepath を正しく渡す）
+    // バイナリ（無いか古ければ JSON）から読み込み
     auto* anim = GetAnimation(name);
-    if (!anim || !anim->LoadFromJson(name)) {
+    if (!anim || !anim->LoadFromFile(name)) {
         // 失敗した場合は削除
         DeleteAnimation(name);
         return false;
@@ -416,6 +442,84 @@ bool CameraAnimationController::SaveAnimationToFile(const std::string& name) {
     return anim->SaveToJson(name);
 }
 
+bool CameraAnimationController::BakeAnimation(const std::string& name, const BakedCameraTrack::BakeSettings& settings) {
+    auto* anim = GetAnimation(name);
+    if (anim) {
+        return anim->Bake(settings);
+    }
+
+    // 先読み中なら登録時にベイクする
+    auto pending = pendingLoads_.find(name);
+    if (pending == pendingLoads_.end()) {
+        return false;
+    }
+    pending->second.bakeSettings = settings;
+    return true;
+}
+
+bool CameraAnimationController::PrefetchAnimation(const std::string& name,
+    const std::optional<BakedCameraTrack::BakeSettings>& bakeSettings) {
+    if (animations_.contains(name) || pendingLoads_.contains(name)) {
+        return false;
+    }
+
+    // ワーカースレッドではファイルの読み込みと区間・ベイクの作成だけを行い、
+    // カメラ・ターゲットの設定や一覧への登録はメインスレッドで行う
+    PendingLoad& pending = pendingLoads_[name];
+    pending.result = std::async(std::launch::async, [name, bakeSettings]() -> std::unique_ptr<CameraAnimation> {
+        CameraAnimation::FileData data;
+        if (!CameraAnimation::ReadFile(name, data)) {
+            return nullptr;
+        }
+
+        auto animation = std::make_unique<CameraAnimation>();
+        animation->ApplyFileData(std::move(data));
+        if (bakeSettings) {
+            animation->Bake(*bakeSettings);
+        }
+        return animation;
+    });
+    return true;
+}
+
+void CameraAnimationController::InstallReadyPrefetches() {
+    for (auto it = pendingLoads_.begin(); it != pendingLoads_.end();) {
+        auto next = std::next(it);
+        if (it->second.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            InstallPrefetch(it);
+        }
+        it = next;
+    }
+}
+
+bool CameraAnimationController::InstallPrefetch(std::map<std::string, PendingLoad>::iterator it) {
+    std::string name = it->first;
+    PendingLoad pending = std::move(it->second);
+    pendingLoads_.erase(it);
+
+    // 読み込みに失敗した場合と、待つ間に同じ名前で作成された場合は捨てる
+    std::unique_ptr<CameraAnimation> animation = pending.result.get();
+    if (!animation || animations_.contains(name)) {
+        return false;
+    }
+
+    if (camera_) {
+        animation->SetCamera(camera_);
+    }
+    if (pending.target) {
+        animation->SetTarget(*pending.target);
+    }
+    if (pending.startMode) {
+        animation->SetStartMode(pending.startMode->first);
+        animation->SetBlendDuration(pending.startMode->second);
+    }
+    if (pending.bakeSettings) {
+        animation->Bake(*pending.bakeSettings);
+    }
+    animations_[name] = std::move(animation);
+    return true;
+}
+
 std::vector<std::string> CameraAnimationController::GetAnimationList() const {
     std::vector<std::string> names;
     names.reserve(animations_.size());
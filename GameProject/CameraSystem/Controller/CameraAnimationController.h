@@ -1,12 +1,17 @@
 #pragma once
 #include "ICameraController.h"
 #include "CameraAnimation/CameraAnimation.h"
+#include <future>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 
 /// <summary>
 /// カメラアニメーションコントローラー
 /// アニメーション再生を優先度システムで管理
+/// 未読み込みのアニメーションは SwitchAnimation 時にファイルから読み込み、
+/// PrefetchAnimation で指定したものはワーカースレッドで先に読み込んでおく
 /// </summary>
 class CameraAnimationController : public ICameraController {
 public:
@@ -16,7 +21,7 @@ public:
     CameraAnimationController();
 
     /// <summary>
-    /// デストラクタ
+    /// デストラクタ（先読み中のアニメーションは読み込みの完了を待つ）
     /// </summary>
     ~CameraAnimationController() override = default;
 
@@ -119,12 +124,23 @@ public:
     bool CreateAnimation(const std::string& name);
 
     /// <summary>
-    /// アニメーションを切り替え
+    /// アニメーションを切り替え（未読み込みならファイルから読み込む。先読み中なら完了を待つ）
     /// </summary>
     /// <param name="name">切り替え先のアニメーション名</param>
     /// <returns>切り替え成功した場合 true</returns>
     bool SwitchAnimation(const std::string& name);
 
+    /// <summary>
+    /// アニメーションをワーカースレッドで先読みする（すぐには使わないが近いうちに使うもの向け）
+    /// 読み込み結果は Update か SwitchAnimation で登録する。登録までの間の SetAnimationTargetByName・
+    /// SetAnimationStartModeByName・BakeAnimation は登録時に反映する
+    /// </summary>
+    /// <param name="name">アニメーション名</param>
+    /// <param name="bakeSettings">指定した場合はワーカースレッドでベイクまで行う</param>
+    /// <returns>先読みを開始した場合 true（読み込み済み・先読み中なら false）</returns>
+    bool PrefetchAnimation(const std::string& name,
+        const std::optional<BakedCameraTrack::BakeSettings>& bakeSettings = std::nullopt);
+
     /// <summary>
     /// アニメーションを削除
     /// </summary>
@@ -149,9 +165,8 @@ public:
     bool DuplicateAnimation(const std::string& sourceName, const std::string& newName);
 
     /// <summary>
-    /// アニメーションをファイルから読み込み
+    /// アニメーションをファイルから読み込み（バイナリ優先。先読み中なら完了を待って登録する）
     /// </summary>
-    /// <param name="filepath">JSON ファイルパス</param>
     /// <param name="name">アニメーション名</param>
     /// <returns>読み込み成功した場合 true</returns>
     bool LoadAnimationFromFile(const std::string& name);
@@ -164,6 +179,14 @@ public:
     /// <returns>保存成功した場合 true</returns>
     bool SaveAnimationToFile(const std::string& name);
 
+    /// <summary>
+    /// アニメーションを一定間隔のトラックにベイクする（出荷用のカットシーン向け。キーフレームを編集すると元に戻る）
+    /// </summary>
+    /// <param name="name">アニメーション名</param>
+    /// <param name="settings">ベイク設定</param>
+    /// <returns>ベイクできた場合 true</returns>
+    bool BakeAnimation(const std::string& name, const BakedCameraTrack::BakeSettings& settings = {});
+
     //==================== Setter ====================
 
     /// <summary>
@@ -289,7 +312,36 @@ public:
     /// <returns>現在のターゲット（設定されていない場合 nullptr）</returns>
     const Tako::Transform* GetAnimationTarget() const;
 
+    /// <summary>
+    /// 先読み中（未登録）かを判定
+    /// </summary>
+    /// <param name="name">アニメーション名</param>
+    /// <returns>先読み中の場合 true</returns>
+    bool IsAnimationPending(const std::string& name) const { return pendingLoads_.contains(name); }
+
 private:
+    /// <summary>
+    /// 先読み中のアニメーション
+    /// </summary>
+    struct PendingLoad {
+        std::future<std::unique_ptr<CameraAnimation>> result;               ///< 読み込み結果（失敗時は nullptr）
+        std::optional<const Tako::Transform*> target;                       ///< 登録時に設定するターゲット
+        std::optional<std::pair<CameraAnimation::StartMode, float>> startMode;  ///< 登録時に設定する開始モードとブレンド時間
+        std::optional<BakedCameraTrack::BakeSettings> bakeSettings;         ///< 登録時に行うベイクの設定
+    };
+
+    /// <summary>
+    /// 読み込みが終わった先読みを登録（待たない）
+    /// </summary>
+    void InstallReadyPrefetches();
+
+    /// <summary>
+    /// 先読みの結果を登録（読み込み中なら完了を待つ）
+    /// </summary>
+    /// <param name="it">先読み中のアニメーション</param>
+    /// <returns>登録できた場合 true</returns>
+    bool InstallPrefetch(std::map<std::string, PendingLoad>::iterator it);
+
     // カメラアニメーションオブジェクト（複数管理）
     std::map<std::string, std::unique_ptr<CameraAnimation>> animations_;
 
@@ -298,4 +350,7 @@ private:
 
     // 再生完了時に自動で非アクティブ化するかのフラグ
     bool autoDeactivateOnComplete_ = true;
+
+    // 先読み中のアニメーション（登録すると取り除く）
+    std::map<std::string, PendingLoad> pendingLoads_;
 };
\ No newline at end of file
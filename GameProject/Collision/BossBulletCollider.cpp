@@ -16,7 +16,7 @@ void BossBulletCollider::OnCollisionEnter(Collider* other) {
     if (other->GetTypeID() == static_cast<uint32_t>(CollisionTypeId::PLAYER)) {
         // 多重ヒット防止チェック
         void* targetPtr = other->GetOwner();
-        if (hitTargets_.find(targetPtr) != hitTargets_.end()) {
+        if (hitTargets_.Contains(targetPtr)) {
             return;  // 既にヒット済み
         }
 
@@ -24,7 +24,7 @@ void BossBulletCollider::OnCollisionEnter(Collider* other) {
         Player* player = static_cast<Player*>(other->GetOwner());
         if (player) {
             hitPlayer_ = player;
-            hitTargets_.insert(targetPtr);
+            hitTargets_.Insert(targetPtr);
 
             // パリィ判定
             if (player->IsParrying()) {
@@ -61,7 +61,7 @@ void BossBulletCollider::OnCollisionExit(Collider* other) {
 }
 
 void BossBulletCollider::Reset() {
-    hitTargets_.clear();
+    hitTargets_.Clear();
     hitPlayer_ = nullptr;
     hasDealtDamage_ = false;
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include "SphereCollider.h"
 #include "../Object/Projectile/BossBullet.h"
-#include <unordered_set>
+#include "HitTargetSet.h"
 
 class BossBullet;
 class Player;
@@ -57,7 +57,7 @@ private:
     BossBullet* owner_ = nullptr;
 
     // ヒット済みターゲット（多重ヒット防止用）
-    std::unordered_set<void*> hitTargets_;
+    HitTargetSet<void*> hitTargets_;
 
     // 現在ヒットしているプレイヤー
     Player* hitPlayer_ = nullptr;
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 多重ヒット防止用のヒット済みターゲットの集合
+/// 攻撃1回で当たる相手はほとんど 1～4 体なので、InlineCapacity 個までは本体の配列に持ち、ヒープを使わない
+/// 各要素には登録したときの世代を持たせ、Clear は世代を進めるだけにする（古い世代の要素は空きとして再利用する）
+/// プールで使い回す弾や攻撃判定は、リセットしても確保済みの領域を手放さない
+/// </summary>
+/// <template name="T">ターゲットの識別子（ポインタや ID など、== で比較できる型）</template>
+/// <template name="InlineCapacity">本体に持つ要素数</template>
+template<typename T, size_t InlineCapacity = 4>
+class HitTargetSet {
+public:
+    /// <summary>
+    /// ヒット済みか
+    /// </summary>
+    bool Contains(const T& target) const {
+        for (const Entry& entry : inline_) {
+            if (entry.generation == generation_ && entry.target == target) {
+                return true;
+            }
+        }
+        for (const Entry& entry : overflow_) {
+            if (entry.generation == generation_ && entry.target == target) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// ヒット済みとして登録
+    /// </summary>
+    /// <returns>新しく登録したら true（ヒット済みなら false）</returns>
+    bool Insert(const T& target) {
+        if (Contains(target)) {
+            return false;
+        }
+
+        // 古い世代の要素を空きとして使う（本体の配列から埋める）
+        Entry* slot = FindFreeSlot();
+        if (slot) {
+            slot->target = target;
+            slot->generation = generation_;
+        }
+        else {
+            overflow_.push_back({ target, generation_ });
+        }
+        ++count_;
+        return true;
+    }
+
+    /// <summary>
+    /// 全て削除（世代を進めるだけで要素には触れない）
+    /// </summary>
+    void Clear() {
+        count_ = 0;
+        if (++generation_ == 0) {
+            // 世代が一周したら、古い要素が現在の世代と一致しないように全て空にする
+            for (Entry& entry : inline_) {
+                entry.generation = 0;
+            }
+            for (Entry& entry : overflow_) {
+                entry.generation = 0;
+            }
+            generation_ = 1;
+        }
+    }
+
+    /// <summary>
+    /// 登録数
+    /// </summary>
+    size_t Size() const { return count_; }
+
+    /// <summary>
+    /// 空か
+    /// </summary>
+    bool Empty() const { return count_ == 0; }
+
+private:
+    /// <summary>
+    /// 要素（generation が現在の世代と違えば空き）
+    /// </summary>
+    struct Entry {
+        T target{};
+        uint32_t generation = 0;
+    };
+
+    /// <summary>
+    /// 空きの要素を探す
+    /// </summary>
+    /// <returns>空きの要素（無ければ nullptr）</returns>
+    Entry* FindFreeSlot() {
+        for (Entry& entry : inline_) {
+            if (entry.generation != generation_) {
+                return &entry;
+            }
+        }
+        for (Entry& entry : overflow_) {
+            if (entry.generation != generation_) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::array<Entry, InlineCapacity> inline_{};
+    std::vector<Entry> overflow_;   // InlineCapacity を超えた分（確保した容量は Clear 後も使い回す）
+    uint32_t generation_ = 1;       // 0 は空きの要素を表す
+    size_t count_ = 0;
+};
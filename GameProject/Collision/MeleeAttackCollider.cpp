@@ -45,7 +45,7 @@ void MeleeAttackCollider::OnCollisionStay(Collider* other) {
 }
 
 void MeleeAttackCollider::Reset() {
-    hitEnemies_.clear();
+    hitEnemies_.Clear();
     detectedEnemy_ = nullptr;
 #ifdef _DEBUG
     collisionCount_ = 0;
@@ -58,5 +58,5 @@ void MeleeAttackCollider::Damage()
 }
 
 bool MeleeAttackCollider::HasHitEnemy(uint32_t enemyId) const {
-    return hitEnemies_.find(enemyId) != hitEnemies_.end();
+    return hitEnemies_.Contains(enemyId);
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 #include "OBBCollider.h"
+#include "HitTargetSet.h"
 #include <vector>
-#include <unordered_set>
 
 class Player;
 class Boss;
@@ -13,7 +13,7 @@ class Boss;
 class MeleeAttackCollider : public Tako::OBBCollider {
 private:
     Player* player_ = nullptr;  ///< このコライダーを所有するプレイヤーへのポインタ
-    std::unordered_set<uint32_t> hitEnemies_;  ///< この攻撃で既にヒットした敵の ID セット（多重ヒット防止用）
+    HitTargetSet<uint32_t> hitEnemies_;  ///< この攻撃で既にヒットした敵の ID セット（多重ヒット防止用）
     Boss* detectedEnemy_ = nullptr;  ///< 現在検出されている敵への参照
     bool canDamage = false;  ///< ダメージを与えられる状態かどうか
     float attackDamage_ = 10.0f;  ///< 攻撃ダメージ量（GlobalVariables から取得）
@@ -17,7 +17,7 @@ void PenetratingBossBulletCollider::OnCollisionEnter(Tako::Collider* other) {
     if (other->GetTypeID() == static_cast<uint32_t>(CollisionTypeId::PLAYER)) {
         // 多重ヒット防止チェック
         void* targetPtr = other->GetOwner();
-        if (hitTargets_.find(targetPtr) != hitTargets_.end()) {
+        if (hitTargets_.Contains(targetPtr)) {
             return;  // 既にヒット済み
         }
 
@@ -25,7 +25,7 @@ void PenetratingBossBulletCollider::OnCollisionEnter(Tako::Collider* other) {
         Player* player = static_cast<Player*>(other->GetOwner());
         if (player) {
             hitPlayer_ = player;
-            hitTargets_.insert(targetPtr);
+            hitTargets_.Insert(targetPtr);
 
             // パリィ判定
             if (player->IsParrying()) {
@@ -58,7 +58,7 @@ void PenetratingBossBulletCollider::OnCollisionExit(Tako::Collider* other) {
 }
 
 void PenetratingBossBulletCollider::Reset() {
-    hitTargets_.clear();
+    hitTargets_.Clear();
     hitPlayer_ = nullptr;
     hasDealtDamage_ = false;
 }
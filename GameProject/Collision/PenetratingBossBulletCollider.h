@@ -1,7 +1,7 @@
 #pragma once
 
 #include "SphereCollider.h"
-#include <unordered_set>
+#include "HitTargetSet.h"
 
 class PenetratingBossBullet;
 class Player;
@@ -56,7 +56,7 @@ private:
     PenetratingBossBullet* owner_ = nullptr;
 
     // ヒット済みターゲット（多重ヒット防止用）
-    std::unordered_set<void*> hitTargets_;
+    HitTargetSet<void*> hitTargets_;
 
     // 現在ヒットしているプレイヤー
     Player* hitPlayer_ = nullptr;
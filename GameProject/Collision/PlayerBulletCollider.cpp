@@ -21,7 +21,7 @@ void PlayerBulletCollider::OnCollisionEnter(Collider* other) {
     if (other->GetTypeID() == static_cast<uint32_t>(CollisionTypeId::BOSS)) {
         // 多重ヒット防止チェック
         void* targetPtr = other->GetOwner();
-        if (hitTargets_.find(targetPtr) != hitTargets_.end()) {
+        if (hitTargets_.Contains(targetPtr)) {
             return;  // 既にヒット済み
         }
 
@@ -29,7 +29,7 @@ void PlayerBulletCollider::OnCollisionEnter(Collider* other) {
         Boss* boss = static_cast<Boss*>(other->GetOwner());
         if (boss) {
             hitBoss_ = boss;
-            hitTargets_.insert(targetPtr);
+            hitTargets_.Insert(targetPtr);
 
             // フェーズ移行スタン状態でなければダメージを与える
             if (!boss->IsInPhaseTransitionStun()) {
@@ -58,7 +58,7 @@ void PlayerBulletCollider::OnCollisionExit(Collider* other) {
 }
 
 void PlayerBulletCollider::Reset() {
-    hitTargets_.clear();
+    hitTargets_.Clear();
     hitBoss_ = nullptr;
     hasDealtDamage_ = false;
 }
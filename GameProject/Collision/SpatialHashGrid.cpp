@@ -0,0 +1,192 @@
+#include "SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Tako;
+
+void SpatialHashGrid::Initialize(const Vector3& min, const Vector3& max, float cellSize) {
+    origin_ = min;
+    inverseCellSize_ = 1.0f / cellSize;
+    cellCountX_ = std::max(1, static_cast<int32_t>(std::ceil((max.x - min.x) * inverseCellSize_)));
+    cellCountZ_ = std::max(1, static_cast<int32_t>(std::ceil((max.z - min.z) * inverseCellSize_)));
+
+    cells_.assign(static_cast<size_t>(cellCountX_) * cellCountZ_, {});
+    occupiedCells_.clear();
+    occupiedPositions_.assign(cells_.size(), kInvalidProxy);
+    proxies_.clear();
+    freeProxies_.clear();
+    queryStamp_ = 0;
+
+    stats_ = {};
+    stats_.cellCount = static_cast<uint32_t>(cells_.size());
+}
+
+void SpatialHashGrid::Clear() {
+    // セルの配列の容量は残して使い回す
+    for (uint32_t cell : occupiedCells_) {
+        cells_[cell].clear();
+        occupiedPositions_[cell] = kInvalidProxy;
+    }
+    occupiedCells_.clear();
+    proxies_.clear();
+    freeProxies_.clear();
+    stats_.proxyCount = 0;
+}
+
+SpatialHashGrid::ProxyId SpatialHashGrid::Add(const Aabb& box, uint32_t userData) {
+    ProxyId proxy;
+    if (!freeProxies_.empty()) {
+        proxy = freeProxies_.back();
+        freeProxies_.pop_back();
+    } else {
+        proxy = static_cast<ProxyId>(proxies_.size());
+        proxies_.emplace_back();
+    }
+
+    Proxy& data = proxies_[proxy];
+    data.box = box;
+    data.cells = ComputeCells(box);
+    data.userData = userData;
+    data.alive = true;
+    InsertCells(proxy, data.cells);
+
+    ++stats_.proxyCount;
+    return proxy;
+}
+
+void SpatialHashGrid::Move(ProxyId proxy, const Aabb& box) {
+    Proxy& data = proxies_[proxy];
+    data.box = box;
+
+    CellRange cells = ComputeCells(box);
+    if (cells == data.cells) {
+        return;
+    }
+    RemoveCells(proxy, data.cells);
+    InsertCells(proxy, cells);
+    data.cells = cells;
+    ++stats_.rebinCount;
+}
+
+void SpatialHashGrid::Remove(ProxyId proxy) {
+    if (proxy >= proxies_.size() || !proxies_[proxy].alive) {
+        return;
+    }
+
+    Proxy& data = proxies_[proxy];
+    RemoveCells(proxy, data.cells);
+    data.alive = false;
+    freeProxies_.push_back(proxy);
+    --stats_.proxyCount;
+}
+
+void SpatialHashGrid::FindPairs(std::vector<std::pair<uint32_t, uint32_t>>& outPairs) {
+    stats_.candidateCount = 0;
+
+    for (uint32_t cellIndex : occupiedCells_) {
+        const std::vector<ProxyId>& cell = cells_[cellIndex];
+        const int32_t x = static_cast<int32_t>(cellIndex % cellCountX_);
+        const int32_t z = static_cast<int32_t>(cellIndex / cellCountX_);
+        for (size_t i = 0; i < cell.size(); ++i) {
+            const Proxy& a = proxies_[cell[i]];
+            for (size_t j = i + 1; j < cell.size(); ++j) {
+                const Proxy& b = proxies_[cell[j]];
+
+                // 両方のセル範囲の重なりの最小の角のセルでだけ報告する
+                if (std::max(a.cells.minX, b.cells.minX) != x || std::max(a.cells.minZ, b.cells.minZ) != z) {
+                    continue;
+                }
+                ++stats_.candidateCount;
+                if (Overlaps(a.box, b.box)) {
+                    outPairs.emplace_back(a.userData, b.userData);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHashGrid::Query(const Aabb& box, std::vector<uint32_t>& outUserData) {
+    // 印の世代を進めて、複数のセルにまたがるプロキシを1度だけ返す
+    if (++queryStamp_ == 0) {
+        for (Proxy& proxy : proxies_) {
+            proxy.queryStamp = 0;
+        }
+        queryStamp_ = 1;
+    }
+
+    CellRange range = ComputeCells(box);
+    for (int32_t z = range.minZ; z <= range.maxZ; ++z) {
+        for (int32_t x = range.minX; x <= range.maxX; ++x) {
+            for (ProxyId proxy : cells_[static_cast<size_t>(z) * cellCountX_ + x]) {
+                Proxy& data = proxies_[proxy];
+                if (data.queryStamp == queryStamp_) {
+                    continue;
+                }
+                data.queryStamp = queryStamp_;
+                if (Overlaps(data.box, box)) {
+                    outUserData.push_back(data.userData);
+                }
+            }
+        }
+    }
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::ComputeCells(const Aabb& box) const {
+    auto toCell = [this](float value, float origin, int32_t count) {
+        int32_t cell = static_cast<int32_t>(std::floor((value - origin) * inverseCellSize_));
+        return std::clamp(cell, 0, count - 1);
+    };
+
+    CellRange range;
+    range.minX = toCell(box.min.x, origin_.x, cellCountX_);
+    range.maxX = toCell(box.max.x, origin_.x, cellCountX_);
+    range.minZ = toCell(box.min.z, origin_.z, cellCountZ_);
+    range.maxZ = toCell(box.max.z, origin_.z, cellCountZ_);
+    return range;
+}
+
+void SpatialHashGrid::InsertCells(ProxyId proxy, const CellRange& cells) {
+    for (int32_t z = cells.minZ; z <= cells.maxZ; ++z) {
+        for (int32_t x = cells.minX; x <= cells.maxX; ++x) {
+            uint32_t cellIndex = static_cast<uint32_t>(z * cellCountX_ + x);
+            std::vector<ProxyId>& cell = cells_[cellIndex];
+            if (cell.empty()) {
+                occupiedPositions_[cellIndex] = static_cast<uint32_t>(occupiedCells_.size());
+                occupiedCells_.push_back(cellIndex);
+            }
+            cell.push_back(proxy);
+        }
+    }
+}
+
+void SpatialHashGrid::RemoveCells(ProxyId proxy, const CellRange& cells) {
+    // セル内の順序は使わないので末尾と入れ替えて外す
+    for (int32_t z = cells.minZ; z <= cells.maxZ; ++z) {
+        for (int32_t x = cells.minX; x <= cells.maxX; ++x) {
+            uint32_t cellIndex = static_cast<uint32_t>(z * cellCountX_ + x);
+            std::vector<ProxyId>& cell = cells_[cellIndex];
+            auto it = std::find(cell.begin(), cell.end(), proxy);
+            if (it == cell.end()) {
+                continue;
+            }
+            *it = cell.back();
+            cell.pop_back();
+
+            // 空になったセルを空でないセルの一覧から外す
+            if (cell.empty()) {
+                uint32_t position = occupiedPositions_[cellIndex];
+                uint32_t last = occupiedCells_.back();
+                occupiedCells_[position] = last;
+                occupiedPositions_[last] = position;
+                occupiedCells_.pop_back();
+                occupiedPositions_[cellIndex] = kInvalidProxy;
+            }
+        }
+    }
+}
+
+bool SpatialHashGrid::Overlaps(const Aabb& a, const Aabb& b) {
+    return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+           a.min.y <= b.max.y && a.max.y >= b.min.y &&
+           a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
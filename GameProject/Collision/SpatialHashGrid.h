@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Vector3.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// ステージの範囲（XZ 平面）を一様なセルに分けた空間ハッシュ
+/// 登録した AABB を重なるセルすべてに入れておき、同じセルに入っているものだけを組として調べる
+/// 位置の更新は占めるセルの範囲が変わったときだけ入れ直すので、毎ティック作り直すより安い
+/// 範囲外の AABB は端のセルに寄せる（取りこぼしはせず、端のセルが混むだけ）
+/// 複数のセルにまたがる組は、2つの AABB の重なりの最小の角を含むセルでだけ報告し、重複させない
+/// 組を探すときは空でないセルだけを回るので、登録数が少ないときにセル数分の手間はかからない
+/// </summary>
+class SpatialHashGrid {
+public:
+    /// <summary>
+    /// プロキシ（登録したもの）の番号
+    /// </summary>
+    using ProxyId = uint32_t;
+
+    /// <summary>
+    /// 無効なプロキシ番号
+    /// </summary>
+    static constexpr ProxyId kInvalidProxy = UINT32_MAX;
+
+    /// <summary>
+    /// 軸に沿った箱
+    /// </summary>
+    struct Aabb {
+        Tako::Vector3 min;
+        Tako::Vector3 max;
+    };
+
+    /// <summary>
+    /// 統計
+    /// </summary>
+    struct Stats {
+        uint32_t cellCount = 0;         // セル数
+        uint32_t proxyCount = 0;        // 登録中のプロキシ数
+        uint64_t rebinCount = 0;        // セルを入れ直した回数（Move の累計）
+        uint64_t candidateCount = 0;    // 直前の FindPairs で同じセルにあった組の数
+    };
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    /// <param name="min">範囲の最小（X・Z を使う）</param>
+    /// <param name="max">範囲の最大（X・Z を使う）</param>
+    /// <param name="cellSize">セルの一辺</param>
+    void Initialize(const Tako::Vector3& min, const Tako::Vector3& max, float cellSize);
+
+    /// <summary>
+    /// 全プロキシを削除
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 登録
+    /// </summary>
+    /// <param name="box">AABB</param>
+    /// <param name="userData">FindPairs・Query で返す値</param>
+    /// <returns>プロキシ番号</returns>
+    ProxyId Add(const Aabb& box, uint32_t userData);
+
+    /// <summary>
+    /// AABB を更新（占めるセルが変わったときだけ入れ直す）
+    /// </summary>
+    /// <param name="proxy">プロキシ番号</param>
+    /// <param name="box">AABB</param>
+    void Move(ProxyId proxy, const Aabb& box);
+
+    /// <summary>
+    /// FindPairs・Query で返す値を差し替える
+    /// </summary>
+    /// <param name="proxy">プロキシ番号</param>
+    /// <param name="userData">値</param>
+    void SetUserData(ProxyId proxy, uint32_t userData) { proxies_[proxy].userData = userData; }
+
+    /// <summary>
+    /// 削除
+    /// </summary>
+    /// <param name="proxy">プロキシ番号</param>
+    void Remove(ProxyId proxy);
+
+    /// <summary>
+    /// AABB が重なる組をすべて集める（各組1度だけ。順序は保証しない）
+    /// </summary>
+    /// <param name="outPairs">userData の組の追加先（クリアはしない）</param>
+    void FindPairs(std::vector<std::pair<uint32_t, uint32_t>>& outPairs);
+
+    /// <summary>
+    /// AABB に重なるプロキシを集める（各プロキシ1度だけ）
+    /// </summary>
+    /// <param name="box">AABB</param>
+    /// <param name="outUserData">userData の追加先（クリアはしない）</param>
+    void Query(const Aabb& box, std::vector<uint32_t>& outUserData);
+
+    /// <summary>
+    /// 統計を取得
+    /// </summary>
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    /// <summary>
+    /// 占めるセルの範囲（両端を含む）
+    /// </summary>
+    struct CellRange {
+        int32_t minX = 0;
+        int32_t minZ = 0;
+        int32_t maxX = -1;
+        int32_t maxZ = -1;
+
+        bool operator==(const CellRange& other) const = default;
+    };
+
+    /// <summary>
+    /// プロキシ
+    /// </summary>
+    struct Proxy {
+        Aabb box;
+        CellRange cells;
+        uint32_t userData = 0;
+        uint32_t queryStamp = 0;    // Query での重複除け
+        bool alive = false;
+    };
+
+    /// <summary>
+    /// AABB が占めるセルの範囲（範囲外は端のセルに寄せる）
+    /// </summary>
+    CellRange ComputeCells(const Aabb& box) const;
+
+    /// <summary>
+    /// セルの範囲にプロキシを入れる / 外す
+    /// </summary>
+    void InsertCells(ProxyId proxy, const CellRange& cells);
+    void RemoveCells(ProxyId proxy, const CellRange& cells);
+
+    /// <summary>
+    /// AABB 同士が重なるか
+    /// </summary>
+    static bool Overlaps(const Aabb& a, const Aabb& b);
+
+    std::vector<std::vector<ProxyId>> cells_;
+    std::vector<uint32_t> occupiedCells_;       // 空でないセルの番号
+    std::vector<uint32_t> occupiedPositions_;   // セル番号 → occupiedCells_ 上の位置（空なら kInvalidProxy）
+    std::vector<Proxy> proxies_;
+    std::vector<ProxyId> freeProxies_;
+
+    Tako::Vector3 origin_;
+    float inverseCellSize_ = 1.0f;
+    int32_t cellCountX_ = 0;
+    int32_t cellCountZ_ = 0;
+    uint32_t queryStamp_ = 0;
+
+    Stats stats_;
+};
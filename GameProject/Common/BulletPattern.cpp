@@ -0,0 +1,201 @@
+#include "BulletPattern.h"
+#include "../BehaviorTree/Core/BTRandom.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+using namespace Tako;
+
+namespace {
+    // これより小さい角度は回転させず基準方向をそのまま使う
+    constexpr float kAngleEpsilon = 0.0001f;
+
+    constexpr std::array<const char*, static_cast<size_t>(BulletPatternType::Count)> kTypeNames = {
+        "Ring", "Fan", "Spiral", "RandomCone", "AimedBurst"
+    };
+
+    // 展開中の角度と弾速（スレッドごとに確保済みの領域を使い回す）
+    thread_local std::vector<float> scratchAngles;
+    thread_local std::vector<float> scratchSpeeds;
+}
+
+void BulletPattern::Expand(const BulletVolley& volley, BTRandom* random, std::vector<BulletSpawnRequest>& out) const {
+    const uint32_t total = static_cast<uint32_t>(std::max(count, 0));
+    const uint32_t first = std::min(volley.first, total);
+    const uint32_t n = std::min(volley.count, total - first);
+    if (n == 0) {
+        return;
+    }
+
+    scratchAngles.resize(n);
+    scratchSpeeds.resize(n);
+    float* angles = scratchAngles.data();
+    float* speeds = scratchSpeeds.data();
+
+    // 1. 弾ごとの角度と弾速
+    constexpr float kTwoPi = 2.0f * std::numbers::pi_v<float>;
+    switch (type) {
+    case BulletPatternType::Fan:
+        for (uint32_t i = 0; i < n; ++i) {
+            float angle = 0.0f;
+            if (total > 1) {
+                // -spreadAngle から +spreadAngle の範囲に均等に分散
+                float t = static_cast<float>(first + i) / static_cast<float>(total - 1);
+                angle = spreadAngle * (2.0f * t - 1.0f);
+            }
+            angles[i] = angle + angleOffset;
+        }
+        break;
+    case BulletPatternType::Ring:
+    case BulletPatternType::Spiral: {
+        float start = angleOffset;
+        if (type == BulletPatternType::Spiral) {
+            start += spiralStep * static_cast<float>(volley.index);
+        }
+        const float step = kTwoPi / static_cast<float>(total);
+        for (uint32_t i = 0; i < n; ++i) {
+            angles[i] = start + step * static_cast<float>(first + i);
+        }
+        break;
+    }
+    case BulletPatternType::RandomCone:
+        // 乱数の消費順（角度 → 弾速）は弾ごとに固定
+        for (uint32_t i = 0; i < n; ++i) {
+            angles[i] = random ? random->GetFloat(angleOffset - spreadAngle, angleOffset + spreadAngle) : angleOffset;
+            speeds[i] = (random && speedMax > speed) ? random->GetFloat(speed, speedMax) : speed;
+        }
+        break;
+    case BulletPatternType::AimedBurst:
+    default:
+        std::fill(angles, angles + n, angleOffset);
+        break;
+    }
+    if (type != BulletPatternType::RandomCone) {
+        for (uint32_t i = 0; i < n; ++i) {
+            speeds[i] = speed + speedStep * static_cast<float>(first + i);
+        }
+    }
+    if (volley.mirrored) {
+        for (uint32_t i = 0; i < n; ++i) {
+            angles[i] = -angles[i];
+        }
+    }
+
+    // 2. 速度ベクトルをまとめて計算し、連続した配列に書き込む
+    const size_t base = out.size();
+    out.resize(base + n);
+    BulletSpawnRequest* requests = out.data() + base;
+    const Vector3& dir = volley.direction;
+    for (uint32_t i = 0; i < n; ++i) {
+        Vector3 direction = dir;
+        if (std::abs(angles[i]) >= kAngleEpsilon) {
+            // Y 軸回転
+            float c = cosf(angles[i]);
+            float s = sinf(angles[i]);
+            direction.x = dir.x * c - dir.z * s;
+            direction.y = dir.y;
+            direction.z = dir.x * s + dir.z * c;
+            direction = direction.Normalize();
+        }
+        requests[i].position = volley.origin;
+        requests[i].velocity = direction * speeds[i];
+    }
+}
+
+void BulletPattern::ApplyParameters(const BTParameters& params) {
+    if (params.contains("type")) {
+        type = GetTypeFromName(params["type"].get<std::string>());
+    }
+    if (params.contains("count")) {
+        count = params["count"];
+    }
+    if (params.contains("speed")) {
+        speed = params["speed"];
+    }
+    if (params.contains("speedMax")) {
+        speedMax = params["speedMax"];
+    }
+    if (params.contains("speedStep")) {
+        speedStep = params["speedStep"];
+    }
+    if (params.contains("spreadAngle")) {
+        spreadAngle = params["spreadAngle"];
+    }
+    if (params.contains("angleOffset")) {
+        angleOffset = params["angleOffset"];
+    }
+    if (params.contains("spiralStep")) {
+        spiralStep = params["spiralStep"];
+    }
+}
+
+nlohmann::json BulletPattern::ToJson() const {
+    return {
+        {"type", GetTypeName(type)},
+        {"count", count},
+        {"speed", speed},
+        {"speedMax", speedMax},
+        {"speedStep", speedStep},
+        {"spreadAngle", spreadAngle},
+        {"angleOffset", angleOffset},
+        {"spiralStep", spiralStep}
+    };
+}
+
+#ifdef _DEBUG
+bool BulletPattern::DrawImGui(const char* idSuffix) {
+    bool changed = false;
+    std::string suffix = idSuffix;
+
+    int typeIndex = static_cast<int>(type);
+    if (ImGui::Combo(("Pattern" + suffix).c_str(), &typeIndex, kTypeNames.data(), static_cast<int>(kTypeNames.size()))) {
+        type = static_cast<BulletPatternType>(typeIndex);
+        changed = true;
+    }
+    if (ImGui::DragInt(("Bullet Count" + suffix).c_str(), &count, 1, 1, 512)) {
+        changed = true;
+    }
+    if (ImGui::DragFloat(("Speed" + suffix).c_str(), &speed, 1.0f, 1.0f, 100.0f)) {
+        changed = true;
+    }
+    if (type == BulletPatternType::RandomCone &&
+        ImGui::DragFloat(("Speed Max" + suffix).c_str(), &speedMax, 1.0f, 0.0f, 100.0f)) {
+        changed = true;
+    }
+    if (ImGui::DragFloat(("Speed Step" + suffix).c_str(), &speedStep, 0.1f, -20.0f, 20.0f)) {
+        changed = true;
+    }
+    if ((type == BulletPatternType::Fan || type == BulletPatternType::RandomCone) &&
+        ImGui::SliderAngle(("Spread Angle" + suffix).c_str(), &spreadAngle, 0.0f, 180.0f)) {
+        changed = true;
+    }
+    if (ImGui::SliderAngle(("Angle Offset" + suffix).c_str(), &angleOffset, -180.0f, 180.0f)) {
+        changed = true;
+    }
+    if (type == BulletPatternType::Spiral &&
+        ImGui::SliderAngle(("Spiral Step" + suffix).c_str(), &spiralStep, -90.0f, 90.0f)) {
+        changed = true;
+    }
+
+    return changed;
+}
+#endif
+
+const char* BulletPattern::GetTypeName(BulletPatternType type) {
+    size_t index = static_cast<size_t>(type);
+    return index < kTypeNames.size() ? kTypeNames[index] : "Fan";
+}
+
+BulletPatternType BulletPattern::GetTypeFromName(const std::string& name) {
+    for (size_t i = 0; i < kTypeNames.size(); ++i) {
+        if (name == kTypeNames[i]) {
+            return static_cast<BulletPatternType>(i);
+        }
+    }
+    return BulletPatternType::Fan;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "Vector3.h"
+#include "BulletSpawnRequest.h"
+#include "../BehaviorTree/Core/BTParameters.h"
+#include <json.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class BTRandom;
+
+/// <summary>
+/// 弾幕パターンの種類
+/// </summary>
+enum class BulletPatternType : uint8_t {
+    Ring,        // 全周に等間隔
+    Fan,         // 基準方向を中心に扇状に等間隔
+    Spiral,      // 全周に等間隔で、ボレーごとに回転させる
+    RandomCone,  // 基準方向を中心とした範囲にランダム
+    AimedBurst,  // 基準方向へ速度をずらして連ねる
+    Count
+};
+
+/// <summary>
+/// 1回の発射（ボレー）の指定
+/// </summary>
+struct BulletVolley {
+    Tako::Vector3 origin;                 ///< 発射位置
+    Tako::Vector3 direction;              ///< 基準方向（正規化済み）
+    uint32_t index = 0;                   ///< 何回目のボレーか（Spiral の回転に使う）
+    uint32_t first = 0;                   ///< 展開する最初の弾の番号
+    uint32_t count = UINT32_MAX;          ///< 展開する弾数（UINT32_MAX なら残りすべて）
+    bool mirrored = false;                ///< 角度を左右反転する
+};
+
+/// <summary>
+/// 宣言的な弾幕パターン
+/// ノードの JSON パラメータから読み込み、ボレーごとに弾生成リクエストの連続配列へまとめて展開する
+/// 角度と速度を配列で求めてから速度ベクトルを一括計算するため、数百発のボレーでも1回の呼び出しで済む
+/// 角度は Y 軸回りに x' = x*cos - z*sin, z' = x*sin + z*cos で回す
+/// </summary>
+struct BulletPattern {
+    BulletPatternType type = BulletPatternType::Fan;
+    int count = 3;                ///< 1ボレーの弾数
+    float speed = 20.0f;          ///< 弾速（RandomCone では最低速度）
+    float speedMax = 0.0f;        ///< RandomCone の最高速度（speed 以下なら固定）
+    float speedStep = 0.0f;       ///< 1発ごとの弾速の増分（AimedBurst など）
+    float spreadAngle = 0.3f;     ///< Fan / RandomCone の片側の広がり（ラジアン）
+    float angleOffset = 0.0f;     ///< 基準方向からの回転（ラジアン）
+    float spiralStep = 0.2f;      ///< Spiral のボレーごとの回転（ラジアン）
+
+    /// <summary>
+    /// ボレーを展開して out の末尾に追加
+    /// </summary>
+    /// <param name="volley">発射の指定</param>
+    /// <param name="random">乱数（RandomCone のみ使用、nullptr なら中心方向）</param>
+    /// <param name="out">追加先</param>
+    void Expand(const BulletVolley& volley, BTRandom* random, std::vector<BulletSpawnRequest>& out) const;
+
+    /// <summary>
+    /// パラメータを適用（含まれない項目は現在の値のまま）
+    /// </summary>
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params);
+
+    /// <summary>
+    /// パラメータを JSON として抽出
+    /// </summary>
+    nlohmann::json ToJson() const;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// ImGui でパラメータ編集 UI を描画
+    /// </summary>
+    /// <param name="idSuffix">ImGui の ID 接尾辞（"##pattern" など）</param>
+    /// <returns>パラメータ変更があれば true</returns>
+    bool DrawImGui(const char* idSuffix);
+#endif
+
+    /// <summary>
+    /// 種類の名前（JSON 用）
+    /// </summary>
+    static const char* GetTypeName(BulletPatternType type);
+
+    /// <summary>
+    /// 名前から種類を取得
+    /// </summary>
+    /// <returns>種類（不明なら Fan）</returns>
+    static BulletPatternType GetTypeFromName(const std::string& name);
+};
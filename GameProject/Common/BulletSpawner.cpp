@@ -1,15 +1,90 @@
 #include "BulletSpawner.h"
+#include "FrameArena.h"
+#include <algorithm>
 
 using namespace Tako;
 
+namespace {
+    // FrameArena に最初に確保する件数
+    constexpr size_t kInitialCapacity = 16;
+}
+
 void BulletSpawner::RequestSpawn(const Vector3& position, const Vector3& velocity)
 {
-    pendingBullets_.push_back({ position, velocity });
+    *Reserve(1) = { position, velocity };
+}
+
+void BulletSpawner::RequestSpawnBatch(std::span<const BulletSpawnRequest> requests)
+{
+    if (requests.empty()) {
+        return;
+    }
+    std::copy(requests.begin(), requests.end(), Reserve(requests.size()));
 }
 
-std::vector<BulletSpawnRequest> BulletSpawner::Consume()
+std::span<const BulletSpawnRequest> BulletSpawner::Consume()
 {
-    auto result = std::move(pendingBullets_);
-    pendingBullets_.clear();
+    if (useFallback_) {
+        // 返した分を残したまま、次のリクエストはもう一方の vector に積む
+        std::swap(fallbackPending_, fallbackConsumed_);
+        fallbackPending_.clear();
+        pendingCount_ = 0;
+        useFallback_ = false;
+        return fallbackConsumed_;
+    }
+
+    // 2フレーム以上前の領域は再利用されているので返さない
+    if (FrameArena::GetInstance()->GetFrameCount() > pendingFrame_ + 1) {
+        pendingCount_ = 0;
+    }
+
+    // 次のリクエストは新しく確保した領域に積み、今の領域はフレームの終わりまで残す
+    std::span<const BulletSpawnRequest> result = pending_.first(pendingCount_);
+    pending_ = {};
+    pendingCount_ = 0;
     return result;
 }
+
+void BulletSpawner::Clear()
+{
+    pending_ = {};
+    pendingCount_ = 0;
+    fallbackPending_.clear();
+    useFallback_ = false;
+}
+
+BulletSpawnRequest* BulletSpawner::Reserve(size_t count)
+{
+    FrameArena* arena = FrameArena::GetInstance();
+    uint64_t frame = arena->GetFrameCount();
+
+    // 前のフレームの領域は空きがあっても使わない（2フレーム以上前なら中身も残っていない）
+    bool stale = !useFallback_ && frame != pendingFrame_;
+    if (stale && frame > pendingFrame_ + 1) {
+        pendingCount_ = 0;
+    }
+
+    size_t required = pendingCount_ + count;
+    if (!useFallback_ && (stale || required > pending_.size())) {
+        // 倍々に確保し直して移す（古い領域はフレームの終わりにまとめて解放される）
+        size_t capacity = std::max({ kInitialCapacity, pending_.size() * 2, required });
+        std::span<BulletSpawnRequest> grown = arena->AllocateArray<BulletSpawnRequest>(capacity);
+        if (grown.empty()) {
+            // 確保できなければこのフレームは vector に切り替える
+            fallbackPending_.assign(pending_.begin(), pending_.begin() + pendingCount_);
+            pending_ = {};
+            useFallback_ = true;
+        } else {
+            std::copy(pending_.begin(), pending_.begin() + pendingCount_, grown.begin());
+            pending_ = grown;
+            pendingFrame_ = frame;
+        }
+    }
+
+    pendingCount_ = required;
+    if (useFallback_) {
+        fallbackPending_.resize(required);
+        return fallbackPending_.data() + (required - count);
+    }
+    return pending_.data() + (required - count);
+}
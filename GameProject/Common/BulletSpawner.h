@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <span>
 #include <vector>
 #include "Vector3.h"
 #include "BulletSpawnRequest.h"
@@ -7,6 +9,9 @@
 /// 弾生成リクエスト管理クラス
 /// Player/Boss 等のオブジェクトが弾の生成を GameScene に要求する際に使用
 /// コンポジション方式で使用する（継承不要）
+/// 保留中のリクエストは FrameArena 上に積み、Consume はその領域の span を返して次のリクエストは新しい領域に積む
+/// （FrameArena が2面持ちなので、返した span は次のフレームの終わりまで有効。積んだリクエストは毎フレーム Consume すること）
+/// FrameArena が未初期化・容量不足のときは、2本の vector を交互に使う
 /// </summary>
 class BulletSpawner
 {
@@ -21,29 +26,49 @@ public:
     /// <param name="velocity">弾の速度ベクトル</param>
     void RequestSpawn(const Tako::Vector3& position, const Tako::Vector3& velocity);
 
+    /// <summary>
+    /// 弾生成リクエストをまとめて追加（弾幕パターンのボレーなど）
+    /// </summary>
+    /// <param name="requests">弾生成リクエストの連続配列</param>
+    void RequestSpawnBatch(std::span<const BulletSpawnRequest> requests);
+
     /// <summary>
     /// 保留中の弾生成リクエストを取得して消費
     /// </summary>
-    /// <returns>弾生成リクエストのリスト（move で返される）</returns>
-    std::vector<BulletSpawnRequest> Consume();
+    /// <returns>弾生成リクエストの配列（次のフレームの終わりまで有効）</returns>
+    std::span<const BulletSpawnRequest> Consume();
 
     /// <summary>
     /// 保留中のリクエストがあるか
     /// </summary>
     /// <returns>保留中のリクエストがある場合 true</returns>
-    bool HasPending() const { return !pendingBullets_.empty(); }
+    bool HasPending() const { return pendingCount_ > 0; }
 
     /// <summary>
     /// 保留中のリクエスト数を取得
     /// </summary>
     /// <returns>保留中のリクエスト数</returns>
-    size_t GetPendingCount() const { return pendingBullets_.size(); }
+    size_t GetPendingCount() const { return pendingCount_; }
 
     /// <summary>
     /// 保留中のリクエストをクリア
     /// </summary>
-    void Clear() { pendingBullets_.clear(); }
+    void Clear();
 
 private:
-    std::vector<BulletSpawnRequest> pendingBullets_;
+    /// <summary>
+    /// 追加 count 件分の書き込み先を確保
+    /// </summary>
+    /// <returns>書き込み先の先頭</returns>
+    BulletSpawnRequest* Reserve(size_t count);
+
+    // FrameArena 上の保留中リクエスト（先頭 pendingCount_ 件が有効）
+    std::span<BulletSpawnRequest> pending_;
+    size_t pendingCount_ = 0;
+    uint64_t pendingFrame_ = 0;   ///< pending_ を確保したフレーム
+
+    // FrameArena を使えないときの保留中リクエストと、Consume で返した分
+    std::vector<BulletSpawnRequest> fallbackPending_;
+    std::vector<BulletSpawnRequest> fallbackConsumed_;
+    bool useFallback_ = false;
 };
@@ -31,6 +31,11 @@ void DamageFeedback::TriggerHitFeedback(const HitParams& params)
         vignetteParam);
 }
 
+void DamageFeedback::TriggerHitFeedback()
+{
+    TriggerHitFeedback(HitParams{});
+}
+
 void DamageFeedback::TriggerParryFeedback(
     const Vector3& position,
     EmitterManager* emitterManager,
@@ -70,3 +75,10 @@ void DamageFeedback::TriggerParryFeedback(
         params.vignetteDuration,
         vignetteParam);
 }
+
+void DamageFeedback::TriggerParryFeedback(
+    const Vector3& position,
+    EmitterManager* emitterManager)
+{
+    TriggerParryFeedback(position, emitterManager, ParryParams{});
+}
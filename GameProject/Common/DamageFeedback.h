@@ -48,8 +48,14 @@ public:
     /// 被弾フィードバックをトリガー
     /// カメラシェイク、ゲームパッド振動、Vignette エフェクトを同時発生
     /// </summary>
-    /// <param name="params">フィードバックパラメータ（デフォルト値で呼び出し可能）</param>
-    static void TriggerHitFeedback(const HitParams& params = HitParams{});
+    /// <param name="params">フィードバックパラメータ</param>
+    static void TriggerHitFeedback(const HitParams& params);
+
+    /// <summary>
+    /// 被弾フィードバックをデフォルトパラメータでトリガー
+    /// （入れ子構造体の既定引数は GCC / Clang でクラス定義完了前の使用になるため、オーバーロードで提供）
+    /// </summary>
+    static void TriggerHitFeedback();
 
     /// <summary>
     /// パリィ成功フィードバックをトリガー
@@ -57,11 +63,20 @@ public:
     /// </summary>
     /// <param name="position">エフェクト発生位置</param>
     /// <param name="emitterManager">エミッターマネージャー（nullptr の場合パーティクル省略）</param>
-    /// <param name="params">フィードバックパラメータ（デフォルト値で呼び出し可能）</param>
+    /// <param name="params">フィードバックパラメータ</param>
     static void TriggerParryFeedback(
         const Tako::Vector3& position,
         Tako::EmitterManager* emitterManager,
-        const ParryParams& params = ParryParams{});
+        const ParryParams& params);
+
+    /// <summary>
+    /// パリィ成功フィードバックをデフォルトパラメータでトリガー
+    /// </summary>
+    /// <param name="position">エフェクト発生位置</param>
+    /// <param name="emitterManager">エミッターマネージャー（nullptr の場合パーティクル省略）</param>
+    static void TriggerParryFeedback(
+        const Tako::Vector3& position,
+        Tako::EmitterManager* emitterManager);
 
 private:
     // インスタンス化禁止
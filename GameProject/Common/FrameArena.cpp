@@ -0,0 +1,58 @@
+#include "FrameArena.h"
+#include <algorithm>
+
+FrameArena* FrameArena::GetInstance() {
+    static FrameArena instance;
+    return &instance;
+}
+
+void FrameArena::Initialize(size_t bytesPerFrame) {
+    for (auto& buffer : buffers_) {
+        buffer = std::make_unique<std::byte[]>(bytesPerFrame);
+    }
+    current_ = 0;
+    offset_ = 0;
+
+    stats_ = {};
+    stats_.capacity = bytesPerFrame;
+}
+
+void FrameArena::Finalize() {
+    for (auto& buffer : buffers_) {
+        buffer.reset();
+    }
+    current_ = 0;
+    offset_ = 0;
+    stats_.capacity = 0;
+    stats_.used = 0;
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    std::byte* base = buffers_[current_].get();
+    if (!base) {
+        ++stats_.overflowCount;
+        return nullptr;
+    }
+
+    // 先頭アドレスを含めてアラインメントを揃える
+    uintptr_t address = reinterpret_cast<uintptr_t>(base) + offset_;
+    uintptr_t aligned = (address + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+    size_t begin = offset_ + static_cast<size_t>(aligned - address);
+    if (begin > stats_.capacity || size > stats_.capacity - begin) {
+        ++stats_.overflowCount;
+        return nullptr;
+    }
+
+    offset_ = begin + size;
+    stats_.used = offset_;
+    stats_.highWater = std::max(stats_.highWater, offset_);
+    return base + begin;
+}
+
+void FrameArena::EndFrame() {
+    // 前のフレームの面を空にして使う（今のフレームの面は次のフレームの終わりまで残る）
+    current_ ^= 1;
+    offset_ = 0;
+    stats_.used = 0;
+    ++frameCount_;
+}
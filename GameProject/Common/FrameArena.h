@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+/// <summary>
+/// フレーム単位の一時データ用のリニアアロケーター
+/// 弾生成リクエストなど、フレーム内で作って捨てるデータを先頭から詰めて確保し、フレーム終了時に O(1) でまとめて解放する
+/// 領域は2面持ち、EndFrame で面を切り替える。確保した領域は次のフレームの終わりまで有効
+/// （あるフレームの後半に作ったデータを、次のフレームの前半で読んでもよい）
+/// 個別の解放やデストラクタの呼び出しは行わないため、トリビアルに破棄できる型だけを扱う
+/// メインスレッド専用
+/// </summary>
+class FrameArena
+{
+public:
+    /// <summary>
+    /// 統計
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;         // 1面あたりのバイト数
+        size_t used = 0;             // 現在の面の使用バイト数
+        size_t highWater = 0;        // 1フレームの使用バイト数の最大値
+        uint64_t overflowCount = 0;  // 容量不足で確保できなかった回数
+    };
+
+    /// <summary>
+    /// インスタンスの取得
+    /// </summary>
+    /// <returns>インスタンス</returns>
+    static FrameArena* GetInstance();
+
+    /// <summary>
+    /// 初期化（2面分の領域を確保する。以後の確保では OS のヒープを使わない）
+    /// </summary>
+    /// <param name="bytesPerFrame">1面あたりのバイト数</param>
+    void Initialize(size_t bytesPerFrame);
+
+    /// <summary>
+    /// 領域の解放
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 生のメモリを確保
+    /// </summary>
+    /// <param name="size">バイト数</param>
+    /// <param name="alignment">アラインメント（2の累乗）</param>
+    /// <returns>確保した領域（容量不足なら nullptr）</returns>
+    void* Allocate(size_t size, size_t alignment);
+
+    /// <summary>
+    /// 配列を確保（要素は値初期化しない）
+    /// </summary>
+    /// <param name="count">要素数</param>
+    /// <returns>確保した配列（容量不足なら空）</returns>
+    template<typename T>
+    std::span<T> AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameArena does not run destructors");
+        if (count == 0) {
+            return {};
+        }
+        void* memory = Allocate(sizeof(T) * count, alignof(T));
+        if (!memory) {
+            return {};
+        }
+        return { static_cast<T*>(memory), count };
+    }
+
+    /// <summary>
+    /// フレームの終了（面を切り替え、新しい面を空にする）
+    /// 1フレームに1回、そのフレームの一時データを使い終えてから呼ぶ
+    /// </summary>
+    void EndFrame();
+
+    /// <summary>
+    /// これまでに EndFrame を呼んだ回数（確保した領域がどのフレームのものかの判定用）
+    /// </summary>
+    uint64_t GetFrameCount() const { return frameCount_; }
+
+    /// <summary>
+    /// 初期化済みか
+    /// </summary>
+    bool IsInitialized() const { return buffers_[0] != nullptr; }
+
+    /// <summary>
+    /// 統計を取得
+    /// </summary>
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    FrameArena() = default;
+    ~FrameArena() = default;
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // 2面分の領域
+    std::unique_ptr<std::byte[]> buffers_[2];
+
+    // 現在の面
+    uint32_t current_ = 0;
+
+    // 現在の面の使用位置
+    size_t offset_ = 0;
+
+    // EndFrame の回数
+    uint64_t frameCount_ = 0;
+
+    Stats stats_;
+};
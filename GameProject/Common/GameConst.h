@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
 /// <summary>
 /// ゲーム全体で使用する定数定義
@@ -15,6 +17,12 @@ namespace GameConst {
     inline constexpr float kStageZMin = -140.0f;
     inline constexpr float kStageZMax = 60.0f;
 
+    /// <summary>
+    /// 弾が存在できる高さの範囲（これを外れた弾は消える）
+    /// </summary>
+    inline constexpr float kProjectileYMin = -10.0f;
+    inline constexpr float kProjectileYMax = 50.0f;
+
     /// <summary>
     /// 方向ベクトルの有効判定閾値
     /// これより小さい長さのベクトルは無効とみなす
@@ -31,4 +39,26 @@ namespace GameConst {
     /// ボスフェーズ2の戦闘エリアの範囲
     /// </summary>
     inline constexpr float kBossPhase2AreaSize = 30.0f;
+
+    /// <summary>
+    /// 弾プールのスロット数（同時に存在できる弾の上限）
+    /// </summary>
+    inline constexpr uint32_t kBossBulletPoolSize = 256;
+    inline constexpr uint32_t kPenetratingBossBulletPoolSize = 64;
+    inline constexpr uint32_t kPlayerBulletPoolSize = 64;
+
+    /// <summary>
+    /// 衝突判定の空間ハッシュのセルの一辺（弾やプレイヤーの数倍の大きさ）
+    /// </summary>
+    inline constexpr float kCollisionCellSize = 5.0f;
+
+    /// <summary>
+    /// シミュレーションの1ティックの秒数（TimingWheel の単位）
+    /// </summary>
+    inline constexpr float kSimulationTickSeconds = 1.0f / 60.0f;
+
+    /// <summary>
+    /// フレーム単位の一時データ用領域の1面あたりのバイト数（FrameArena）
+    /// </summary>
+    inline constexpr size_t kFrameArenaSize = 256 * 1024;
 }
@@ -0,0 +1,64 @@
+#pragma once
+
+/// <summary>
+/// ゲームで使用する調整パラメータの GlobalVariables への登録
+/// ゲーム本体とヘッドレスシミュレーターで同じ既定値を使うために1か所にまとめる
+/// </summary>
+class GameVariables {
+public:
+    /// <summary>
+    /// すべてのパラメータを登録
+    /// </summary>
+    static void RegisterAll();
+
+private:
+    /// <summary>
+    /// 入力関連パラメータを登録
+    /// </summary>
+    static void RegisterInputVariables();
+
+    /// <summary>
+    /// ゲームシーン関連パラメータを登録
+    /// </summary>
+    static void RegisterGameSceneVariables();
+
+    /// <summary>
+    /// プレイヤー関連パラメータを登録
+    /// </summary>
+    static void RegisterPlayerVariables();
+
+    /// <summary>
+    /// ボス関連パラメータを登録
+    /// </summary>
+    static void RegisterBossVariables();
+
+    /// <summary>
+    /// 弾丸関連パラメータを登録
+    /// </summary>
+    static void RegisterProjectileVariables();
+
+    /// <summary>
+    /// 状態関連パラメータを登録
+    /// </summary>
+    static void RegisterStateVariables();
+
+    /// <summary>
+    /// AttackState 関連パラメータを登録
+    /// </summary>
+    static void RegisterAttackStateVariables();
+
+    /// <summary>
+    /// DashState 関連パラメータを登録
+    /// </summary>
+    static void RegisterDashStateVariables();
+
+    /// <summary>
+    /// ParryState 関連パラメータを登録
+    /// </summary>
+    static void RegisterParryStateVariables();
+
+    /// <summary>
+    /// ShootState 関連パラメータを登録
+    /// </summary>
+    static void RegisterShootStateVariables();
+};
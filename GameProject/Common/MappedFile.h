@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// 読み取り専用のメモリマップトファイル
+/// ファイル内容をコピーせずにアドレス空間へ割り当てて参照する
+/// </summary>
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// <summary>
+    /// ファイルを開いてマップする
+    /// </summary>
+    /// <param name="filepath">ファイルパス</param>
+    /// <returns>成功したら true（空ファイルは失敗扱い）</returns>
+    bool Open(const std::string& filepath);
+
+    /// <summary>
+    /// マップを解除してファイルを閉じる
+    /// </summary>
+    void Close();
+
+    /// <summary>
+    /// マップ済みかどうか
+    /// </summary>
+    /// <returns>マップ済みなら true</returns>
+    bool IsOpen() const { return data_ != nullptr; }
+
+    /// <summary>
+    /// 先頭アドレスの取得
+    /// </summary>
+    /// <returns>ファイル内容の先頭（未マップなら nullptr）</returns>
+    const uint8_t* GetData() const { return data_; }
+
+    /// <summary>
+    /// ファイルサイズの取得
+    /// </summary>
+    /// <returns>バイト数</returns>
+    size_t GetSize() const { return size_; }
+
+private:
+    // マップしたファイル内容
+    const uint8_t* data_ = nullptr;
+
+    // ファイルサイズ
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    // ファイルハンドル・マッピングハンドル
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
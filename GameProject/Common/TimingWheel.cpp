@@ -0,0 +1,188 @@
+#include "TimingWheel.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // 経過時間の端数の誤差で1ティック遅れないようにする許容量（ティックに対する割合）
+    constexpr float kTickTolerance = 1.0e-3f;
+}
+
+void TimingWheel::Initialize(uint32_t capacity, float tickSeconds) {
+    tickSeconds_ = tickSeconds;
+    nodes_.clear();
+    nodes_.reserve(capacity);
+    freeNodes_.clear();
+    freeNodes_.reserve(capacity);
+    fired_.clear();
+    fired_.reserve(capacity);
+    heads_.fill(kNil);
+
+    now_ = 0;
+    accumulator_ = 0.0f;
+    pendingCount_ = 0;
+}
+
+void TimingWheel::Clear() {
+    // 世代を進めて既存のハンドルを無効にする
+    for (uint32_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i].pending) {
+            nodes_[i].pending = false;
+            ++nodes_[i].generation;
+            freeNodes_.push_back(i);
+        }
+    }
+    heads_.fill(kNil);
+    fired_.clear();
+
+    now_ = 0;
+    accumulator_ = 0.0f;
+    pendingCount_ = 0;
+}
+
+TimerHandle TimingWheel::Schedule(uint64_t delayTicks, uint64_t userData) {
+    uint32_t index;
+    if (!freeNodes_.empty()) {
+        index = freeNodes_.back();
+        freeNodes_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    // 現在のスロットは処理済みなので、最短でも次のティックで発火させる
+    Node& node = nodes_[index];
+    node.expireTick = now_ + std::max<uint64_t>(delayTicks, 1);
+    node.userData = userData;
+    node.pending = true;
+    Insert(index);
+    ++pendingCount_;
+
+    return (static_cast<uint64_t>(node.generation) << 32) | index;
+}
+
+void TimingWheel::Cancel(TimerHandle handle) {
+    uint32_t index = Resolve(handle);
+    if (index == kNil) {
+        return;
+    }
+
+    Unlink(index);
+    nodes_[index].pending = false;
+    ++nodes_[index].generation;
+    freeNodes_.push_back(index);
+    --pendingCount_;
+}
+
+bool TimingWheel::IsPending(TimerHandle handle) const {
+    return Resolve(handle) != kNil;
+}
+
+uint64_t TimingWheel::GetRemainingTicks(TimerHandle handle) const {
+    uint32_t index = Resolve(handle);
+    return index == kNil ? 0 : nodes_[index].expireTick - now_;
+}
+
+std::span<const uint64_t> TimingWheel::Advance(float deltaTime) {
+    fired_.clear();
+
+    accumulator_ += deltaTime;
+    const float threshold = tickSeconds_ * (1.0f - kTickTolerance);
+    while (accumulator_ >= threshold) {
+        accumulator_ -= tickSeconds_;
+        Tick();
+    }
+    return fired_;
+}
+
+void TimingWheel::Tick() {
+    ++now_;
+
+    // 下の段が1周したら、上の段の次のスロットを振り分け直す
+    for (uint32_t level = 1; level < kLevelCount; ++level) {
+        if ((now_ & ((uint64_t{ 1 } << (kSlotBits * level)) - 1)) != 0) {
+            break;
+        }
+        Cascade(level);
+    }
+
+    // 現在のスロットのタイマーを発火させる
+    uint32_t bucket = static_cast<uint32_t>(now_ & (kSlotCount - 1));
+    uint32_t index = heads_[bucket];
+    heads_[bucket] = kNil;
+    while (index != kNil) {
+        Node& node = nodes_[index];
+        uint32_t next = node.next;
+        fired_.push_back(node.userData);
+        node.pending = false;
+        ++node.generation;
+        freeNodes_.push_back(index);
+        --pendingCount_;
+        index = next;
+    }
+}
+
+uint64_t TimingWheel::SecondsToTicks(float seconds) const {
+    if (seconds <= 0.0f || tickSeconds_ <= 0.0f) {
+        return 0;
+    }
+    return static_cast<uint64_t>(std::ceil(seconds / tickSeconds_ - kTickTolerance));
+}
+
+void TimingWheel::Insert(uint32_t index) {
+    Node& node = nodes_[index];
+
+    // 残りティック数が収まる最も下の段を選ぶ（最上段に収まらなければ最上段の一番先に置いて、周回ごとに置き直す）
+    uint64_t delta = node.expireTick - now_;
+    uint32_t level = 0;
+    while (level + 1 < kLevelCount && delta >= (uint64_t{ 1 } << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+    uint64_t maxDelta = (uint64_t{ 1 } << (kSlotBits * kLevelCount)) - 1;
+    uint64_t tick = now_ + std::min(delta, maxDelta);
+    uint32_t slot = static_cast<uint32_t>((tick >> (kSlotBits * level)) & (kSlotCount - 1));
+
+    node.bucket = static_cast<uint16_t>(level * kSlotCount + slot);
+    node.prev = kNil;
+    node.next = heads_[node.bucket];
+    if (node.next != kNil) {
+        nodes_[node.next].prev = index;
+    }
+    heads_[node.bucket] = index;
+}
+
+void TimingWheel::Unlink(uint32_t index) {
+    Node& node = nodes_[index];
+    if (node.prev != kNil) {
+        nodes_[node.prev].next = node.next;
+    } else {
+        heads_[node.bucket] = node.next;
+    }
+    if (node.next != kNil) {
+        nodes_[node.next].prev = node.prev;
+    }
+    node.prev = kNil;
+    node.next = kNil;
+}
+
+void TimingWheel::Cascade(uint32_t level) {
+    uint32_t slot = static_cast<uint32_t>((now_ >> (kSlotBits * level)) & (kSlotCount - 1));
+    uint32_t bucket = level * kSlotCount + slot;
+
+    uint32_t index = heads_[bucket];
+    heads_[bucket] = kNil;
+    while (index != kNil) {
+        uint32_t next = nodes_[index].next;
+        Insert(index);
+        index = next;
+    }
+}
+
+uint32_t TimingWheel::Resolve(TimerHandle handle) const {
+    uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+    uint32_t generation = static_cast<uint32_t>(handle >> 32);
+    if (handle == kInvalidTimerHandle || index >= nodes_.size()) {
+        return kNil;
+    }
+    const Node& node = nodes_[index];
+    return (node.pending && node.generation == generation) ? index : kNil;
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// <summary>
+/// タイマーのハンドル（世代と番号を詰めたもの）
+/// </summary>
+using TimerHandle = uint64_t;
+
+/// <summary>
+/// 無効なタイマーハンドル
+/// </summary>
+inline constexpr TimerHandle kInvalidTimerHandle = UINT64_MAX;
+
+/// <summary>
+/// 固定のシミュレーションティックを単位とした階層型タイミングホイール
+/// 64 スロット × 4 段の輪に期限ごとのタイマーを連結リストでつなぎ、登録・取り消しを O(1) で行う
+/// ティックを進めるときは現在のスロットのタイマーだけを発火させ、上の段のスロットは1周ごとに下の段へ振り分け直す
+/// 期限の遠いタイマーは発火するまでほとんど触らないため、寿命やタイムアウトを毎フレーム確認する必要がない
+/// 発火したタイマーはコールバックの代わりに登録時の値を GetFired に集める
+/// </summary>
+class TimingWheel
+{
+public:
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    /// <param name="capacity">同時に登録するタイマー数の目安（超えた分は追加で確保する）</param>
+    /// <param name="tickSeconds">1ティックの秒数</param>
+    void Initialize(uint32_t capacity, float tickSeconds);
+
+    /// <summary>
+    /// 全タイマーを取り消し、時刻を 0 に戻す
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// タイマーを登録
+    /// </summary>
+    /// <param name="delayTicks">発火までのティック数（0 は次のティック扱い）</param>
+    /// <param name="userData">発火時に GetFired に入る値</param>
+    /// <returns>ハンドル</returns>
+    TimerHandle Schedule(uint64_t delayTicks, uint64_t userData);
+
+    /// <summary>
+    /// 秒数を指定してタイマーを登録（ティック数に切り上げる）
+    /// </summary>
+    /// <param name="delaySeconds">発火までの秒数</param>
+    /// <param name="userData">発火時に GetFired に入る値</param>
+    /// <returns>ハンドル</returns>
+    TimerHandle ScheduleSeconds(float delaySeconds, uint64_t userData) { return Schedule(SecondsToTicks(delaySeconds), userData); }
+
+    /// <summary>
+    /// タイマーを取り消す（発火済み・取り消し済みのハンドルは無視する）
+    /// </summary>
+    /// <param name="handle">ハンドル</param>
+    void Cancel(TimerHandle handle);
+
+    /// <summary>
+    /// タイマーが発火待ちか
+    /// </summary>
+    bool IsPending(TimerHandle handle) const;
+
+    /// <summary>
+    /// 発火までの残りティック数（発火待ちでなければ 0）
+    /// </summary>
+    uint64_t GetRemainingTicks(TimerHandle handle) const;
+
+    /// <summary>
+    /// 経過時間分のティックを進める（端数は次回に持ち越す）
+    /// </summary>
+    /// <param name="deltaTime">経過時間（秒）</param>
+    /// <returns>今回発火したタイマーの値（次の Advance まで有効）</returns>
+    std::span<const uint64_t> Advance(float deltaTime);
+
+    /// <summary>
+    /// 1ティック進める（発火したタイマーの値は GetFired に追加する）
+    /// </summary>
+    void Tick();
+
+    /// <summary>
+    /// 直前の Advance で発火したタイマーの値
+    /// </summary>
+    std::span<const uint64_t> GetFired() const { return fired_; }
+
+    /// <summary>
+    /// 秒数をティック数に切り上げる
+    /// </summary>
+    uint64_t SecondsToTicks(float seconds) const;
+
+    /// <summary>
+    /// 現在のティック
+    /// </summary>
+    uint64_t GetCurrentTick() const { return now_; }
+
+    /// <summary>
+    /// 発火待ちのタイマー数
+    /// </summary>
+    uint32_t GetPendingCount() const { return pendingCount_; }
+
+private:
+    static constexpr uint32_t kSlotBits = 6;
+    static constexpr uint32_t kSlotCount = 1u << kSlotBits;   // 1段あたりのスロット数
+    static constexpr uint32_t kLevelCount = 4;                  // 段数（64^4 ティック先まで）
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    /// <summary>
+    /// タイマー（スロットごとの双方向リストの要素）
+    /// </summary>
+    struct Node {
+        uint64_t expireTick = 0;
+        uint64_t userData = 0;
+        uint32_t prev = kNil;
+        uint32_t next = kNil;
+        uint32_t generation = 0;
+        uint16_t bucket = 0;       // 段 * kSlotCount + スロット
+        bool pending = false;
+    };
+
+    /// <summary>
+    /// 期限に応じたスロットへつなぐ
+    /// </summary>
+    void Insert(uint32_t index);
+
+    /// <summary>
+    /// スロットから外す
+    /// </summary>
+    void Unlink(uint32_t index);
+
+    /// <summary>
+    /// 上の段のスロットのタイマーを、現在時刻から見た段へ振り分け直す
+    /// </summary>
+    void Cascade(uint32_t level);
+
+    /// <summary>
+    /// ハンドルから有効なタイマーの番号を取得
+    /// </summary>
+    /// <returns>番号（無効なら kNil）</returns>
+    uint32_t Resolve(TimerHandle handle) const;
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> freeNodes_;
+    std::array<uint32_t, kSlotCount * kLevelCount> heads_{};
+
+    std::vector<uint64_t> fired_;
+
+    uint64_t now_ = 0;
+    float tickSeconds_ = 1.0f / 60.0f;
+    float accumulator_ = 0.0f;
+    uint32_t pendingCount_ = 0;
+};
@@ -0,0 +1,98 @@
+#include "EmitterHandlePool.h"
+#include "EmitterManager.h"
+#include <string>
+
+using namespace Tako;
+
+void EmitterHandlePool::Initialize(EmitterManager* emitterManager, const std::string& presetName, uint32_t capacity) {
+    emitterManager_ = emitterManager;
+
+    // 名前の生成とプリセットの読み込みはここでまとめて行う
+    names_.clear();
+    temporaryNames_.clear();
+    names_.reserve(capacity);
+    temporaryNames_.reserve(capacity);
+    for (uint32_t i = 0; i < capacity; ++i) {
+        names_.push_back(presetName + std::to_string(i));
+        temporaryNames_.push_back(names_.back() + "temp");
+        if (emitterManager_) {
+            emitterManager_->LoadPreset(presetName, names_.back());
+            emitterManager_->SetEmitterActive(names_.back(), false);
+        }
+    }
+
+    pendingPositions_.clear();
+    pendingPositions_.reserve(capacity);
+
+    freeList_.resize(capacity);
+    for (uint32_t i = 0; i < capacity; ++i) {
+        freeList_[i] = i;
+    }
+    freeHead_ = 0;
+    freeCount_ = capacity;
+}
+
+void EmitterHandlePool::Finalize() {
+    if (emitterManager_) {
+        for (const std::string& name : names_) {
+            emitterManager_->RemoveEmitter(name);
+        }
+    }
+    names_.clear();
+    temporaryNames_.clear();
+    pendingPositions_.clear();
+    freeList_.clear();
+    freeHead_ = 0;
+    freeCount_ = 0;
+}
+
+EmitterHandle EmitterHandlePool::Acquire() {
+    if (freeCount_ == 0) {
+        return kInvalidEmitterHandle;
+    }
+
+    EmitterHandle handle = freeList_[freeHead_];
+    freeHead_ = (freeHead_ + 1) % Capacity();
+    --freeCount_;
+    return handle;
+}
+
+void EmitterHandlePool::Release(EmitterHandle handle) {
+    if (handle >= Capacity()) {
+        return;
+    }
+
+    SetActive(handle, false);
+    freeList_[(freeHead_ + freeCount_) % Capacity()] = handle;
+    ++freeCount_;
+}
+
+void EmitterHandlePool::SetActive(EmitterHandle handle, bool active) {
+    if (emitterManager_ && handle < Capacity()) {
+        emitterManager_->SetEmitterActive(names_[handle], active);
+    }
+}
+
+void EmitterHandlePool::SubmitPosition(EmitterHandle handle, const Vector3& position) {
+    if (handle < Capacity()) {
+        pendingPositions_.push_back({ handle, position });
+    }
+}
+
+void EmitterHandlePool::Flush() {
+    if (emitterManager_) {
+        for (const PositionUpdate& update : pendingPositions_) {
+            emitterManager_->SetEmitterPosition(names_[update.handle], update.position);
+        }
+    }
+    pendingPositions_.clear();
+}
+
+void EmitterHandlePool::SpawnTemporary(EmitterHandle handle, const Vector3& position, float duration) {
+    if (!emitterManager_ || handle >= Capacity()) {
+        return;
+    }
+
+    emitterManager_->SetEmitterPosition(names_[handle], position);
+    emitterManager_->CreateTemporaryEmitterFrom(names_[handle], temporaryNames_[handle], duration);
+}
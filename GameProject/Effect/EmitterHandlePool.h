@@ -0,0 +1,112 @@
+#pragma once
+#include "Vector3.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Tako {
+    class EmitterManager;
+}
+
+/// <summary>
+/// エミッターのハンドル（EmitterHandlePool 内の番号）
+/// </summary>
+using EmitterHandle = uint32_t;
+
+/// <summary>
+/// 無効なエミッターハンドル
+/// </summary>
+inline constexpr EmitterHandle kInvalidEmitterHandle = UINT32_MAX;
+
+/// <summary>
+/// 同じプリセットのエミッターを固定数まとめて管理するプール
+/// エミッター名の生成とプリセットの読み込みは初期化時の1度だけ行い、以後は整数のハンドルで操作する
+/// 位置の更新はフレーム中に配列へ積み、Flush でまとめて EmitterManager に送る
+/// 空きハンドルは FIFO で再利用し、解放直後のハンドルの一時エミッター名がすぐ使い回されないようにする
+/// </summary>
+class EmitterHandlePool
+{
+public:
+    /// <summary>
+    /// 初期化（全ハンドル分のエミッターを生成して無効化しておく）
+    /// </summary>
+    /// <param name="emitterManager">エミッターマネージャー</param>
+    /// <param name="presetName">プリセット名（エミッター名は「プリセット名 + ハンドル」）</param>
+    /// <param name="capacity">ハンドル数</param>
+    void Initialize(Tako::EmitterManager* emitterManager, const std::string& presetName, uint32_t capacity);
+
+    /// <summary>
+    /// 終了処理（全エミッターを削除）
+    /// EmitterManager の破棄より前に呼ぶこと
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 空きハンドルを取得
+    /// </summary>
+    /// <returns>ハンドル（空きが無ければ kInvalidEmitterHandle）</returns>
+    EmitterHandle Acquire();
+
+    /// <summary>
+    /// ハンドルを返却（エミッターは無効化して残す）
+    /// </summary>
+    /// <param name="handle">ハンドル</param>
+    void Release(EmitterHandle handle);
+
+    /// <summary>
+    /// エミッターの有効・無効を切り替え
+    /// </summary>
+    /// <param name="handle">ハンドル</param>
+    /// <param name="active">有効にするなら true</param>
+    void SetActive(EmitterHandle handle, bool active);
+
+    /// <summary>
+    /// 位置の更新を積む（Flush まで EmitterManager には送らない）
+    /// </summary>
+    /// <param name="handle">ハンドル</param>
+    /// <param name="position">位置</param>
+    void SubmitPosition(EmitterHandle handle, const Tako::Vector3& position);
+
+    /// <summary>
+    /// 積んだ位置の更新をまとめて送る（1フレームに1回）
+    /// </summary>
+    void Flush();
+
+    /// <summary>
+    /// 指定位置にエミッターの一時コピーを生成（爆発などの単発エフェクト）
+    /// </summary>
+    /// <param name="handle">ハンドル</param>
+    /// <param name="position">生成位置</param>
+    /// <param name="duration">一時エミッターの寿命（秒）</param>
+    void SpawnTemporary(EmitterHandle handle, const Tako::Vector3& position, float duration);
+
+    /// <summary>
+    /// エミッター名を取得（デバッグ表示用）
+    /// </summary>
+    const std::string& GetName(EmitterHandle handle) const { return names_[handle]; }
+
+    /// <summary>
+    /// ハンドル数
+    /// </summary>
+    uint32_t Capacity() const { return static_cast<uint32_t>(names_.size()); }
+
+private:
+    /// <summary>
+    /// 積まれた位置の更新
+    /// </summary>
+    struct PositionUpdate {
+        EmitterHandle handle;
+        Tako::Vector3 position;
+    };
+
+    Tako::EmitterManager* emitterManager_ = nullptr;   ///< エミッターマネージャー
+
+    std::vector<std::string> names_;                   ///< ハンドルごとのエミッター名
+    std::vector<std::string> temporaryNames_;          ///< ハンドルごとの一時エミッター名
+
+    std::vector<PositionUpdate> pendingPositions_;     ///< 今フレームの位置の更新（確保済み）
+
+    std::vector<EmitterHandle> freeList_;              ///< 空きハンドルのリングバッファ
+    uint32_t freeHead_ = 0;                            ///< リングバッファの先頭
+    uint32_t freeCount_ = 0;                           ///< 空きハンドル数
+};
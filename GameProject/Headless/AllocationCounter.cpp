@@ -0,0 +1,60 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> allocationCount{ 0 };
+std::atomic<uint64_t> freeCount{ 0 };
+std::atomic<uint64_t> allocatedBytes{ 0 };
+
+void* Allocate(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t rounded = (size + align - 1) / align * align;
+    if (void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void Free(void* ptr) {
+    if (ptr) {
+        freeCount.fetch_add(1, std::memory_order_relaxed);
+        std::free(ptr);
+    }
+}
+
+} // namespace
+
+AllocationCounter::Snapshot AllocationCounter::Capture() {
+    return {
+        allocationCount.load(std::memory_order_relaxed),
+        freeCount.load(std::memory_order_relaxed),
+        allocatedBytes.load(std::memory_order_relaxed)
+    };
+}
+
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void operator delete(void* ptr) noexcept { Free(ptr); }
+void operator delete[](void* ptr) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { Free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { Free(ptr); }
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+
+/// <summary>
+/// グローバル new / delete の呼び出し回数・確保量の計測
+/// AllocationCounter.cpp が置換演算子を定義するため、ヘッドレスの実行ファイルにだけリンクする
+/// </summary>
+class AllocationCounter {
+public:
+    /// <summary>
+    /// 計測値
+    /// </summary>
+    struct Snapshot {
+        uint64_t allocations = 0;   // 確保回数
+        uint64_t frees = 0;         // 解放回数
+        uint64_t bytes = 0;         // 確保したバイト数の累計
+    };
+
+    /// <summary>
+    /// 現在の累計値を取得
+    /// </summary>
+    /// <returns>計測値</returns>
+    static Snapshot Capture();
+
+    /// <summary>
+    /// 2時点の差分
+    /// </summary>
+    /// <param name="begin">開始時点</param>
+    /// <param name="end">終了時点</param>
+    /// <returns>区間の計測値</returns>
+    static Snapshot Diff(const Snapshot& begin, const Snapshot& end) {
+        return { end.allocations - begin.allocations, end.frees - begin.frees, end.bytes - begin.bytes };
+    }
+};
@@ -0,0 +1,238 @@
+#include "BossFightSimulator.h"
+#include "../Object/Player/Player.h"
+#include "../Object/Boss/Boss.h"
+#include "../Object/Boss/BossBehaviorTree/BossBehaviorTree.h"
+#include "../Input/InputHandler.h"
+#include "../Collision/CollisionTypeIdDef.h"
+#include "../Common/GameConst.h"
+#include "../Common/FrameArena.h"
+#include "../Common/GameVariables.h"
+#include "Camera.h"
+#include "CollisionManager.h"
+#include "EmitterManager.h"
+#include "FrameTimer.h"
+#include "GlobalVariables.h"
+#include "RandomEngine.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace Tako;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// <summary>
+/// スコープの経過時間を加算するタイマー
+/// </summary>
+class ScopedTimer {
+public:
+    explicit ScopedTimer(double& accumulator) : accumulator_(accumulator), begin_(Clock::now()) {}
+    ~ScopedTimer() { accumulator_ += std::chrono::duration<double>(Clock::now() - begin_).count(); }
+
+private:
+    double& accumulator_;
+    Clock::time_point begin_;
+};
+
+} // namespace
+
+BossFightSimulator::BossFightSimulator() = default;
+
+BossFightSimulator::~BossFightSimulator() {
+    Teardown();
+}
+
+BossFightSimulator::Result BossFightSimulator::Run(const Config& config) {
+    Setup(config);
+
+    Result result;
+    emitterManager_->ResetCallCount();
+    AllocationCounter::Snapshot allocationBegin = AllocationCounter::Capture();
+    Clock::time_point begin = Clock::now();
+
+    while (result.ticks < config.maxTicks) {
+        Tick(config.deltaTime, result);
+        ++result.ticks;
+
+        if (boss_->IsDead()) {
+            result.outcome = Outcome::BossDefeated;
+            break;
+        }
+        if (player_->IsDead()) {
+            result.outcome = Outcome::PlayerDefeated;
+            break;
+        }
+    }
+
+    result.totalSeconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    result.allocations = AllocationCounter::Diff(allocationBegin, AllocationCounter::Capture());
+    result.emitterCallCount = emitterManager_->GetCallCount();
+    result.bossHp = boss_->GetHp();
+    result.playerHp = player_->GetHp();
+
+    Teardown();
+    return result;
+}
+
+const char* BossFightSimulator::GetSubsystemName(Subsystem subsystem) {
+    switch (subsystem) {
+    case Subsystem::Input:            return "Input";
+    case Subsystem::PlayerUpdate:     return "PlayerUpdate";
+    case Subsystem::BossUpdate:       return "BossUpdate";
+    case Subsystem::ProjectileSpawn:  return "ProjectileSpawn";
+    case Subsystem::ProjectileUpdate: return "ProjectileUpdate";
+    case Subsystem::Collision:        return "Collision";
+    default:                          return "Unknown";
+    }
+}
+
+const char* BossFightSimulator::GetOutcomeName(Outcome outcome) {
+    switch (outcome) {
+    case Outcome::BossDefeated:   return "BossDefeated";
+    case Outcome::PlayerDefeated: return "PlayerDefeated";
+    case Outcome::Timeout:        return "Timeout";
+    default:                      return "Unknown";
+    }
+}
+
+void BossFightSimulator::Setup(const Config& config) {
+    RandomEngine::GetInstance()->SetSeed(config.seed);
+    FrameTimer::GetInstance()->SetDeltaTime(config.deltaTime);
+
+    CollisionManager::GetInstance()->Initialize();
+
+    // MyGame::Initialize と同じ一時データ用領域
+    if (!FrameArena::GetInstance()->IsInitialized()) {
+        FrameArena::GetInstance()->Initialize(GameConst::kFrameArenaSize);
+    }
+
+    emitterManager_ = std::make_unique<EmitterManager>();
+    camera_ = std::make_unique<Camera>();
+
+    inputHandler_ = std::make_unique<InputHandler>();
+    inputHandler_->Initialize();
+    bot_.Initialize(config.seed);
+
+    player_ = std::make_unique<Player>();
+    player_->Initialize();
+    player_->SetCamera(camera_.get());
+    player_->SetInputHandler(inputHandler_.get());
+
+    boss_ = std::make_unique<Boss>();
+    boss_->Initialize();
+    boss_->SetPlayer(player_.get());
+    boss_->GetBehaviorTree()->SetRandomSeed(config.seed);
+    boss_->GetBehaviorTree()->SetUseCompiledTree(config.useCompiledTree);
+    boss_->SetIsPause(false);
+
+    player_->SetBoss(boss_.get());
+
+    // GameScene::SetCollisionMask と同じ組み合わせ
+    CollisionManager* collisionManager = CollisionManager::GetInstance();
+    collisionManager->SetCollisionMask(
+        static_cast<uint32_t>(CollisionTypeId::PLAYER_ATTACK),
+        static_cast<uint32_t>(CollisionTypeId::BOSS),
+        true);
+    collisionManager->SetCollisionMask(
+        static_cast<uint32_t>(CollisionTypeId::PLAYER),
+        static_cast<uint32_t>(CollisionTypeId::BOSS_ATTACK),
+        true);
+    collisionManager->SetCollisionMask(
+        static_cast<uint32_t>(CollisionTypeId::PLAYER_ATTACK),
+        static_cast<uint32_t>(CollisionTypeId::BOSS_ATTACK),
+        true);
+
+    boss_->SetEmitterManager(emitterManager_.get());
+    player_->SetEmitterManager(emitterManager_.get());
+
+    projectileManager_.Initialize(emitterManager_.get());
+}
+
+void BossFightSimulator::Teardown() {
+    projectileManager_.Finalize();
+
+    if (player_) {
+        player_->Finalize();
+    }
+    if (boss_) {
+        boss_->Finalize();
+    }
+    boss_.reset();
+    player_.reset();
+    inputHandler_.reset();
+    camera_.reset();
+    emitterManager_.reset();
+
+    CollisionManager::GetInstance()->Reset();
+}
+
+void BossFightSimulator::Tick(float deltaTime, Result& result) {
+    auto& seconds = result.subsystemSeconds;
+
+    {
+        ScopedTimer timer(seconds[static_cast<size_t>(Subsystem::Input)]);
+        bot_.Update(*player_, *boss_);
+        inputHandler_->Update();
+        UpdateArea();
+    }
+    {
+        ScopedTimer timer(seconds[static_cast<size_t>(Subsystem::PlayerUpdate)]);
+        player_->Update();
+    }
+    {
+        ScopedTimer timer(seconds[static_cast<size_t>(Subsystem::BossUpdate)]);
+        boss_->Update(deltaTime);
+    }
+    if (!boss_->GetBehaviorTree()->GetCurrentRunningNode()) {
+        ++result.treeIdleTicks;
+    }
+    {
+        ScopedTimer timer(seconds[static_cast<size_t>(Subsystem::ProjectileSpawn)]);
+        SpawnProjectiles();
+    }
+    {
+        ScopedTimer timer(seconds[static_cast<size_t>(Subsystem::ProjectileUpdate)]);
+        UpdateProjectiles(deltaTime);
+    }
+    {
+        ScopedTimer timer(seconds[static_cast<size_t>(Subsystem::Collision)]);
+        CollisionManager::GetInstance()->CheckAllCollisions();
+        projectileManager_.CheckCollisions(player_->GetBodyCollider(), player_->GetMeleeAttackCollider());
+    }
+
+    result.peakBulletCount = std::max(result.peakBulletCount, projectileManager_.GetActiveCount());
+    result.droppedBulletCount = projectileManager_.GetExhaustCount();
+
+    // MyGame::Update の最後と同じく、このティックの一時データをまとめて解放
+    FrameArena::GetInstance()->EndFrame();
+}
+
+void BossFightSimulator::UpdateArea() {
+    if (player_->IsDead() || boss_->IsDead()) {
+        return;
+    }
+
+    bool thirdPerson = false;
+    if (boss_->GetPhase() == 1) {
+        player_->ClearDynamicBounds();
+    }
+    else if (boss_->GetPhase() == 2) {
+        thirdPerson = true;
+        Vector3 bossPos = boss_->GetTransform().translate;
+        player_->SetDynamicBoundsFromCenter(bossPos, GameConst::kBossPhase2AreaSize, GameConst::kBossPhase2AreaSize);
+    }
+    player_->SetMode(thirdPerson);
+}
+
+void BossFightSimulator::SpawnProjectiles() {
+    // GameScene::CreateProjectiles と同じ順序
+    projectileManager_.SpawnBatch(ProjectileKind::BossBullet, boss_->ConsumePendingBullets());
+    projectileManager_.SpawnBatch(ProjectileKind::PenetratingBossBullet, boss_->ConsumePendingPenetratingBullets());
+    projectileManager_.SpawnBatch(ProjectileKind::PlayerBullet, player_->ConsumePendingBullets());
+}
+
+void BossFightSimulator::UpdateProjectiles(float deltaTime) {
+    // GameScene::UpdateProjectiles と同じ手順
+    projectileManager_.Update(deltaTime);
+}
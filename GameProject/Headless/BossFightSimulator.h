@@ -0,0 +1,133 @@
+#pragma once
+#include "AllocationCounter.h"
+#include "HeadlessPlayerBot.h"
+#include "../Object/Projectile/ProjectileManager.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Tako {
+class EmitterManager;
+class Camera;
+}
+
+class Player;
+class Boss;
+class InputHandler;
+
+/// <summary>
+/// ボス戦をウィンドウ・GPU なしで回すシミュレーター
+/// GameScene と同じ順序でプレイヤー・ボス・弾・衝突判定を更新し、サブシステムごとの時間と確保回数を計測する
+/// </summary>
+class BossFightSimulator {
+public:
+    /// <summary>
+    /// 計測するサブシステム
+    /// </summary>
+    enum class Subsystem : uint32_t {
+        Input,
+        PlayerUpdate,
+        BossUpdate,
+        ProjectileSpawn,
+        ProjectileUpdate,
+        Collision,
+        Count
+    };
+
+    /// <summary>
+    /// 戦闘の結果
+    /// </summary>
+    enum class Outcome {
+        BossDefeated,
+        PlayerDefeated,
+        Timeout
+    };
+
+    /// <summary>
+    /// シミュレーション設定
+    /// </summary>
+    struct Config {
+        uint32_t seed = 1;                  // 乱数シード（ボス・ボット・RandomEngine に使う）
+        float deltaTime = 1.0f / 60.0f;     // 固定ステップ
+        uint32_t maxTicks = 60 * 60 * 3;    // 打ち切りティック数
+        bool useCompiledTree = true;        // false ならボスのツリーをノードグラフのまま評価する（デバッグ用の評価方式の確認）
+    };
+
+    /// <summary>
+    /// 1戦分の計測結果
+    /// </summary>
+    struct Result {
+        Outcome outcome = Outcome::Timeout;
+        uint32_t ticks = 0;
+        double totalSeconds = 0.0;                                              // ティックループの実時間
+        std::array<double, static_cast<size_t>(Subsystem::Count)> subsystemSeconds{};
+        AllocationCounter::Snapshot allocations;                               // ティックループ中の確保
+        size_t peakBulletCount = 0;
+        uint64_t droppedBulletCount = 0;                                        // プールが空で見送った発射数
+        uint64_t emitterCallCount = 0;                                          // ティックループ中の EmitterManager 呼び出し数
+        uint32_t treeIdleTicks = 0;                                             // ボスのツリーに実行中のノードが無かったティック数
+        float bossHp = 0.0f;
+        float playerHp = 0.0f;
+    };
+
+    BossFightSimulator();
+    ~BossFightSimulator();
+
+    /// <summary>
+    /// 1戦を最後まで実行
+    /// </summary>
+    /// <param name="config">設定</param>
+    /// <returns>計測結果</returns>
+    Result Run(const Config& config);
+
+    /// <summary>
+    /// サブシステム名の取得
+    /// </summary>
+    static const char* GetSubsystemName(Subsystem subsystem);
+
+    /// <summary>
+    /// 結果名の取得
+    /// </summary>
+    static const char* GetOutcomeName(Outcome outcome);
+
+private:
+    /// <summary>
+    /// 戦闘の準備（GameScene::Initialize 相当）
+    /// </summary>
+    void Setup(const Config& config);
+
+    /// <summary>
+    /// 戦闘の後始末
+    /// </summary>
+    void Teardown();
+
+    /// <summary>
+    /// 1ティック分の更新
+    /// </summary>
+    void Tick(float deltaTime, Result& result);
+
+    /// <summary>
+    /// フェーズに応じた移動範囲とカメラモードの切り替え（GameScene::UpdateCameraMode 相当）
+    /// </summary>
+    void UpdateArea();
+
+    /// <summary>
+    /// 生成要求から弾を作成
+    /// </summary>
+    void SpawnProjectiles();
+
+    /// <summary>
+    /// 弾の更新と非アクティブな弾のスロットへの返却
+    /// </summary>
+    void UpdateProjectiles(float deltaTime);
+
+    std::unique_ptr<Tako::EmitterManager> emitterManager_;
+    std::unique_ptr<Tako::Camera> camera_;
+    std::unique_ptr<InputHandler> inputHandler_;
+    std::unique_ptr<Player> player_;
+    std::unique_ptr<Boss> boss_;
+    HeadlessPlayerBot bot_;
+
+    ProjectileManager projectileManager_;
+};
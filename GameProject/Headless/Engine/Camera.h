@@ -0,0 +1,27 @@
+#pragma once
+#include "Vector3.h"
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Camera
+/// </summary>
+class Camera {
+public:
+    void Update() {}
+
+    void SetTranslate(const Vector3& translate) { translate_ = translate; }
+    void SetRotate(const Vector3& rotate) { rotate_ = rotate; }
+    const Vector3& GetTranslate() const { return translate_; }
+    const Vector3& GetRotate() const { return rotate_; }
+    float GetRotateY() const { return rotate_.y; }
+    void SetFovY(float fovY) { fovY_ = fovY; }
+    float GetFovY() const { return fovY_; }
+
+private:
+    Vector3 translate_;
+    Vector3 rotate_;
+    float fovY_ = 0.45f;
+};
+
+}
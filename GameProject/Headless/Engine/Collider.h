@@ -0,0 +1,62 @@
+#pragma once
+#include "Transform.h"
+#include "Vector3.h"
+#include <cstdint>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版コライダー基底クラス
+/// </summary>
+class Collider {
+public:
+    /// <summary>
+    /// 形状の種類
+    /// </summary>
+    enum class Shape : uint8_t {
+        Sphere,
+        OBB
+    };
+
+    virtual ~Collider() = default;
+
+    virtual void OnCollisionEnter(Collider* other) {}
+    virtual void OnCollisionStay(Collider* other) {}
+    virtual void OnCollisionExit(Collider* other) {}
+
+    /// <summary>
+    /// 形状の取得
+    /// </summary>
+    virtual Shape GetShape() const = 0;
+
+    void SetTransform(const Transform* transform) { transform_ = transform; }
+    const Transform* GetTransform() const { return transform_; }
+
+    void SetOffset(const Vector3& offset) { offset_ = offset; }
+    const Vector3& GetOffset() const { return offset_; }
+
+    void SetTypeID(uint32_t typeId) { typeId_ = typeId; }
+    uint32_t GetTypeID() const { return typeId_; }
+
+    void SetOwner(void* owner) { owner_ = owner; }
+    void* GetOwner() const { return owner_; }
+
+    void SetActive(bool active) { isActive_ = active; }
+    bool IsActive() const { return isActive_; }
+
+    /// <summary>
+    /// ワールド空間の中心座標
+    /// </summary>
+    virtual Vector3 GetCenter() const {
+        return transform_ ? transform_->translate + offset_ : offset_;
+    }
+
+protected:
+    const Transform* transform_ = nullptr;
+    Vector3 offset_;
+    uint32_t typeId_ = 0;
+    void* owner_ = nullptr;
+    bool isActive_ = true;
+};
+
+}
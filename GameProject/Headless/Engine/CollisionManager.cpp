@@ -0,0 +1,254 @@
+#include "CollisionManager.h"
+#include "OBBCollider.h"
+#include "SphereCollider.h"
+#include "../../Common/GameConst.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Tako {
+
+namespace {
+
+bool SphereSphere(const SphereCollider* a, const SphereCollider* b) {
+    Vector3 diff = a->GetCenter() - b->GetCenter();
+    float radius = a->GetRadius() + b->GetRadius();
+    return Vector3::Dot(diff, diff) <= radius * radius;
+}
+
+bool SphereOBB(const SphereCollider* sphere, const OBBCollider* obb) {
+    // 球の中心を OBB のローカル空間に移し、最近接点までの距離で判定
+    Vector3 d = sphere->GetCenter() - obb->GetCenter();
+    Vector3 half = obb->GetSize() * 0.5f;
+    const float halfExtents[3] = { half.x, half.y, half.z };
+
+    Vector3 closest = obb->GetCenter();
+    for (int i = 0; i < 3; ++i) {
+        Vector3 axis = obb->GetAxis(i);
+        float distance = std::clamp(Vector3::Dot(d, axis), -halfExtents[i], halfExtents[i]);
+        closest += axis * distance;
+    }
+
+    Vector3 diff = sphere->GetCenter() - closest;
+    return Vector3::Dot(diff, diff) <= sphere->GetRadius() * sphere->GetRadius();
+}
+
+bool OBBOBB(const OBBCollider* a, const OBBCollider* b) {
+    // 分離軸判定（各ボックスの面法線3本ずつ + 辺の外積9本）
+    Vector3 axesA[3] = { a->GetAxis(0), a->GetAxis(1), a->GetAxis(2) };
+    Vector3 axesB[3] = { b->GetAxis(0), b->GetAxis(1), b->GetAxis(2) };
+    Vector3 halfA = a->GetSize() * 0.5f;
+    Vector3 halfB = b->GetSize() * 0.5f;
+    Vector3 d = b->GetCenter() - a->GetCenter();
+
+    auto separated = [&](const Vector3& axis) {
+        float lengthSq = Vector3::Dot(axis, axis);
+        if (lengthSq < 1e-8f) {
+            return false;  // 平行な辺の外積は判定に使わない
+        }
+        float ra = std::abs(Vector3::Dot(axesA[0], axis)) * halfA.x
+                 + std::abs(Vector3::Dot(axesA[1], axis)) * halfA.y
+                 + std::abs(Vector3::Dot(axesA[2], axis)) * halfA.z;
+        float rb = std::abs(Vector3::Dot(axesB[0], axis)) * halfB.x
+                 + std::abs(Vector3::Dot(axesB[1], axis)) * halfB.y
+                 + std::abs(Vector3::Dot(axesB[2], axis)) * halfB.z;
+        return std::abs(Vector3::Dot(d, axis)) > ra + rb;
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        if (separated(axesA[i]) || separated(axesB[i])) {
+            return false;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            if (separated(Vector3::Cross(axesA[i], axesB[j]))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+CollisionManager* CollisionManager::GetInstance() {
+    static CollisionManager instance;
+    return &instance;
+}
+
+void CollisionManager::Initialize() {
+    Reset();
+}
+
+void CollisionManager::Reset() {
+    // 弾が存在できる範囲全体にセルを張る（範囲外のコライダーは端のセルに入る）
+    grid_.Initialize(
+        { GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin },
+        { GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax },
+        GameConst::kCollisionCellSize);
+    proxies_.clear();
+
+    colliders_.clear();
+    previousContacts_.clear();
+    currentContacts_.clear();
+    previousSet_.clear();
+    currentSet_.clear();
+    std::fill(std::begin(masks_), std::end(masks_), 0u);
+    lastPairTestCount_ = 0;
+}
+
+void CollisionManager::AddCollider(Collider* collider) {
+    if (collider && std::find(colliders_.begin(), colliders_.end(), collider) == colliders_.end()) {
+        colliders_.push_back(collider);
+        proxies_.push_back(grid_.Add(ComputeBounds(collider), 0));
+    }
+}
+
+void CollisionManager::RemoveCollider(Collider* collider) {
+    auto it = std::find(colliders_.begin(), colliders_.end(), collider);
+    if (it != colliders_.end()) {
+        size_t index = static_cast<size_t>(it - colliders_.begin());
+        grid_.Remove(proxies_[index]);
+        colliders_.erase(it);
+        proxies_.erase(proxies_.begin() + index);
+    }
+
+    // 削除したコライダーとの接触記録も破棄（Exit は通知しない）
+    auto involves = [collider](const Contact& contact) { return contact.a == collider || contact.b == collider; };
+    std::erase_if(previousContacts_, involves);
+    std::erase_if(previousSet_, involves);
+}
+
+void CollisionManager::SetCollisionMask(uint32_t typeA, uint32_t typeB, bool enable) {
+    if (typeA >= kMaxTypes || typeB >= kMaxTypes) {
+        return;
+    }
+    if (enable) {
+        masks_[typeA] |= (1u << typeB);
+        masks_[typeB] |= (1u << typeA);
+    }
+    else {
+        masks_[typeA] &= ~(1u << typeB);
+        masks_[typeB] &= ~(1u << typeA);
+    }
+}
+
+bool CollisionManager::IsMaskEnabled(uint32_t typeA, uint32_t typeB) const {
+    return typeA < kMaxTypes && typeB < kMaxTypes && (masks_[typeA] & (1u << typeB)) != 0;
+}
+
+bool CollisionManager::Intersects(const Collider* a, const Collider* b) {
+    using Shape = Collider::Shape;
+    Shape shapeA = a->GetShape();
+    Shape shapeB = b->GetShape();
+
+    if (shapeA == Shape::Sphere && shapeB == Shape::Sphere) {
+        return SphereSphere(static_cast<const SphereCollider*>(a), static_cast<const SphereCollider*>(b));
+    }
+    if (shapeA == Shape::Sphere) {
+        return SphereOBB(static_cast<const SphereCollider*>(a), static_cast<const OBBCollider*>(b));
+    }
+    if (shapeB == Shape::Sphere) {
+        return SphereOBB(static_cast<const SphereCollider*>(b), static_cast<const OBBCollider*>(a));
+    }
+    return OBBOBB(static_cast<const OBBCollider*>(a), static_cast<const OBBCollider*>(b));
+}
+
+SpatialHashGrid::Aabb CollisionManager::ComputeBounds(const Collider* collider) {
+    Vector3 center = collider->GetCenter();
+    Vector3 extent;
+    if (collider->GetShape() == Collider::Shape::Sphere) {
+        float radius = static_cast<const SphereCollider*>(collider)->GetRadius();
+        extent = { radius, radius, radius };
+    }
+    else {
+        // 各軸の半分の長さをワールドの軸に射影した和
+        const OBBCollider* obb = static_cast<const OBBCollider*>(collider);
+        Vector3 half = obb->GetSize() * 0.5f;
+        const float halfExtents[3] = { half.x, half.y, half.z };
+        for (int i = 0; i < 3; ++i) {
+            Vector3 axis = obb->GetAxis(i);
+            extent.x += std::abs(axis.x) * halfExtents[i];
+            extent.y += std::abs(axis.y) * halfExtents[i];
+            extent.z += std::abs(axis.z) * halfExtents[i];
+        }
+    }
+    return { center - extent, center + extent };
+}
+
+void CollisionManager::CollectCandidates() {
+    // 位置を反映し（セルが変わったものだけ入れ直される）、組を snapshot_ の番号で受け取る
+    // （snapshot_ は colliders_ の写しなので proxies_ と同じ並び）
+    for (uint32_t i = 0; i < snapshot_.size(); ++i) {
+        grid_.Move(proxies_[i], ComputeBounds(snapshot_[i]));
+        grid_.SetUserData(proxies_[i], i);
+    }
+    grid_.FindPairs(candidates_);
+
+    // 総当たりと同じ通知順序にするため、登録順に並べる
+    for (auto& [a, b] : candidates_) {
+        if (a > b) {
+            std::swap(a, b);
+        }
+    }
+    std::sort(candidates_.begin(), candidates_.end());
+}
+
+void CollisionManager::TestPair(uint32_t i, uint32_t j) {
+    Collider* a = snapshot_[i];
+    Collider* b = snapshot_[j];
+    if (!a->IsActive() || !b->IsActive() || !IsMaskEnabled(a->GetTypeID(), b->GetTypeID())) {
+        return;
+    }
+
+    ++lastPairTestCount_;
+    if (Intersects(a, b)) {
+        currentContacts_.push_back({ a, b });
+        currentSet_.insert({ a, b });
+    }
+}
+
+void CollisionManager::CheckAllCollisions() {
+    lastPairTestCount_ = 0;
+    currentContacts_.clear();
+    currentSet_.clear();
+    snapshot_ = colliders_;
+
+    if (broadphaseEnabled_) {
+        candidates_.clear();
+        CollectCandidates();
+        for (const auto& [i, j] : candidates_) {
+            TestPair(i, j);
+        }
+    }
+    else {
+        for (uint32_t i = 0; i < snapshot_.size(); ++i) {
+            for (uint32_t j = i + 1; j < snapshot_.size(); ++j) {
+                TestPair(i, j);
+            }
+        }
+    }
+
+    // 通知（コールバック中にコライダーが削除されても判定結果は変えない）
+    for (const Contact& contact : currentContacts_) {
+        if (previousSet_.contains(contact)) {
+            contact.a->OnCollisionStay(contact.b);
+            contact.b->OnCollisionStay(contact.a);
+        }
+        else {
+            contact.a->OnCollisionEnter(contact.b);
+            contact.b->OnCollisionEnter(contact.a);
+        }
+    }
+    for (const Contact& contact : previousContacts_) {
+        if (!currentSet_.contains(contact)) {
+            contact.a->OnCollisionExit(contact.b);
+            contact.b->OnCollisionExit(contact.a);
+        }
+    }
+
+    std::swap(previousContacts_, currentContacts_);
+    std::swap(previousSet_, currentSet_);
+}
+
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "Collider.h"
+#include "../../Collision/SpatialHashGrid.h"
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 CollisionManager
+/// 登録されたコライダーをマスクで許可されたタイプの組だけ判定し、Enter / Stay / Exit を通知する（エンジン版と同じ通知順序）
+/// 組の候補はステージの範囲に張った SpatialHashGrid で絞り、登録順に並べ直してから形状を判定するので、
+/// 総当たりと同じ組を同じ順序で通知する（SetBroadphaseEnabled(false) で総当たりに戻せる）
+/// </summary>
+class CollisionManager {
+public:
+    static CollisionManager* GetInstance();
+
+    void Initialize();
+    void Reset();
+
+    void AddCollider(Collider* collider);
+    void RemoveCollider(Collider* collider);
+
+    /// <summary>
+    /// タイプの組の衝突判定を有効化 / 無効化
+    /// </summary>
+    void SetCollisionMask(uint32_t typeA, uint32_t typeB, bool enable);
+
+    /// <summary>
+    /// すべての衝突判定を実行
+    /// </summary>
+    void CheckAllCollisions();
+
+    void DrawColliders() {}
+
+    /// <summary>
+    /// 空間ハッシュで組の候補を絞るか（false なら総当たり。計測・検証用）
+    /// </summary>
+    void SetBroadphaseEnabled(bool enabled) { broadphaseEnabled_ = enabled; }
+    bool IsBroadphaseEnabled() const { return broadphaseEnabled_; }
+
+    /// <summary>
+    /// 空間ハッシュの統計
+    /// </summary>
+    const SpatialHashGrid::Stats& GetBroadphaseStats() const { return grid_.GetStats(); }
+
+    /// <summary>
+    /// 直近の CheckAllCollisions で形状判定を行った組の数
+    /// </summary>
+    uint64_t GetLastPairTestCount() const { return lastPairTestCount_; }
+
+    size_t GetColliderCount() const { return colliders_.size(); }
+
+private:
+    static constexpr uint32_t kMaxTypes = 32;
+
+    bool IsMaskEnabled(uint32_t typeA, uint32_t typeB) const;
+
+    static bool Intersects(const Collider* a, const Collider* b);
+
+    /// <summary>
+    /// コライダーを囲む AABB
+    /// </summary>
+    static SpatialHashGrid::Aabb ComputeBounds(const Collider* collider);
+
+    /// <summary>
+    /// 空間ハッシュで組の候補を登録順（snapshot_ の番号の小さい順）に集める
+    /// </summary>
+    void CollectCandidates();
+
+    /// <summary>
+    /// snapshot_ の2つのコライダーを判定し、接触していれば今回の接触に加える
+    /// </summary>
+    void TestPair(uint32_t i, uint32_t j);
+
+    /// <summary>
+    /// 接触中の組（登録順の小さい方が a）
+    /// </summary>
+    struct Contact {
+        Collider* a;
+        Collider* b;
+        bool operator==(const Contact& other) const { return a == other.a && b == other.b; }
+    };
+
+    struct ContactHash {
+        size_t operator()(const Contact& contact) const {
+            size_t h1 = std::hash<const void*>()(contact.a);
+            size_t h2 = std::hash<const void*>()(contact.b);
+            return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
+        }
+    };
+
+    std::vector<Collider*> colliders_;
+    uint32_t masks_[kMaxTypes] = {};
+
+    // 前回・今回の判定で接触していた組（配列は通知順、集合は検索用）
+    std::vector<Contact> previousContacts_;
+    std::vector<Contact> currentContacts_;
+    std::unordered_set<Contact, ContactHash> previousSet_;
+    std::unordered_set<Contact, ContactHash> currentSet_;
+
+    // 判定中のスナップショット（コールバック中の登録・削除に備える）
+    std::vector<Collider*> snapshot_;
+
+    // 空間ハッシュと colliders_ と同じ並びのプロキシ（userData は判定のたびに snapshot_ の番号に差し替える）
+    SpatialHashGrid grid_;
+    std::vector<SpatialHashGrid::ProxyId> proxies_;
+    std::vector<std::pair<uint32_t, uint32_t>> candidates_;
+    bool broadphaseEnabled_ = true;
+
+    uint64_t lastPairTestCount_ = 0;
+};
+
+}
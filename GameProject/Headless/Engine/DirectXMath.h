@@ -0,0 +1,15 @@
+#pragma once
+#include <numbers>
+
+/// <summary>
+/// ヘッドレス版 DirectXMath（ゲーム側の定数定義で使う関数のみ）
+/// </summary>
+namespace DirectX {
+
+constexpr float XM_PI = std::numbers::pi_v<float>;
+
+constexpr float XMConvertToRadians(float degrees) { return degrees * (XM_PI / 180.0f); }
+
+constexpr float XMConvertToDegrees(float radians) { return radians * (180.0f / XM_PI); }
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector3.h"
+#include <cstdint>
+#include <string>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 EmitterManager
+/// パーティクルは生成せず、呼び出し回数だけ数える（ゲーム側の操作頻度の計測用）
+/// </summary>
+class EmitterManager {
+public:
+    void Update() {}
+
+    bool LoadPreset(const std::string&, const std::string&) { ++callCount_; return true; }
+    void RemoveEmitter(const std::string&) { ++callCount_; }
+    void CreateTemporaryEmitterFrom(const std::string&, const std::string&, float) { ++callCount_; }
+    void SetEmitterActive(const std::string&, bool) { ++callCount_; }
+    void SetEmitterPosition(const std::string&, const Vector3&) { ++callCount_; }
+    void SetEmitterScaleRange(const std::string&, const Vector2&, const Vector2&) { ++callCount_; }
+
+    uint64_t GetCallCount() const { return callCount_; }
+    void ResetCallCount() { callCount_ = 0; }
+
+private:
+    uint64_t callCount_ = 0;
+};
+
+}
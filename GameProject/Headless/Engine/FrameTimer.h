@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 FrameTimer（シミュレーターが設定する固定ステップを返す）
+/// </summary>
+class FrameTimer {
+public:
+    static FrameTimer* GetInstance() {
+        static FrameTimer instance;
+        return &instance;
+    }
+
+    void SetDeltaTime(float deltaTime) { deltaTime_ = deltaTime; }
+    float GetDeltaTime() const { return deltaTime_; }
+
+private:
+    float deltaTime_ = 1.0f / 60.0f;
+};
+
+}
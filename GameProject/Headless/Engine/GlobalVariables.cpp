@@ -0,0 +1,111 @@
+#include "GlobalVariables.h"
+#include "json.hpp"
+#include <filesystem>
+#include <fstream>
+
+namespace Tako {
+
+GlobalVariables* GlobalVariables::GetInstance() {
+    static GlobalVariables instance;
+    return &instance;
+}
+
+void GlobalVariables::CreateGroup(const std::string& groupName) {
+    groups_[groupName];
+}
+
+void GlobalVariables::AddItemImpl(const std::string& groupName, const std::string& key, const Item& value) {
+    Group& group = groups_[groupName];
+    if (group.find(key) == group.end()) {
+        group[key] = value;
+    }
+}
+
+const GlobalVariables::Item* GlobalVariables::FindItem(const std::string& groupName, const std::string& key) const {
+    auto groupIt = groups_.find(groupName);
+    if (groupIt == groups_.end()) {
+        return nullptr;
+    }
+    auto itemIt = groupIt->second.find(key);
+    return itemIt != groupIt->second.end() ? &itemIt->second : nullptr;
+}
+
+int32_t GlobalVariables::GetValueInt(const std::string& groupName, const std::string& key) const {
+    const Item* item = FindItem(groupName, key);
+    if (!item) {
+        return 0;
+    }
+    if (const float* value = std::get_if<float>(item)) {
+        return static_cast<int32_t>(*value);
+    }
+    const int32_t* value = std::get_if<int32_t>(item);
+    return value ? *value : 0;
+}
+
+float GlobalVariables::GetValueFloat(const std::string& groupName, const std::string& key) const {
+    const Item* item = FindItem(groupName, key);
+    if (!item) {
+        return 0.0f;
+    }
+    if (const int32_t* value = std::get_if<int32_t>(item)) {
+        return static_cast<float>(*value);
+    }
+    const float* value = std::get_if<float>(item);
+    return value ? *value : 0.0f;
+}
+
+Vector3 GlobalVariables::GetValueVector3(const std::string& groupName, const std::string& key) const {
+    const Item* item = FindItem(groupName, key);
+    const Vector3* value = item ? std::get_if<Vector3>(item) : nullptr;
+    return value ? *value : Vector3();
+}
+
+bool GlobalVariables::GetValueBool(const std::string& groupName, const std::string& key) const {
+    const Item* item = FindItem(groupName, key);
+    const bool* value = item ? std::get_if<bool>(item) : nullptr;
+    return value ? *value : false;
+}
+
+void GlobalVariables::LoadFiles(const std::string& directory) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(directory, error)) {
+        return;
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.path().extension() != ".json") {
+            continue;
+        }
+
+        try {
+            std::ifstream file(entry.path());
+            nlohmann::json root = nlohmann::json::parse(file);
+            for (auto groupIt = root.begin(); groupIt != root.end(); ++groupIt) {
+                Group& group = groups_[groupIt.key()];
+                for (auto itemIt = groupIt.value().begin(); itemIt != groupIt.value().end(); ++itemIt) {
+                    const nlohmann::json& value = itemIt.value();
+                    auto existing = group.find(itemIt.key());
+                    bool wantsInt = existing != group.end() && std::holds_alternative<int32_t>(existing->second);
+
+                    if (value.is_boolean()) {
+                        group[itemIt.key()] = value.get<bool>();
+                    }
+                    else if (value.is_number_integer() && (wantsInt || existing == group.end())) {
+                        group[itemIt.key()] = value.get<int32_t>();
+                    }
+                    else if (value.is_number()) {
+                        group[itemIt.key()] = value.get<float>();
+                    }
+                    else if (value.is_array() && value.size() == 3) {
+                        group[itemIt.key()] = Vector3(value[0].get<float>(), value[1].get<float>(), value[2].get<float>());
+                    }
+                }
+            }
+        }
+        catch (const std::exception&) {
+            // 壊れたファイルは読み飛ばす（登録済みの既定値を使う）
+        }
+    }
+}
+
+}
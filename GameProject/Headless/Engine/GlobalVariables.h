@@ -0,0 +1,53 @@
+#pragma once
+#include "Vector3.h"
+#include <map>
+#include <string>
+#include <variant>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 GlobalVariables
+/// エンジン版と同じく登録値を既定値とし、resources/Json/GlobalVariables の保存値で上書きする（保存はしない）
+/// </summary>
+class GlobalVariables {
+public:
+    using Item = std::variant<int32_t, float, Vector3, bool>;
+    using Group = std::map<std::string, Item>;
+
+    static GlobalVariables* GetInstance();
+
+    void CreateGroup(const std::string& groupName);
+
+    void AddItem(const std::string& groupName, const std::string& key, int32_t value) { AddItemImpl(groupName, key, value); }
+    void AddItem(const std::string& groupName, const std::string& key, float value) { AddItemImpl(groupName, key, value); }
+    void AddItem(const std::string& groupName, const std::string& key, const Vector3& value) { AddItemImpl(groupName, key, value); }
+    void AddItem(const std::string& groupName, const std::string& key, bool value) { AddItemImpl(groupName, key, value); }
+
+    void SetValue(const std::string& groupName, const std::string& key, int32_t value) { groups_[groupName][key] = value; }
+    void SetValue(const std::string& groupName, const std::string& key, float value) { groups_[groupName][key] = value; }
+    void SetValue(const std::string& groupName, const std::string& key, const Vector3& value) { groups_[groupName][key] = value; }
+    void SetValue(const std::string& groupName, const std::string& key, bool value) { groups_[groupName][key] = value; }
+
+    int32_t GetValueInt(const std::string& groupName, const std::string& key) const;
+    float GetValueFloat(const std::string& groupName, const std::string& key) const;
+    Vector3 GetValueVector3(const std::string& groupName, const std::string& key) const;
+    bool GetValueBool(const std::string& groupName, const std::string& key) const;
+
+    /// <summary>
+    /// 保存済みの値をすべて読み込み（既存の項目の型に合わせて上書き）
+    /// </summary>
+    /// <param name="directory">読み込むディレクトリ</param>
+    void LoadFiles(const std::string& directory = "resources/Json/GlobalVariables/");
+
+    void Clear() { groups_.clear(); }
+
+private:
+    void AddItemImpl(const std::string& groupName, const std::string& key, const Item& value);
+
+    const Item* FindItem(const std::string& groupName, const std::string& key) const;
+
+    std::map<std::string, Group> groups_;
+};
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Vector2.h"
+#include <cmath>
+#include <cstdint>
+
+// キーコード（ゲーム側で使うもののみ。値は DirectInput と同じ）
+#define DIK_ESCAPE 0x01
+#define DIK_W      0x11
+#define DIK_P      0x19
+#define DIK_A      0x1E
+#define DIK_S      0x1F
+#define DIK_D      0x20
+#define DIK_F      0x21
+#define DIK_Z      0x2C
+#define DIK_SPACE  0x39
+
+namespace Tako {
+
+/// <summary>
+/// ゲームパッドのボタン
+/// </summary>
+enum class GamepadButton : uint32_t {
+    A,
+    B,
+    X,
+    Y,
+    Start,
+    Back,
+    Count
+};
+
+/// <summary>
+/// ヘッドレス版 Input
+/// 実デバイスの代わりに、シミュレーターが毎ティック設定する仮想ゲームパッドの状態を返す
+/// </summary>
+class Input {
+public:
+    /// <summary>
+    /// 仮想ゲームパッドの状態
+    /// </summary>
+    struct PadState {
+        Vector2 leftStick;                                                   // 左スティック（-1〜1）
+        Vector2 rightStick;                                                  // 右スティック（-1〜1）
+        bool triggered[static_cast<size_t>(GamepadButton::Count)] = {};      // このティックに押されたボタン
+    };
+
+    static Input* GetInstance() {
+        static Input instance;
+        return &instance;
+    }
+
+    /// <summary>
+    /// 仮想ゲームパッドの状態を設定
+    /// </summary>
+    void SetPadState(const PadState& state) { pad_ = state; }
+
+    bool IsConnect() const { return true; }
+    bool PushKey(uint8_t) const { return false; }
+    bool TriggerKey(uint8_t) const { return false; }
+    bool TriggerButton(GamepadButton button) const { return pad_.triggered[static_cast<size_t>(button)]; }
+    Vector2 GetLeftStick() const { return pad_.leftStick; }
+    Vector2 GetRightStick() const { return pad_.rightStick; }
+    bool LStickInDeadZone() const { return pad_.leftStick.Length() < kDeadZone; }
+    bool RStickInDeadZone() const { return pad_.rightStick.Length() < kDeadZone; }
+    void SetVibration(float, float, float) {}
+
+private:
+    static constexpr float kDeadZone = 0.1f;
+
+    PadState pad_;
+};
+
+}
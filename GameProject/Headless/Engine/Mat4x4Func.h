@@ -0,0 +1,68 @@
+#pragma once
+#include "Matrix4x4.h"
+#include "Vector3.h"
+#include <cmath>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Matrix4x4 関数群（ゲーム側で使う関数のみ）
+/// </summary>
+namespace Mat4x4 {
+
+inline Matrix4x4 Multiply(const Matrix4x4& a, const Matrix4x4& b) {
+    Matrix4x4 result;
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                sum += a.m[row][k] * b.m[k][col];
+            }
+            result.m[row][col] = sum;
+        }
+    }
+    return result;
+}
+
+inline Matrix4x4 MakeRotateX(float radian) {
+    Matrix4x4 result;
+    float c = std::cos(radian);
+    float s = std::sin(radian);
+    result.m[1][1] = c;  result.m[1][2] = s;
+    result.m[2][1] = -s; result.m[2][2] = c;
+    return result;
+}
+
+inline Matrix4x4 MakeRotateY(float radian) {
+    Matrix4x4 result;
+    float c = std::cos(radian);
+    float s = std::sin(radian);
+    result.m[0][0] = c; result.m[0][2] = -s;
+    result.m[2][0] = s; result.m[2][2] = c;
+    return result;
+}
+
+inline Matrix4x4 MakeRotateZ(float radian) {
+    Matrix4x4 result;
+    float c = std::cos(radian);
+    float s = std::sin(radian);
+    result.m[0][0] = c;  result.m[0][1] = s;
+    result.m[1][0] = -s; result.m[1][1] = c;
+    return result;
+}
+
+inline Matrix4x4 MakeRotateXYZ(const Vector3& rotate) {
+    return Multiply(Multiply(MakeRotateX(rotate.x), MakeRotateY(rotate.y)), MakeRotateZ(rotate.z));
+}
+
+inline Vector3 TransformNormal(const Matrix4x4& m, const Vector3& v) {
+    return {
+        v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0],
+        v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1],
+        v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2],
+    };
+}
+
+} // namespace Mat4x4
+
+}
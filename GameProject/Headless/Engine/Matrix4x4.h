@@ -0,0 +1,17 @@
+#pragma once
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Matrix4x4（行ベクトル規約）
+/// </summary>
+struct Matrix4x4 {
+    float m[4][4] = {
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 0.0f, 1.0f },
+    };
+};
+
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Model（描画リソースを持たない）
+/// </summary>
+class Model {
+};
+
+}
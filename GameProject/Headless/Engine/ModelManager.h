@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 ModelManager（モデルは読み込まない）
+/// </summary>
+class ModelManager {
+public:
+    static ModelManager* GetInstance() {
+        static ModelManager instance;
+        return &instance;
+    }
+
+    void LoadModel(const std::string&) {}
+};
+
+}
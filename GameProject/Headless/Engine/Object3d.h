@@ -0,0 +1,39 @@
+#pragma once
+#include "Model.h"
+#include "Transform.h"
+#include "Vector4.h"
+#include <string>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Object3d
+/// トランスフォームだけを保持し、描画関連の呼び出しは何もしない
+/// </summary>
+class Object3d {
+public:
+    void Initialize() {}
+    void Update() {}
+    void Draw() {}
+    void DrawImGui() {}
+
+    void SetModel(const std::string&) {}
+    Model* GetModel() { return &model_; }
+
+    void SetTransform(const Transform& transform) { transform_ = transform; }
+    const Transform& GetTransform() const { return transform_; }
+    void SetTranslate(const Vector3& translate) { transform_.translate = translate; }
+    void SetRotate(const Vector3& rotate) { transform_.rotate = rotate; }
+    void SetScale(const Vector3& scale) { transform_.scale = scale; }
+
+    void SetMaterialColor(const Vector4& color) { color_ = color; }
+    void SetUvTransform(const Transform&) {}
+    void SetEnableHighlight(bool) {}
+
+private:
+    Model model_;
+    Transform transform_;
+    Vector4 color_ = { 1.0f, 1.0f, 1.0f, 1.0f };
+};
+
+}
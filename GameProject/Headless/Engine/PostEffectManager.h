@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 PostEffectManager（エフェクトは適用しない）
+/// </summary>
+class PostEffectManager {
+public:
+    static PostEffectManager* GetInstance() {
+        static PostEffectManager instance;
+        return &instance;
+    }
+
+    template<typename TParam>
+    void ApplyTemporaryEffect(const std::string&, float, const TParam&) {}
+
+    template<typename TParam>
+    void SetEffectParam(const std::string&, const TParam&) {}
+
+    void AddEffectToChain(const std::string&) {}
+    void RemoveEffectFromChain(const std::string&) {}
+    void ClearEffectChain() {}
+};
+
+}
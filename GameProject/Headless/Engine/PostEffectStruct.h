@@ -0,0 +1,21 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版ポストエフェクトパラメータ（ゲーム側で使うもののみ）
+/// </summary>
+struct VignetteParam {
+    float power = 0.0f;
+    float range = 0.0f;
+    Vector3 color;
+};
+
+struct GaussianBlurParam {
+    float sigma = 0.0f;
+    int kernelSize = 0;
+};
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Quaternion.h"
+#include "Vector3.h"
+#include <cmath>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Quaternion 関数群（ゲーム側で使う関数のみ）
+/// </summary>
+namespace Quat {
+
+inline Quaternion Multiply(const Quaternion& a, const Quaternion& b) {
+    return {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+inline Quaternion MakeRotateAxisAngle(const Vector3& axis, float angle) {
+    Vector3 n = axis.Normalize();
+    float s = std::sin(angle * 0.5f);
+    return { n.x * s, n.y * s, n.z * s, std::cos(angle * 0.5f) };
+}
+
+/// <summary>
+/// 球面線形補間（最短経路）
+/// </summary>
+inline Quaternion Slerp(const Quaternion& q0, const Quaternion& q1, float t) {
+    Quaternion b = q1;
+    float dot = q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w;
+    if (dot < 0.0f) {
+        b = { -q1.x, -q1.y, -q1.z, -q1.w };
+        dot = -dot;
+    }
+
+    float scale0 = 1.0f - t;
+    float scale1 = t;
+    if (dot < 0.9995f) {
+        float theta = std::acos(dot);
+        float sinTheta = std::sin(theta);
+        scale0 = std::sin((1.0f - t) * theta) / sinTheta;
+        scale1 = std::sin(t * theta) / sinTheta;
+    }
+    return {
+        q0.x * scale0 + b.x * scale1,
+        q0.y * scale0 + b.y * scale1,
+        q0.z * scale0 + b.z * scale1,
+        q0.w * scale0 + b.w * scale1
+    };
+}
+
+} // namespace Quat
+
+}
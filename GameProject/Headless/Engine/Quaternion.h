@@ -0,0 +1,15 @@
+#pragma once
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Quaternion
+/// </summary>
+struct Quaternion {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 1.0f;
+};
+
+}
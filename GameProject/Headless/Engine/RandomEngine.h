@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include "Vector3.h"
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 RandomEngine（シードを固定して再現可能にできる）
+/// </summary>
+class RandomEngine {
+public:
+    static RandomEngine* GetInstance() {
+        static RandomEngine instance;
+        return &instance;
+    }
+
+    void SetSeed(uint32_t seed) { engine_.seed(seed); }
+
+    int GetInt(int min, int max) { return std::uniform_int_distribution<int>(min, max)(engine_); }
+
+    float GetFloat(float min, float max) { return std::uniform_real_distribution<float>(min, max)(engine_); }
+
+    Vector3 GetRandomDirectionXZ() {
+        float angle = GetFloat(0.0f, 2.0f * std::numbers::pi_v<float>);
+        return { std::sin(angle), 0.0f, std::cos(angle) };
+    }
+
+private:
+    std::mt19937 engine_{ 5489u };
+};
+
+}
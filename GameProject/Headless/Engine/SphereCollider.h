@@ -0,0 +1,20 @@
+#pragma once
+#include "Collider.h"
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版球コライダー
+/// </summary>
+class SphereCollider : public Collider {
+public:
+    Shape GetShape() const override { return Shape::Sphere; }
+
+    void SetRadius(float radius) { radius_ = radius; }
+    float GetRadius() const { return radius_; }
+
+private:
+    float radius_ = 1.0f;
+};
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector4.h"
+#include <string>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Sprite（パラメータだけ保持し、描画しない）
+/// </summary>
+class Sprite {
+public:
+    void Initialize(const std::string&) {}
+    void Update() {}
+    void Draw() {}
+
+    void SetPos(const Vector2& pos) { pos_ = pos; }
+    void SetSize(const Vector2& size) { size_ = size; }
+    void SetAnchorPoint(const Vector2& anchorPoint) { anchorPoint_ = anchorPoint; }
+    void SetColor(const Vector4& color) { color_ = color; }
+
+    const Vector2& GetPos() const { return pos_; }
+    const Vector2& GetSize() const { return size_; }
+
+private:
+    Vector2 pos_;
+    Vector2 size_;
+    Vector2 anchorPoint_;
+    Vector4 color_ = { 1.0f, 1.0f, 1.0f, 1.0f };
+};
+
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "Vector3.h"
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Transform
+/// </summary>
+struct Transform {
+    Vector3 scale = { 1.0f, 1.0f, 1.0f };
+    Vector3 rotate;
+    Vector3 translate;
+};
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Vector3.h"
+#include <cmath>
+#include <numbers>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Vector3 関数群（ゲーム側で使う関数のみ）
+/// </summary>
+namespace Vec3 {
+
+inline float Length(const Vector3& v) { return v.Length(); }
+
+inline Vector3 Normalize(const Vector3& v) { return v.Normalize(); }
+
+inline float Dot(const Vector3& a, const Vector3& b) { return Vector3::Dot(a, b); }
+
+inline Vector3 Cross(const Vector3& a, const Vector3& b) { return Vector3::Cross(a, b); }
+
+inline Vector3 Add(const Vector3& a, const Vector3& b) { return a + b; }
+
+inline Vector3 Subtract(const Vector3& a, const Vector3& b) { return a - b; }
+
+inline Vector3 Lerp(const Vector3& a, const Vector3& b, float t) { return Vector3::Lerp(a, b, t); }
+
+inline float Lerp(float a, float b, float t) { return a + (b - a) * t; }
+
+/// <summary>
+/// 角度を最短経路で補間
+/// </summary>
+inline float LerpShortAngle(float a, float b, float t) {
+    constexpr float kTwoPi = 2.0f * std::numbers::pi_v<float>;
+    float diff = std::fmod(b - a, kTwoPi);
+    if (diff > std::numbers::pi_v<float>) {
+        diff -= kTwoPi;
+    }
+    else if (diff < -std::numbers::pi_v<float>) {
+        diff += kTwoPi;
+    }
+    return a + diff * t;
+}
+
+} // namespace Vec3
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cmath>
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 Vector2（エンジンの Vector2 と同じインターフェースの代替実装）
+/// </summary>
+struct Vector2 {
+    float x = 0.0f;
+    float y = 0.0f;
+
+    Vector2() = default;
+    Vector2(float x, float y) : x(x), y(y) {}
+
+    Vector2 operator+(const Vector2& other) const { return { x + other.x, y + other.y }; }
+    Vector2 operator-(const Vector2& other) const { return { x - other.x, y - other.y }; }
+    Vector2 operator*(float scalar) const { return { x * scalar, y * scalar }; }
+    Vector2 operator/(float scalar) const { return { x / scalar, y / scalar }; }
+    Vector2 operator-() const { return { -x, -y }; }
+    Vector2& operator+=(const Vector2& other) { x += other.x; y += other.y; return *this; }
+    Vector2& operator-=(const Vector2& other) { x -= other.x; y -= other.y; return *this; }
+    Vector2& operator*=(float scalar) { x *= scalar; y *= scalar; return *this; }
+    bool operator==(const Vector2& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const Vector2& other) const { return !(*this == other); }
+
+    float Length() const { return std::sqrt(x * x + y * y); }
+
+    Vector2 Normalize() const {
+        float length = Length();
+        return length != 0.0f ? *this / length : *this;
+    }
+};
+
+inline Vector2 operator*(float scalar, const Vector2& v) { return v * scalar; }
+
+}
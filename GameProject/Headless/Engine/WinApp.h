@@ -0,0 +1,14 @@
+#pragma once
+
+namespace Tako {
+
+/// <summary>
+/// ヘッドレス版 WinApp（画面サイズの定数のみ）
+/// </summary>
+class WinApp {
+public:
+    static constexpr int clientWidth = 1920;
+    static constexpr int clientHeight = 1080;
+};
+
+}
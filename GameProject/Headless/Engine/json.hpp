@@ -0,0 +1,3 @@
+#pragma once
+// エンジン同梱の json.hpp の代わりに、システムの nlohmann/json を使う
+#include <nlohmann/json.hpp>
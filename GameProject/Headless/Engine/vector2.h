@@ -0,0 +1,2 @@
+#pragma once
+#include "Vector2.h"
@@ -0,0 +1,13 @@
+#include "../CameraSystem/CameraManager.h"
+
+// ヘッドレス版の CameraManager
+// 描画するカメラがないため、ゲームプレイ側から呼ばれる関数だけを何もしない実装で提供する
+// （CameraManager.cpp の代わりにリンクする）
+
+CameraManager* CameraManager::GetInstance() {
+    static CameraManager instance;
+    return &instance;
+}
+
+void CameraManager::StartShake(float) {
+}
@@ -0,0 +1,898 @@
+#include "BossFightSimulator.h"
+#include "../BehaviorTree/Core/BTProfiler.h"
+#include "../BehaviorTree/Benchmark/BTTreeLoadBenchmark.h"
+#include "../BehaviorTree/Core/BTBatchTicker.h"
+#include "../Common/GameConst.h"
+#include "../Common/FrameArena.h"
+#include "../Common/GameVariables.h"
+#include "../Common/TimingWheel.h"
+#include "../Object/Projectile/ProjectileBatch.h"
+#include "../Collision/CollisionTypeIdDef.h"
+#include "../CameraAnimation/CameraAnimation.h"
+#include "../Object/Boss/Boss.h"
+#include "../Object/Boss/BossBehaviorTree/BossBehaviorTree.h"
+#include "../Object/Boss/BossBehaviorTree/BossNodeFactory.h"
+#include "../Object/Player/Player.h"
+#include "../Input/InputHandler.h"
+#include "Camera.h"
+#include "CollisionManager.h"
+#include "EmitterManager.h"
+#include "GlobalVariables.h"
+#include "Mat4x4Func.h"
+#include "Vec3Func.h"
+#include "OBBCollider.h"
+#include "RandomEngine.h"
+#include "SphereCollider.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+// ヘッドレスボス戦シミュレーターのエントリーポイント
+// 使い方: boss_sim [--fights N] [--ticks N] [--seed N] [--dt 秒] [--profile 出力ディレクトリ] [--bullet-bench 弾数] [--collision-bench コライダー数] [--camera-bench キーフレーム数] [--tree-load-bench 最大ノード数] [--agents ボス数 [--threads ワーカー数]] [--tree compiled|graph]
+// resources/ を相対パスで読むため GameProject ディレクトリで実行する
+
+using namespace Tako;
+
+namespace {
+
+/// <summary>
+/// コマンドライン引数
+/// </summary>
+struct Options {
+    uint32_t fights = 8;
+    BossFightSimulator::Config config;
+    std::string profileDirectory;   // 空でなければノード単位の計測結果を書き出す
+    uint32_t bulletBench = 0;       // 0 でなければ戦闘の代わりに弾の一括計算だけを計測する
+    uint32_t collisionBench = 0;    // 0 でなければ戦闘の代わりに CollisionManager の判定だけを計測する
+    uint32_t cameraBench = 0;       // 0 でなければ戦闘の代わりに CameraAnimation のキーフレーム検索と再生だけを計測する
+    uint32_t treeLoadBench = 0;     // 0 でなければ戦闘の代わりにビヘイビアツリーの読み込みだけを計測する
+    uint32_t agents = 0;            // 0 でなければ戦闘の代わりに指定数のボスのツリーを一括評価し、スレッド数で結果が変わらないかを確かめる
+    uint32_t threads = 0;           // --agents の最大ワーカー数（0 ならハードウェアスレッド数）
+};
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (!value) {
+            std::fprintf(stderr, "missing value for %s\n", arg);
+            return false;
+        }
+
+        if (std::strcmp(arg, "--fights") == 0) {
+            options.fights = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--ticks") == 0) {
+            options.config.maxTicks = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--seed") == 0) {
+            options.config.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--dt") == 0) {
+            options.config.deltaTime = std::strtof(value, nullptr);
+        }
+        else if (std::strcmp(arg, "--profile") == 0) {
+            options.profileDirectory = value;
+        }
+        else if (std::strcmp(arg, "--bullet-bench") == 0) {
+            options.bulletBench = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--collision-bench") == 0) {
+            options.collisionBench = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--camera-bench") == 0) {
+            options.cameraBench = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--tree-load-bench") == 0) {
+            options.treeLoadBench = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--agents") == 0) {
+            options.agents = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--threads") == 0) {
+            options.threads = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        }
+        else if (std::strcmp(arg, "--tree") == 0) {
+            if (std::strcmp(value, "compiled") == 0) {
+                options.config.useCompiledTree = true;
+            }
+            else if (std::strcmp(value, "graph") == 0) {
+                options.config.useCompiledTree = false;
+            }
+            else {
+                std::fprintf(stderr, "unknown tree mode: %s\n", value);
+                return false;
+            }
+        }
+        else {
+            std::fprintf(stderr, "unknown option: %s\n", arg);
+            return false;
+        }
+        ++i;
+    }
+    return options.fights > 0 && options.config.deltaTime > 0.0f;
+}
+
+/// <summary>
+/// 全戦闘分のノード統計（戦闘ごとにツリーが作り直されるため名前で合算する）
+/// </summary>
+using ProfileTotals = std::unordered_map<std::string, BTProfiler::NodeStats>;
+
+void AccumulateProfile(ProfileTotals& totals) {
+    for (const BTProfiler::NodeStats& stats : BTProfiler::GetInstance()->GetAllStats()) {
+        BTProfiler::NodeStats& total = totals[stats.name];
+        total.name = stats.name;
+        total.tickCount += stats.tickCount;
+        total.totalNs += stats.totalNs;
+        total.selfNs += stats.selfNs;
+        total.peakNs = std::max(total.peakNs, stats.peakNs);
+        for (size_t i = 0; i < total.statusCounts.size(); ++i) {
+            total.statusCounts[i] += stats.statusCounts[i];
+        }
+    }
+}
+
+void PrintProfile(const ProfileTotals& totals, uint64_t ticks) {
+    std::vector<const BTProfiler::NodeStats*> sorted;
+    for (const auto& [name, stats] : totals) {
+        sorted.push_back(&stats);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+        [](const BTProfiler::NodeStats* a, const BTProfiler::NodeStats* b) { return a->selfNs > b->selfNs; });
+
+    std::printf("\n%-28s %10s %10s %10s %10s %8s %8s %8s\n",
+        "node", "evals/tick", "self us/t", "total us/t", "peak us", "success", "failure", "running");
+    for (const BTProfiler::NodeStats* stats : sorted) {
+        std::printf("%-28s %10.2f %10.3f %10.3f %10.2f %8llu %8llu %8llu\n",
+            stats->name.c_str(),
+            static_cast<double>(stats->tickCount) / static_cast<double>(ticks),
+            static_cast<double>(stats->selfNs) / 1e3 / static_cast<double>(ticks),
+            static_cast<double>(stats->totalNs) / 1e3 / static_cast<double>(ticks),
+            static_cast<double>(stats->peakNs) / 1e3,
+            static_cast<unsigned long long>(stats->statusCounts[static_cast<size_t>(BTNodeStatus::Success)]),
+            static_cast<unsigned long long>(stats->statusCounts[static_cast<size_t>(BTNodeStatus::Failure)]),
+            static_cast<unsigned long long>(stats->statusCounts[static_cast<size_t>(BTNodeStatus::Running)]));
+    }
+}
+
+/// <summary>
+/// ProjectileBatch の一括計算と TimingWheel による寿命の管理、プレイヤー本体との一括の当たり判定だけを大量の弾で計測する
+/// 消滅した弾はすぐ発射し直し、常に指定数の弾が飛んでいる状態を保つ
+/// </summary>
+void RunBulletBenchmark(uint32_t bulletCount, const BossFightSimulator::Config& config) {
+    constexpr uint32_t kSteps = 600;
+
+    ProjectileBatch batch;
+    batch.Initialize(bulletCount, {
+        { GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin },
+        { GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax } });
+
+    TimingWheel lifetimes;
+    lifetimes.Initialize(bulletCount, GameConst::kSimulationTickSeconds);
+    std::vector<TimerHandle> handles(bulletCount, kInvalidTimerHandle);
+
+    std::mt19937 rng(config.seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    auto spawn = [&](uint32_t id) {
+        Vector3 velocity(unit(rng) * 20.0f, unit(rng) * 2.0f, unit(rng) * 20.0f);
+        Vector3 rotationSpeed(unit(rng) * 10.0f, unit(rng) * 10.0f, unit(rng) * 10.0f);
+        uint32_t flags = (id % 2 == 0)
+            ? (ProjectileBatch::kFlagRotate | ProjectileBatch::kFlagCullBounds | ProjectileBatch::kFlagHostile)
+            : ProjectileBatch::kFlagCullBounds;
+        batch.Add(id, Vector3(0.0f, 1.5f, -40.0f), velocity, rotationSpeed, flags, 0.5f);
+        handles[id] = lifetimes.ScheduleSeconds(2.0f + unit(rng), id);
+    };
+    for (uint32_t id = 0; id < bulletCount; ++id) {
+        spawn(id);
+    }
+
+    // プレイヤーの体と同じ大きさの箱（弾の通り道に置く）
+    ProjectileBatch::QueryShape playerShape;
+    playerShape.center = Vector3(0.0f, 1.5f, -30.0f);
+    playerShape.halfExtents = Vector3(1.0f, 1.0f, 1.0f);
+
+    std::vector<uint32_t> respawn;
+    respawn.reserve(bulletCount);
+    std::vector<uint32_t> hits;
+    hits.reserve(bulletCount);
+    uint64_t expiredCount = 0;
+    uint64_t hitCount = 0;
+    double integrateSeconds = 0.0;
+    double querySeconds = 0.0;
+    for (uint32_t step = 0; step < kSteps; ++step) {
+        auto start = std::chrono::steady_clock::now();
+        batch.Integrate(config.deltaTime);
+        respawn.assign(batch.GetExpired().begin(), batch.GetExpired().end());
+        for (uint32_t id : respawn) {
+            batch.Remove(id);
+        }
+        for (uint64_t id : lifetimes.Advance(config.deltaTime)) {
+            // 範囲外と同じティックに期限が来た弾は範囲外側で数える
+            handles[id] = kInvalidTimerHandle;
+            if (batch.FindIndex(static_cast<uint32_t>(id)) != ProjectileBatch::kInvalidIndex) {
+                batch.Remove(static_cast<uint32_t>(id));
+                respawn.push_back(static_cast<uint32_t>(id));
+            }
+        }
+        integrateSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        hits.clear();
+        batch.QueryHostile(playerShape, hits);
+        querySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        hitCount += hits.size();
+
+        expiredCount += respawn.size();
+        for (uint32_t id : respawn) {
+            lifetimes.Cancel(handles[id]);
+            spawn(id);
+        }
+    }
+
+    double updates = static_cast<double>(bulletCount) * kSteps;
+    std::printf("bullet bench (%s): %u bullets x %u steps, %.2f ns/bullet, %.3f ms/step, %llu expired\n",
+        ProjectileBatch::GetInstructionSetName(), bulletCount, kSteps,
+        integrateSeconds / updates * 1e9, integrateSeconds / kSteps * 1e3,
+        static_cast<unsigned long long>(expiredCount));
+    std::printf("hostile query: %.2f ns/bullet, %.3f ms/step, %llu hits\n",
+        querySeconds / updates * 1e9, querySeconds / kSteps * 1e3,
+        static_cast<unsigned long long>(hitCount));
+}
+
+/// <summary>
+/// 接触の通知回数を数えるコライダー（衝突判定の計測用）
+/// </summary>
+template<typename Base>
+class CountingCollider : public Base {
+public:
+    void OnCollisionEnter(Collider*) override { ++notifyCount; }
+    void OnCollisionStay(Collider*) override { ++notifyCount; }
+    void OnCollisionExit(Collider*) override { ++notifyCount; }
+
+    static inline uint64_t notifyCount = 0;
+};
+
+/// <summary>
+/// 種類の混ざった大量のコライダーを動かしながら CollisionManager の判定を計測する
+/// 同じ乱数で総当たりと空間ハッシュの両方を回し、通知の回数が一致することも確かめる
+/// </summary>
+void RunCollisionBenchmark(uint32_t colliderCount, const BossFightSimulator::Config& config) {
+    constexpr uint32_t kSteps = 120;
+
+    struct Result {
+        double seconds = 0.0;
+        uint64_t pairTests = 0;
+        uint64_t notifications = 0;
+    };
+
+    auto run = [&](bool broadphase) {
+        CollisionManager* manager = CollisionManager::GetInstance();
+        manager->Initialize();
+        manager->SetBroadphaseEnabled(broadphase);
+
+        // GameScene::SetCollisionMask と同じ組み合わせ
+        manager->SetCollisionMask(static_cast<uint32_t>(CollisionTypeId::PLAYER_ATTACK), static_cast<uint32_t>(CollisionTypeId::BOSS), true);
+        manager->SetCollisionMask(static_cast<uint32_t>(CollisionTypeId::PLAYER), static_cast<uint32_t>(CollisionTypeId::BOSS_ATTACK), true);
+        manager->SetCollisionMask(static_cast<uint32_t>(CollisionTypeId::PLAYER_ATTACK), static_cast<uint32_t>(CollisionTypeId::BOSS_ATTACK), true);
+
+        // 割合はプレイヤー・ボス本体が数個、ボスの弾 6 割、プレイヤーの弾 3 割、残りは回転した環境の箱
+        std::mt19937 rng(config.seed);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        auto randomPosition = [&]() {
+            return Vector3(
+                GameConst::kStageXMin + unit(rng) * (GameConst::kStageXMax - GameConst::kStageXMin),
+                unit(rng) * 4.0f,
+                GameConst::kStageZMin + unit(rng) * (GameConst::kStageZMax - GameConst::kStageZMin));
+        };
+
+        std::vector<Transform> transforms(colliderCount);
+        std::vector<Vector3> velocities(colliderCount);
+        std::vector<std::unique_ptr<Collider>> colliders;
+        colliders.reserve(colliderCount);
+        for (uint32_t i = 0; i < colliderCount; ++i) {
+            transforms[i].translate = randomPosition();
+            float ratio = unit(rng);
+            std::unique_ptr<Collider> collider;
+            if (i < 2) {
+                auto obb = std::make_unique<CountingCollider<OBBCollider>>();
+                obb->SetSize(i == 0 ? Vector3(2.0f, 2.0f, 2.0f) : Vector3(8.0f, 8.0f, 8.0f));
+                obb->SetTypeID(static_cast<uint32_t>(i == 0 ? CollisionTypeId::PLAYER : CollisionTypeId::BOSS));
+                velocities[i] = Vector3(unit(rng) - 0.5f, 0.0f, unit(rng) - 0.5f) * 10.0f;
+                collider = std::move(obb);
+            }
+            else if (ratio < 0.9f) {
+                auto sphere = std::make_unique<CountingCollider<SphereCollider>>();
+                sphere->SetRadius(0.5f);
+                sphere->SetTypeID(static_cast<uint32_t>(ratio < 0.6f ? CollisionTypeId::BOSS_ATTACK : CollisionTypeId::PLAYER_ATTACK));
+                velocities[i] = Vector3(unit(rng) - 0.5f, 0.0f, unit(rng) - 0.5f) * 40.0f;
+                collider = std::move(sphere);
+            }
+            else {
+                auto obb = std::make_unique<CountingCollider<OBBCollider>>();
+                obb->SetSize(Vector3(1.0f + unit(rng) * 4.0f, 2.0f, 1.0f + unit(rng) * 4.0f));
+                obb->SetOrientation(Mat4x4::MakeRotateY(unit(rng) * 6.2831853f));
+                obb->SetTypeID(static_cast<uint32_t>(CollisionTypeId::ENVIRONMENT));
+                collider = std::move(obb);
+            }
+            collider->SetTransform(&transforms[i]);
+            manager->AddCollider(collider.get());
+            colliders.push_back(std::move(collider));
+        }
+
+        CountingCollider<SphereCollider>::notifyCount = 0;
+        CountingCollider<OBBCollider>::notifyCount = 0;
+        Result result;
+        for (uint32_t step = 0; step < kSteps; ++step) {
+            // ステージの端で跳ね返す
+            for (uint32_t i = 0; i < colliderCount; ++i) {
+                Vector3& position = transforms[i].translate;
+                position += velocities[i] * config.deltaTime;
+                if (position.x < GameConst::kStageXMin || position.x > GameConst::kStageXMax) {
+                    velocities[i].x = -velocities[i].x;
+                }
+                if (position.z < GameConst::kStageZMin || position.z > GameConst::kStageZMax) {
+                    velocities[i].z = -velocities[i].z;
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            manager->CheckAllCollisions();
+            result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            result.pairTests += manager->GetLastPairTestCount();
+        }
+        result.notifications = CountingCollider<SphereCollider>::notifyCount + CountingCollider<OBBCollider>::notifyCount;
+
+        manager->Reset();
+        manager->SetBroadphaseEnabled(true);
+        return result;
+    };
+
+    Result bruteForce = run(false);
+    Result grid = run(true);
+
+    std::printf("collision bench: %u colliders x %u steps\n", colliderCount, kSteps);
+    for (const auto& [name, result] : { std::pair{ "brute force", bruteForce }, std::pair{ "spatial hash", grid } }) {
+        std::printf("  %-12s %8.3f ms/step, %10.0f narrow tests/step, %llu notifications\n",
+            name, result.seconds / kSteps * 1e3,
+            static_cast<double>(result.pairTests) / kSteps,
+            static_cast<unsigned long long>(result.notifications));
+    }
+    std::printf("  notifications %s\n", bruteForce.notifications == grid.notifications ? "match" : "MISMATCH");
+}
+
+/// <summary>
+/// 大量のキーフレームを持つカメラアニメーションで、キーフレーム検索と再生を計測する
+/// 通常再生・逆再生・ランダムなシーク（スクラブ）の3通りの時刻列について、先頭からの線形探索（従来の実装）と
+/// カーソル＋二分探索を比べ、両者が同じ区間を選ぶことも確かめる
+/// </summary>
+void RunCameraBenchmark(uint32_t keyframeCount, const BossFightSimulator::Config& config) {
+    constexpr uint32_t kSamples = 20000;
+
+    // 間隔の不揃いなキーフレームを並べる
+    std::mt19937 rng(config.seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    Camera camera;
+    CameraAnimation animation;
+    animation.SetCamera(&camera);
+    animation.SetLooping(true);
+    float time = 0.0f;
+    for (uint32_t i = 0; i < std::max(keyframeCount, 2u); ++i) {
+        Vector3 position(unit(rng) * 40.0f - 20.0f, 2.0f + unit(rng) * 10.0f, unit(rng) * 40.0f - 20.0f);
+        Vector3 rotation(unit(rng) * 0.5f, unit(rng) * 6.2831853f, 0.0f);
+        animation.AddKeyframe(CameraKeyframe(time, position, rotation, 0.4f + unit(rng) * 0.3f,
+            static_cast<CameraKeyframe::InterpolationType>(i % 4)));
+        time += 0.05f + unit(rng) * 0.1f;
+    }
+    const float duration = animation.GetDuration();
+
+    // 1サンプルで平均 0.4 キーフレーム進む速さで、通常再生は全体を何周かする
+    const float step = duration / static_cast<float>(animation.GetKeyframeCount()) * 0.4f;
+    std::vector<float> forward(kSamples), reverse(kSamples), scrub(kSamples);
+    for (uint32_t i = 0; i < kSamples; ++i) {
+        forward[i] = std::fmod(static_cast<float>(i) * step, duration);
+        reverse[i] = duration - forward[i];
+        scrub[i] = unit(rng) * duration;
+    }
+
+    // 従来の実装と同じ、時刻以下の最後のキーフレームを先頭から探す線形探索
+    auto linearFind = [&](float t) {
+        size_t prev = 0;
+        for (size_t i = 0; i < animation.GetKeyframeCount(); ++i) {
+            if (animation.GetKeyframe(i).time <= t) {
+                prev = i;
+            }
+            else {
+                break;
+            }
+        }
+        return prev;
+    };
+
+    std::printf("camera bench: %zu keyframes, %.1f s, %u samples per pattern\n", animation.GetKeyframeCount(), duration, kSamples);
+    bool allMatch = true;
+    for (const auto& [name, times] : { std::pair{ "forward", &forward }, std::pair{ "reverse", &reverse }, std::pair{ "scrub", &scrub } }) {
+        std::vector<size_t> expected(kSamples);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kSamples; ++i) {
+            expected[i] = linearFind((*times)[i]);
+        }
+        double linearSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        CameraAnimation::LookupStats before = animation.GetLookupStats();
+        uint32_t mismatches = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kSamples; ++i) {
+            size_t prev = 0, next = 0;
+            animation.FindKeyframeIndices((*times)[i], prev, next);
+            mismatches += (prev != expected[i]) ? 1 : 0;
+        }
+        double cursorSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const CameraAnimation::LookupStats& after = animation.GetLookupStats();
+
+        std::printf("  %-8s linear %10.1f ns/lookup, cursor+bsearch %7.1f ns/lookup (%llu cursor, %llu bsearch), %s\n",
+            name, linearSeconds / kSamples * 1e9, cursorSeconds / kSamples * 1e9,
+            static_cast<unsigned long long>(after.cursorHits - before.cursorHits),
+            static_cast<unsigned long long>(after.binarySearches - before.binarySearches),
+            mismatches == 0 ? "match" : "MISMATCH");
+        allMatch = allMatch && mismatches == 0;
+    }
+
+    // 補間とカメラへの反映まで含めた再生（Update）とシーク（SetCurrentTime）
+    auto measure = [&](auto&& sample) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kSamples; ++i) {
+            sample(i);
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / kSamples * 1e9;
+    };
+    animation.Play();
+    animation.SetPlaySpeed(step / config.deltaTime);
+    double updateForward = measure([&](uint32_t) { animation.Update(config.deltaTime); });
+    animation.SetPlaySpeed(-step / config.deltaTime);
+    double updateReverse = measure([&](uint32_t) { animation.Update(config.deltaTime); });
+    double seek = measure([&](uint32_t i) { animation.SetCurrentTime(scrub[i]); });
+    std::printf("  Update forward %.1f ns, Update reverse %.1f ns, SetCurrentTime %.1f ns\n", updateForward, updateReverse, seek);
+    std::printf("  segments %s\n", allMatch ? "match" : "MISMATCH");
+
+    // 同じアニメーションをベイクしたトラックでの再生
+    auto printBake = [](const char* name, const BakedCameraTrack::Stats& stats) {
+        std::printf("  %-22s %6u samples -> %6u keys, %8zu bytes, max error pos %.4f rot %.4f fov %.4f\n",
+            name, stats.sampleCount, stats.keyCount, stats.byteSize,
+            stats.maxPositionError, stats.maxRotationError, stats.maxFovError);
+    };
+    for (bool quantize : { false, true }) {
+        BakedCameraTrack::BakeSettings settings;
+        settings.quantize = quantize;
+        auto start = std::chrono::steady_clock::now();
+        animation.Bake(settings);
+        double bakeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        animation.SetPlaySpeed(step / config.deltaTime);
+        double bakedForward = measure([&](uint32_t) { animation.Update(config.deltaTime); });
+        double bakedSeek = measure([&](uint32_t i) { animation.SetCurrentTime(scrub[i]); });
+        printBake(quantize ? "baked (quantized)" : "baked", animation.GetBakedTrack().GetStats());
+        std::printf("  %-22s bake %.1f ms, Update forward %.1f ns (x%.1f), SetCurrentTime %.1f ns (x%.1f)\n", "", bakeSeconds * 1e3,
+            bakedForward, updateForward / bakedForward, bakedSeek, seek / bakedSeek);
+    }
+    animation.ClearBake();
+
+    // JSON（パースとバイナリの書き出し）とバイナリからの読み込み
+    constexpr int kLoadRepeats = 20;
+    auto measureLoad = [&](const char* name, auto&& load) {
+        auto start = std::chrono::steady_clock::now();
+        bool ok = true;
+        for (int i = 0; i < kLoadRepeats; ++i) {
+            CameraAnimation loaded;
+            ok = load(loaded, name) && ok;
+        }
+        double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / kLoadRepeats * 1e3;
+        return ok ? ms : -1.0;
+    };
+    auto printLoad = [&](const char* name) {
+        double json = measureLoad(name, [](CameraAnimation& a, const char* n) { return a.LoadFromJson(n); });
+        double binary = measureLoad(name, [](CameraAnimation& a, const char* n) { return a.LoadFromFile(n); });
+        std::printf("  %-22s load json %.3f ms, camanim %.3f ms\n", name, json, binary);
+    };
+    const char* benchName = "_camera_bench";
+    if (animation.SaveToJson(benchName)) {
+        printLoad(benchName);
+        std::remove(("resources/Json/CameraAnimations/" + std::string(benchName) + ".json").c_str());
+        std::remove(("resources/Json/CameraAnimations/" + std::string(benchName) + ".camanim").c_str());
+    }
+
+    // 出荷用のカットシーン（通常速度でループ再生し、キーフレームからの再生とベイクしたトラックの再生を比べる）
+    for (const char* name : { "game_start", "over_anim", "clear_anim" }) {
+        printLoad(name);
+        CameraAnimation cutscene;
+        if (!cutscene.LoadFromFile(name)) {
+            continue;
+        }
+        cutscene.SetCamera(&camera);
+        cutscene.SetLooping(true);
+        cutscene.SetStartMode(CameraAnimation::StartMode::JUMP_CUT);
+        cutscene.Play();
+        double keyframeUpdate = measure([&](uint32_t) { cutscene.Update(config.deltaTime); });
+        for (bool quantize : { false, true }) {
+            BakedCameraTrack::BakeSettings settings;
+            settings.quantize = quantize;
+            cutscene.Bake(settings);
+            double bakedUpdate = measure([&](uint32_t) { cutscene.Update(config.deltaTime); });
+            printBake((std::string(name) + (quantize ? " (quantized)" : "")).c_str(), cutscene.GetBakedTrack().GetStats());
+            std::printf("  %-22s Update %.1f ns -> %.1f ns (x%.1f)\n", "", keyframeUpdate, bakedUpdate, keyframeUpdate / bakedUpdate);
+        }
+    }
+
+    // スプライン経路: 円周上の 8 点を結ぶ spline_orbit を経路の種類ごとに再生し、
+    // 円からのずれ（半径の最大誤差）と速さのむら（一定時間ごとの移動距離の最大 / 最小）を比べる
+    CameraAnimation orbit;
+    if (orbit.LoadFromFile("spline_orbit")) {
+        constexpr uint32_t kOrbitSamples = 2000;
+        const float orbitDuration = orbit.GetDuration();
+        const float radius = Vec3::Length(Vector3(orbit.GetKeyframe(0).position.x, 0.0f, orbit.GetKeyframe(0).position.z));
+        std::printf("  orbit: %zu keyframes, radius %.1f\n", orbit.GetKeyframeCount(), radius);
+        for (auto [pathName, pathType, constantSpeed] : {
+            std::tuple{ "linear", CameraAnimation::PathType::LINEAR, false },
+            std::tuple{ "catmull-rom", CameraAnimation::PathType::CATMULL_ROM, false },
+            std::tuple{ "centripetal", CameraAnimation::PathType::CENTRIPETAL, false },
+            std::tuple{ "centripetal+arclen", CameraAnimation::PathType::CENTRIPETAL, true } }) {
+            orbit.SetPathType(pathType);
+            orbit.SetConstantSpeed(constantSpeed);
+
+            float maxRadiusError = 0.0f, minStep = 1e9f, maxStep = 0.0f;
+            Vector3 previous = orbit.SamplePosition(0.0f);
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 1; i <= kOrbitSamples; ++i) {
+                Vector3 position = orbit.SamplePosition(orbitDuration * static_cast<float>(i) / kOrbitSamples);
+                float stepLength = Vec3::Length(position - previous);
+                minStep = std::min(minStep, stepLength);
+                maxStep = std::max(maxStep, stepLength);
+                maxRadiusError = std::max(maxRadiusError, std::abs(Vec3::Length(Vector3(position.x, 0.0f, position.z)) - radius));
+                previous = position;
+            }
+            double ns = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / kOrbitSamples * 1e9;
+            std::printf("  %-22s radius error %.3f, speed max/min %.3f, %.1f ns/sample\n",
+                pathName, maxRadiusError, minStep > 0.0f ? maxStep / minStep : 0.0f, ns);
+        }
+    }
+}
+
+/// <summary>
+/// ボスのノードタイプで合成した大規模ツリーを、従来の読み込み（O(N^2)）と BTTreeDefinition の両方で組み立てて比べる
+/// 1000 ノードから最大ノード数まで、同じ入力で計測する
+/// </summary>
+void RunTreeLoadBenchmark(uint32_t maxNodeCount) {
+    // ノードのカテゴリ情報はエディタ用（_DEBUG のみ）なので、ここでタイプ名を並べる
+    const std::vector<std::string> compositeTypes = { "BTSelector", "BTSequence", "BTRandomSelector" };
+    const std::vector<std::string> leafTypes = {
+        "BTBossIdle", "BTBossDash", "BTBossShoot", "BTBossRapidFire", "BTBossWideShoot",
+        "BTBossMeleeAttack", "BTBossApproach", "BTBossRetreat", "BTBossBarrage",
+    };
+
+    std::vector<size_t> nodeCounts;
+    for (size_t nodeCount : { size_t(1000), size_t(10000), size_t(50000), size_t(100000) }) {
+        if (nodeCount < maxNodeCount) {
+            nodeCounts.push_back(nodeCount);
+        }
+    }
+    nodeCounts.push_back(maxNodeCount);
+
+    std::printf("tree load benchmark: fanout %u, %zu composite / %zu leaf types\n",
+        BTTreeLoadBenchmark::kFanout, compositeTypes.size(), leafTypes.size());
+    std::printf("%8s %10s %10s %10s %10s %10s %10s %12s %8s %6s\n",
+        "nodes", "json KB", "parse ms", "index ms", "inst ms", "compile ms", "build ms", "legacy ms", "speedup", "match");
+
+    BTTreeLoadBenchmark benchmark;
+    for (size_t nodeCount : nodeCounts) {
+        BTTreeLoadBenchmark::Result result = benchmark.Run(nodeCount, &BossNodeFactory::CreateNode, compositeTypes, leafTypes);
+        double buildMs = result.GetBuildMs();
+        std::printf("%8zu %10.1f %10.2f %10.2f %10.2f %10.2f %10.2f %12.2f %7.1fx %6s\n",
+            result.nodeCount, result.jsonBytes / 1024.0,
+            result.parseMs, result.indexMs, result.instantiateMs, result.compileMs,
+            buildMs, result.legacyMs, buildMs > 0.0 ? result.legacyMs / buildMs : 0.0,
+            result.matches ? "yes" : "NO");
+    }
+}
+
+/// <summary>
+/// 複数のボスのビヘイビアツリーを BossBehaviorTree::UpdateBatch（BTBatchTicker）でまとめて評価し、
+/// ワーカー数によって結果が変わらないかを確かめる
+/// 各ボスを1体ずつ Update した結果を基準に、ワーカー数を 1 から指定数まで倍々に増やして同じ入力で --ticks ティック評価し、
+/// 毎ティックのボスの位置・硬直/ダッシュのフラグ・実行中ノード・弾の生成要求をまとめたハッシュを比べる
+/// </summary>
+/// <returns>すべてのワーカー数で基準と一致したら true</returns>
+bool RunAgentBenchmark(uint32_t agentCount, uint32_t maxThreads, const BossFightSimulator::Config& config) {
+    const uint32_t ticks = config.maxTicks;
+    constexpr float kSpawnRadius = 20.0f;
+
+    GameVariables::RegisterAll();
+    GlobalVariables::GetInstance()->LoadFiles();
+    if (!FrameArena::GetInstance()->IsInitialized()) {
+        FrameArena::GetInstance()->Initialize(GameConst::kFrameArenaSize);
+    }
+    if (maxThreads == 0) {
+        maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    struct Result {
+        double seconds = 0.0;
+        uint64_t hash = 14695981039346656037ull;
+        uint64_t commands = 0;
+        size_t pooledAgents = 0;    // 先頭のボスと同じ状態プールに状態ブロックを持つボスの数
+        size_t stateStride = 0;
+    };
+
+    // FNV-1a
+    auto mix = [](uint64_t& hash, const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+
+    // workerCount が 0 なら1体ずつ Update する
+    auto run = [&](uint32_t workerCount) {
+        RandomEngine::GetInstance()->SetSeed(config.seed);
+        CollisionManager::GetInstance()->Initialize();
+
+        EmitterManager emitterManager;
+        Camera camera;
+        InputHandler inputHandler;
+        inputHandler.Initialize();
+
+        // プレイヤーは動かさず、周りに並べたボスがそれぞれの距離で行動を選ぶ
+        Player player;
+        player.Initialize();
+        player.SetCamera(&camera);
+        player.SetInputHandler(&inputHandler);
+        player.SetEmitterManager(&emitterManager);
+
+        std::vector<std::unique_ptr<Boss>> bosses;
+        std::vector<BossBehaviorTree*> trees;
+        for (uint32_t i = 0; i < agentCount; ++i) {
+            auto boss = std::make_unique<Boss>();
+            boss->Initialize();
+            boss->SetPlayer(&player);
+            boss->SetEmitterManager(&emitterManager);
+            boss->GetBehaviorTree()->SetRandomSeed(config.seed + i);
+            boss->SetIsPause(false);
+
+            float angle = 6.2831853f * static_cast<float>(i) / static_cast<float>(agentCount);
+            float radius = kSpawnRadius * (0.25f + 0.75f * static_cast<float>(i % 7) / 6.0f);
+            boss->SetTranslate(Vector3(std::cos(angle) * radius, 0.0f, std::sin(angle) * radius));
+
+            trees.push_back(boss->GetBehaviorTree());
+            bosses.push_back(std::move(boss));
+        }
+
+        // 同じツリーのボスは1つの状態プールのチャンクに並ぶ
+        Result result;
+        const BTAgentStatePool* statePool = trees.front()->GetStatePool();
+        for (BossBehaviorTree* tree : trees) {
+            result.pooledAgents += (tree->GetStatePool() == statePool) ? 1 : 0;
+        }
+        result.stateStride = statePool ? statePool->GetStride() : 0;
+
+        std::optional<BTBatchTicker> ticker;
+        if (workerCount > 0) {
+            ticker.emplace(workerCount);
+        }
+
+        for (uint32_t tick = 0; tick < ticks; ++tick) {
+            auto start = std::chrono::steady_clock::now();
+            if (ticker) {
+                BossBehaviorTree::UpdateBatch(trees, config.deltaTime, *ticker);
+                result.commands += ticker->GetLastCommandCount();
+            }
+            else {
+                for (BossBehaviorTree* tree : trees) {
+                    tree->Update(config.deltaTime);
+                }
+            }
+            result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            for (const auto& boss : bosses) {
+                Vector3 position = boss->GetTranslate();
+                bool flags[2] = { boss->IsInRecovery(), boss->IsDashing() };
+                mix(result.hash, &position, sizeof(position));
+                mix(result.hash, flags, sizeof(flags));
+                if (const BTNode* node = boss->GetBehaviorTree()->GetCurrentRunningNode()) {
+                    mix(result.hash, node->GetName().data(), node->GetName().size());
+                }
+                for (const BulletSpawnRequest& request : boss->ConsumePendingBullets()) {
+                    mix(result.hash, &request, sizeof(request));
+                }
+                for (const BulletSpawnRequest& request : boss->ConsumePendingPenetratingBullets()) {
+                    mix(result.hash, &request, sizeof(request));
+                }
+            }
+            FrameArena::GetInstance()->EndFrame();
+        }
+
+        for (const auto& boss : bosses) {
+            boss->Finalize();
+        }
+        bosses.clear();
+        player.Finalize();
+        CollisionManager::GetInstance()->Reset();
+        return result;
+    };
+
+    std::printf("agent batch: %u bosses, %u ticks\n", agentCount, ticks);
+    std::printf("%-10s %12s %12s %14s %18s %6s\n", "workers", "us/tick", "us/agent", "commands/tick", "hash", "match");
+
+    auto print = [&](const char* label, const Result& result, bool match) {
+        double usPerTick = result.seconds / ticks * 1e6;
+        std::printf("%-10s %12.2f %12.3f %14.1f %18llx %6s\n",
+            label, usPerTick, usPerTick / agentCount,
+            static_cast<double>(result.commands) / ticks,
+            static_cast<unsigned long long>(result.hash), match ? "yes" : "NO");
+    };
+
+    Result serial = run(0);
+    print("serial", serial, true);
+
+    bool allMatch = true;
+    std::vector<uint32_t> workerCounts;
+    for (uint32_t workers = 1; workers < maxThreads; workers *= 2) {
+        workerCounts.push_back(workers);
+    }
+    workerCounts.push_back(maxThreads);
+
+    for (uint32_t workers : workerCounts) {
+        Result batch = run(workers);
+        bool match = batch.hash == serial.hash;
+        allMatch = allMatch && match;
+        char label[16];
+        std::snprintf(label, sizeof(label), "%u", workers);
+        print(label, batch, match);
+    }
+    std::printf("state pool: %zu / %u bosses in one pool, %zu bytes each, %zu per chunk\n",
+        serial.pooledAgents, agentCount, serial.stateStride, BTAgentStatePool::kAgentsPerChunk);
+    return allMatch;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: boss_sim [--fights N] [--ticks N] [--seed N] [--dt seconds] [--profile dir] [--bullet-bench N] [--collision-bench N] [--camera-bench N] [--tree-load-bench N] [--agents N [--threads N]] [--tree compiled|graph]\n");
+        return 1;
+    }
+
+    if (options.bulletBench > 0) {
+        RunBulletBenchmark(options.bulletBench, options.config);
+        return 0;
+    }
+    if (options.collisionBench > 0) {
+        RunCollisionBenchmark(options.collisionBench, options.config);
+        return 0;
+    }
+    if (options.cameraBench > 0) {
+        RunCameraBenchmark(options.cameraBench, options.config);
+        return 0;
+    }
+    if (options.treeLoadBench > 0) {
+        RunTreeLoadBenchmark(options.treeLoadBench);
+        return 0;
+    }
+    if (options.agents > 0) {
+        return RunAgentBenchmark(options.agents, options.threads, options.config) ? 0 : 1;
+    }
+
+    // ゲーム本体と同じ既定値を登録してから、保存済みの調整値で上書きする
+    GameVariables::RegisterAll();
+    GlobalVariables::GetInstance()->LoadFiles();
+
+    constexpr size_t kSubsystemCount = static_cast<size_t>(BossFightSimulator::Subsystem::Count);
+    std::array<double, kSubsystemCount> subsystemSeconds{};
+    std::array<uint32_t, 3> outcomeCounts{};
+    uint64_t totalTicks = 0;
+    uint64_t totalAllocations = 0;
+    uint64_t totalBytes = 0;
+    double totalSeconds = 0.0;
+    size_t peakBullets = 0;
+    uint64_t droppedBullets = 0;
+    uint64_t emitterCalls = 0;
+    uint64_t treeIdleTicks = 0;
+    bool treeStalled = false;
+
+    bool profiling = !options.profileDirectory.empty();
+    if (profiling) {
+#if BT_PROFILER_ENABLED
+        BTProfiler::SetEnabled(true);
+#else
+        std::fprintf(stderr, "--profile requires building with -DBT_PROFILER_ENABLED=1\n");
+        profiling = false;
+#endif
+    }
+    ProfileTotals profileTotals;
+
+    BossFightSimulator simulator;
+    for (uint32_t fight = 0; fight < options.fights; ++fight) {
+        BossFightSimulator::Config config = options.config;
+        config.seed = options.config.seed + fight;
+
+        BossFightSimulator::Result result = simulator.Run(config);
+        if (profiling) {
+            AccumulateProfile(profileTotals);
+        }
+
+        std::printf("fight %3u seed %u: %-14s ticks %6u  boss hp %6.1f  player hp %6.1f  peak bullets %zu\n",
+            fight, config.seed, BossFightSimulator::GetOutcomeName(result.outcome),
+            result.ticks, result.bossHp, result.playerHp, result.peakBulletCount);
+
+        for (size_t i = 0; i < kSubsystemCount; ++i) {
+            subsystemSeconds[i] += result.subsystemSeconds[i];
+        }
+        ++outcomeCounts[static_cast<size_t>(result.outcome)];
+        totalTicks += result.ticks;
+        totalAllocations += result.allocations.allocations;
+        totalBytes += result.allocations.bytes;
+        totalSeconds += result.totalSeconds;
+        peakBullets = std::max(peakBullets, result.peakBulletCount);
+        droppedBullets += result.droppedBulletCount;
+        emitterCalls += result.emitterCallCount;
+        treeIdleTicks += result.treeIdleTicks;
+
+        // ツリーが一度もノードを実行しなかった戦闘は、評価方式が壊れているとみなす
+        treeStalled = treeStalled || (result.ticks > 0 && result.treeIdleTicks == result.ticks);
+    }
+
+    if (totalTicks == 0 || totalSeconds <= 0.0) {
+        return 0;
+    }
+
+    double ticks = static_cast<double>(totalTicks);
+    std::printf("\n%llu ticks in %.3f s: %.0f ticks/sec\n",
+        static_cast<unsigned long long>(totalTicks), totalSeconds, ticks / totalSeconds);
+    std::printf("allocations: %.2f /tick, %.1f bytes/tick\n",
+        static_cast<double>(totalAllocations) / ticks, static_cast<double>(totalBytes) / ticks);
+    std::printf("peak bullets: %zu (dropped by full pools: %llu)\n",
+        peakBullets, static_cast<unsigned long long>(droppedBullets));
+    std::printf("emitter calls: %.2f /tick\n", static_cast<double>(emitterCalls) / ticks);
+    std::printf("boss tree (%s): idle %llu / %llu ticks%s\n", options.config.useCompiledTree ? "compiled" : "graph",
+        static_cast<unsigned long long>(treeIdleTicks), static_cast<unsigned long long>(totalTicks),
+        treeStalled ? ", STALLED" : "");
+    const FrameArena::Stats& arenaStats = FrameArena::GetInstance()->GetStats();
+    std::printf("frame arena: peak %zu / %zu bytes per tick (overflows: %llu)\n",
+        arenaStats.highWater, arenaStats.capacity, static_cast<unsigned long long>(arenaStats.overflowCount));
+    std::printf("outcomes: boss defeated %u, player defeated %u, timeout %u\n",
+        outcomeCounts[0], outcomeCounts[1], outcomeCounts[2]);
+
+    std::printf("\n%-18s %10s %7s\n", "subsystem", "us/tick", "share");
+    for (size_t i = 0; i < kSubsystemCount; ++i) {
+        std::printf("%-18s %10.3f %6.1f%%\n",
+            BossFightSimulator::GetSubsystemName(static_cast<BossFightSimulator::Subsystem>(i)),
+            subsystemSeconds[i] / ticks * 1e6, subsystemSeconds[i] / totalSeconds * 100.0);
+    }
+
+    if (profiling) {
+        PrintProfile(profileTotals, totalTicks);
+
+        // トレースは最後の戦闘の直近分のみ保持している
+        BTProfiler* profiler = BTProfiler::GetInstance();
+        std::string tracePath = options.profileDirectory + "/BossTreeTrace.json";
+        std::string statsPath = options.profileDirectory + "/BossTreeStats.json";
+        if (profiler->ExportChromeTrace(tracePath) && profiler->ExportStatsJSON(statsPath)) {
+            std::printf("\nprofile written to %s and %s\n", tracePath.c_str(), statsPath.c_str());
+        }
+        else {
+            std::fprintf(stderr, "failed to write profile to %s\n", options.profileDirectory.c_str());
+        }
+    }
+    return treeStalled ? 1 : 0;
+}
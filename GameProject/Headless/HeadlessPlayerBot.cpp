@@ -0,0 +1,52 @@
+#include "HeadlessPlayerBot.h"
+#include "../Object/Player/Player.h"
+#include "../Object/Boss/Boss.h"
+
+using namespace Tako;
+
+void HeadlessPlayerBot::Initialize(uint32_t seed) {
+    engine_.seed(seed);
+    strafeSign_ = 1.0f;
+    strafeTicks_ = 0;
+}
+
+void HeadlessPlayerBot::Update(const Player& player, const Boss& boss) {
+    Input::PadState pad;
+
+    Vector3 toBoss = boss.GetTranslate() - player.GetTranslate();
+    toBoss.y = 0.0f;
+    float distance = toBoss.Length();
+    Vector2 forward = distance > 0.0f ? Vector2(toBoss.x / distance, toBoss.z / distance) : Vector2(0.0f, 1.0f);
+    Vector2 side(-forward.y * strafeSign_, forward.x * strafeSign_);
+
+    // 一定間隔で周回方向を変える
+    if (--strafeTicks_ <= 0) {
+        strafeSign_ = Chance(0.5f) ? 1.0f : -1.0f;
+        strafeTicks_ = 60 + static_cast<int>(unit_(engine_) * 120.0f);
+    }
+
+    if (distance > kShootRange) {
+        // 遠い：接近
+        pad.leftStick = forward;
+    }
+    else if (distance > kMeleeRange) {
+        // 中距離：周回しながらボスへ射撃
+        pad.leftStick = side * 0.8f + forward * 0.2f;
+        pad.rightStick = forward;
+    }
+    else {
+        // 近距離：近接攻撃
+        pad.leftStick = forward * 0.3f;
+        pad.triggered[static_cast<size_t>(GamepadButton::X)] = Chance(0.2f);
+    }
+
+    // 被弾を避ける操作はランダムに混ぜる
+    pad.triggered[static_cast<size_t>(GamepadButton::B)] = Chance(0.03f);
+    pad.triggered[static_cast<size_t>(GamepadButton::A)] = Chance(0.01f);
+
+    Input::GetInstance()->SetPadState(pad);
+}
+
+bool HeadlessPlayerBot::Chance(float probability) {
+    return unit_(engine_) < probability;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Input.h"
+#include <cstdint>
+#include <random>
+
+class Player;
+class Boss;
+
+/// <summary>
+/// ヘッドレスシミュレーター用の自動操作プレイヤー
+/// ボスとの距離に応じて接近・周回・射撃・近接攻撃・パリィ・ダッシュの入力を仮想ゲームパッドに書き込む
+/// 乱数はシードで固定するため、同じシードなら同じ入力列になる
+/// </summary>
+class HeadlessPlayerBot {
+public:
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    /// <param name="seed">乱数シード</param>
+    void Initialize(uint32_t seed);
+
+    /// <summary>
+    /// 1ティック分の入力を決めて Input に設定
+    /// </summary>
+    /// <param name="player">操作するプレイヤー</param>
+    /// <param name="boss">相手のボス</param>
+    void Update(const Player& player, const Boss& boss);
+
+private:
+    /// <summary>
+    /// 確率 probability で true を返す
+    /// </summary>
+    bool Chance(float probability);
+
+    // 近接攻撃を狙う距離
+    static constexpr float kMeleeRange = 4.0f;
+    // 射撃に切り替える距離
+    static constexpr float kShootRange = 12.0f;
+
+    std::mt19937 engine_;
+    std::uniform_real_distribution<float> unit_{ 0.0f, 1.0f };
+
+    // 周回方向（1 または -1）と切り替えまでのティック数
+    float strafeSign_ = 1.0f;
+    int strafeTicks_ = 0;
+};
@@ -37,56 +37,6 @@ private: // プライベートメンバ関数
     /// </summary>
     void RegisterGlobalVariables();
 
-    /// <summary>
-    /// 入力関連パラメータを登録
-    /// </summary>
-    void RegisterInputVariables();
-
-    /// <summary>
-    /// ゲームシーン関連パラメータを登録
-    /// </summary>
-    void RegisterGameSceneVariables();
-
-    /// <summary>
-    /// プレイヤー関連パラメータを登録
-    /// </summary>
-    void RegisterPlayerVariables();
-
-    /// <summary>
-    /// ボス関連パラメータを登録
-    /// </summary>
-    void RegisterBossVariables();
-
-    /// <summary>
-    /// 弾丸関連パラメータを登録
-    /// </summary>
-    void RegisterProjectileVariables();
-
-    /// <summary>
-    /// 状態関連パラメータを登録
-    /// </summary>
-    void RegisterStateVariables();
-
-    /// <summary>
-    /// AttackState 関連パラメータを登録
-    /// </summary>
-    void RegisterAttackStateVariables();
-
-    /// <summary>
-    /// DashState 関連パラメータを登録
-    /// </summary>
-    void RegisterDashStateVariables();
-
-    /// <summary>
-    /// ParryState 関連パラメータを登録
-    /// </summary>
-    void RegisterParryStateVariables();
-
-    /// <summary>
-    /// ShootState 関連パラメータを登録
-    /// </summary>
-    void RegisterShootStateVariables();
-
     /// <summary>
     /// テクスチャリソースの読み込み
     /// </summary>
@@ -9,6 +9,7 @@
 #include "FrameTimer.h"
 #include "WinApp.h"
 #include "BossBehaviorTree/BossBehaviorTree.h"
+#include "../../BehaviorTree/Core/BTCommandBuffer.h"
 #include "GlobalVariables.h"
 #include "EmitterManager.h"
 #include "State/BossStateMachine.h"
@@ -22,10 +23,38 @@
 #ifdef _DEBUG
 #include "ImGuiManager.h"
 #include "BossNodeEditor/BossNodeEditor.h"
+#include "../../BehaviorTree/Core/BTTreeHotReloader.h"
 #endif
 
 using namespace Tako;
 
+namespace {
+
+// BT の並列評価中に共有システムへの操作を遅延させるためのコマンド
+// （BTCommandBuffer のペイロード。評価後に呼び出しスレッドで元のメソッドを呼び直す）
+struct BossFlagCommand {
+    Boss* boss;
+    bool value;
+};
+
+struct BossFloatCommand {
+    Boss* boss;
+    float value;
+};
+
+struct BossPositionCommand {
+    Boss* boss;
+    Vector3 position;
+};
+
+struct BossBulletCommand {
+    Boss* boss;
+    Vector3 position;
+    Vector3 velocity;
+};
+
+} // namespace
+
 Boss::Boss()
 {
 }
@@ -181,7 +210,7 @@ void Boss::Update(float deltaTime)
         // エディタが有効な場合、実行中のノードをハイライト
         if (stateMachine_->GetCurrentStateName() == "Normal" &&
             nodeEditor_ && showNodeEditor_ && behaviorTree_) {
-            BTNodePtr currentNode = behaviorTree_->GetCurrentRunningNode();
+            BTNode* currentNode = behaviorTree_->GetCurrentRunningNode();
             if (currentNode) {
                 nodeEditor_->HighlightRunningNode(currentNode);
             }
@@ -374,6 +403,32 @@ void Boss::DrawImGui()
                 }
             }
         }
+
+        // 評価方式の切り替え（フラット配列 / ノードグラフ）
+        bool useCompiledTree = behaviorTree_->IsUsingCompiledTree();
+        if (ImGui::Checkbox("Use Compiled Tree", &useCompiledTree)) {
+            behaviorTree_->SetUseCompiledTree(useCompiledTree);
+        }
+        ImGui::SameLine();
+        const BTAgentStatePool* statePool = behaviorTree_->GetStatePool();
+        ImGui::Text("Nodes: %zu  State: %zu bytes x %zu agents", behaviorTree_->GetCompiledTree().GetNodeCount(),
+                    statePool ? statePool->GetStride() : 0, statePool ? statePool->GetAgentCount() : 0);
+
+        // ツリーファイルのホットリロード（保存すると実行状態を保ったまま差分だけ反映）
+        bool hotReload = BossBehaviorTree::IsHotReloadEnabled();
+        if (ImGui::Checkbox("Hot Reload", &hotReload)) {
+            BossBehaviorTree::SetHotReloadEnabled(hotReload);
+        }
+        ImGui::SameLine();
+        if (const BTTreeHotReloader* reloader = behaviorTree_->GetHotReloader()) {
+            const BTTreeHotReloader::ReloadStats& stats = reloader->GetLastStats();
+            ImGui::Text("Gen %u  Reloads %u  (~%u params  +%u  -%u  relink %u)",
+                        reloader->GetGeneration(), reloader->GetReloadCount(),
+                        stats.updatedNodes, stats.createdNodes, stats.removedNodes, stats.relinkedNodes);
+        }
+        else {
+            ImGui::TextDisabled("Not bound to a tree file");
+        }
     }
 
     // HP 操作
@@ -433,18 +488,49 @@ void Boss::DrawImGui()
 }
 
 void Boss::RequestBulletSpawn(const Vector3& position, const Vector3& velocity) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossBulletCommand{ this, position, velocity },
+            [](const BossBulletCommand& c) { c.boss->RequestBulletSpawn(c.position, c.velocity); });
+        return;
+    }
     bulletSpawner_.RequestSpawn(position, velocity);
 }
 
-std::vector<BulletSpawnRequest> Boss::ConsumePendingBullets() {
+void Boss::RequestBulletSpawnBatch(std::span<const BulletSpawnRequest> requests) {
+    if (BTCommandBuffer::GetCurrent()) {
+        // 並列評価中は1発ずつ記録し、エージェント順の決定的な実行に任せる
+        for (const BulletSpawnRequest& request : requests) {
+            RequestBulletSpawn(request.position, request.velocity);
+        }
+        return;
+    }
+    bulletSpawner_.RequestSpawnBatch(requests);
+}
+
+std::span<const BulletSpawnRequest> Boss::ConsumePendingBullets() {
     return bulletSpawner_.Consume();
 }
 
 void Boss::RequestPenetratingBulletSpawn(const Vector3& position, const Vector3& velocity) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossBulletCommand{ this, position, velocity },
+            [](const BossBulletCommand& c) { c.boss->RequestPenetratingBulletSpawn(c.position, c.velocity); });
+        return;
+    }
     penetratingBulletSpawner_.RequestSpawn(position, velocity);
 }
 
-std::vector<BulletSpawnRequest> Boss::ConsumePendingPenetratingBullets() {
+void Boss::RequestPenetratingBulletSpawnBatch(std::span<const BulletSpawnRequest> requests) {
+    if (BTCommandBuffer::GetCurrent()) {
+        for (const BulletSpawnRequest& request : requests) {
+            RequestPenetratingBulletSpawn(request.position, request.velocity);
+        }
+        return;
+    }
+    penetratingBulletSpawner_.RequestSpawnBatch(requests);
+}
+
+std::span<const BulletSpawnRequest> Boss::ConsumePendingPenetratingBullets() {
     return penetratingBulletSpawner_.Consume();
 }
 
@@ -456,30 +542,55 @@ void Boss::SetPlayer(Player* player) {
 }
 
 void Boss::SetAttackSignEmitterActive(bool active) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossFlagCommand{ this, active },
+            [](const BossFlagCommand& c) { c.boss->SetAttackSignEmitterActive(c.value); });
+        return;
+    }
     if (emitterManager_) {
         emitterManager_->SetEmitterActive(attackSignEmitterName_, active);
     }
 }
 
 void Boss::SetAttackSignEmitterPosition(const Vector3& position) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossPositionCommand{ this, position },
+            [](const BossPositionCommand& c) { c.boss->SetAttackSignEmitterPosition(c.position); });
+        return;
+    }
     if (emitterManager_) {
         emitterManager_->SetEmitterPosition(attackSignEmitterName_, position);
     }
 }
 
 void Boss::SetBulletSignEmitterActive(bool active) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossFlagCommand{ this, active },
+            [](const BossFlagCommand& c) { c.boss->SetBulletSignEmitterActive(c.value); });
+        return;
+    }
     if (emitterManager_) {
         emitterManager_->SetEmitterActive(bulletSignEmitterName_, active);
     }
 }
 
 void Boss::SetBulletSignEmitterPosition(const Vector3& position) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossPositionCommand{ this, position },
+            [](const BossPositionCommand& c) { c.boss->SetBulletSignEmitterPosition(c.position); });
+        return;
+    }
     if (emitterManager_) {
         emitterManager_->SetEmitterPosition(bulletSignEmitterName_, position);
     }
 }
 
 void Boss::SetBulletSignEmitterScaleRangeX(float value) {
+    if (BTCommandBuffer* commands = BTCommandBuffer::GetCurrent()) {
+        commands->Push(BossFloatCommand{ this, value },
+            [](const BossFloatCommand& c) { c.boss->SetBulletSignEmitterScaleRangeX(c.value); });
+        return;
+    }
     if (emitterManager_) {
         emitterManager_->SetEmitterScaleRange(
             bulletSignEmitterName_,
@@ -105,11 +105,17 @@ public:
     /// <param name="velocity">弾の速度ベクトル</param>
     void RequestBulletSpawn(const Tako::Vector3& position, const Tako::Vector3& velocity);
 
+    /// <summary>
+    /// 弾生成リクエストをまとめて追加（弾幕パターンのボレー）
+    /// </summary>
+    /// <param name="requests">弾生成リクエストの連続配列</param>
+    void RequestBulletSpawnBatch(std::span<const BulletSpawnRequest> requests);
+
     /// <summary>
     /// 保留中の弾生成リクエストを取得して消費
     /// </summary>
-    /// <returns>弾生成リクエストのリスト（move で返される）</returns>
-    std::vector<BulletSpawnRequest> ConsumePendingBullets();
+    /// <returns>弾生成リクエストの配列（次のフレームの終わりまで有効）</returns>
+    std::span<const BulletSpawnRequest> ConsumePendingBullets();
 
     /// <summary>
     /// 貫通弾生成リクエストを追加
@@ -118,11 +124,17 @@ public:
     /// <param name="velocity">弾の速度ベクトル</param>
     void RequestPenetratingBulletSpawn(const Tako::Vector3& position, const Tako::Vector3& velocity);
 
+    /// <summary>
+    /// 貫通弾生成リクエストをまとめて追加（弾幕パターンのボレー）
+    /// </summary>
+    /// <param name="requests">弾生成リクエストの連続配列</param>
+    void RequestPenetratingBulletSpawnBatch(std::span<const BulletSpawnRequest> requests);
+
     /// <summary>
     /// 保留中の貫通弾生成リクエストを取得して消費
     /// </summary>
-    /// <returns>貫通弾生成リクエストのリスト（move で返される）</returns>
-    std::vector<BulletSpawnRequest> ConsumePendingPenetratingBullets();
+    /// <returns>貫通弾生成リクエストの配列（次のフレームの終わりまで有効）</returns>
+    std::span<const BulletSpawnRequest> ConsumePendingPenetratingBullets();
 
     //-----------------------------Getters/Setters------------------------------//
     /// <summary>
@@ -244,6 +256,8 @@ public:
     //-----------------------------硬直状態システム------------------------------//
     /// <summary>
     /// 硬直フェーズ開始（アクションノードから呼ばれる）
+    /// 硬直・ダッシュのフラグはこのボス自身の状態なので、並列評価中も遅延させず即時に書き換える
+    /// （同じティックで後に評価されるノードが新しい値を読む）
     /// </summary>
     void EnterRecovery();
 
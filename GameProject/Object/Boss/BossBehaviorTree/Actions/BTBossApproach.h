@@ -1,16 +1,27 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
 class Boss;
 class Player;
 
+/// <summary>
+/// 接近アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossApproachState {
+    Tako::Vector3 startPosition;     ///< 開始位置
+    Tako::Vector3 targetPosition;    ///< 目標位置（計算済み）
+    float elapsedTime = 0.0f;        ///< 経過時間
+    float approachDuration = 0.0f;   ///< 接近所要時間（距離から動的計算）
+    bool isFirstExecute = true;      ///< 初回実行フラグ
+};
+
 /// <summary>
 /// ボスのプレイヤー接近アクションノード
 /// プレイヤー方向にイージング移動で素早く接近し、一定距離で停止する
 /// </summary>
-class BTBossApproach : public BTNode {
+class BTBossApproach : public BTStatefulNode<BTBossApproachState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -38,11 +49,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetApproachSpeed() const { return approachSpeed_; }
     void SetApproachSpeed(float speed) { approachSpeed_ = speed; }
@@ -50,10 +56,10 @@ public:
     void SetTargetDistance(float distance) { targetDistance_ = distance; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("approachSpeed")) {
             approachSpeed_ = params["approachSpeed"];
         }
@@ -80,21 +86,22 @@ private:
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="player">プレイヤー</param>
-    void InitializeApproach(Boss* boss, Player* player);
+    /// <param name="state">ランタイム状態</param>
+    void InitializeApproach(Boss* boss, Player* player, BTBossApproachState& state) const;
 
     /// <summary>
     /// 接近移動の更新
     /// </summary>
     /// <param name="boss">ボス</param>
-    /// <param name="deltaTime">経過時間</param>
-    void UpdateApproachMovement(Boss* boss, float deltaTime);
+    /// <param name="state">ランタイム状態</param>
+    void UpdateApproachMovement(Boss* boss, const BTBossApproachState& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Tako::Vector3 ClampToArea(const Tako::Vector3& position);
+    Tako::Vector3 ClampToArea(const Tako::Vector3& position) const;
 
     //=========================================================================================
     // メンバ変数
@@ -103,11 +110,4 @@ private:
     // パラメータ
     float approachSpeed_ = 80.0f;      ///< 接近速度
     float targetDistance_ = 12.0f;     ///< 目標距離（プレイヤーからの距離）
-
-    // 状態管理
-    Tako::Vector3 startPosition_;            ///< 開始位置
-    Tako::Vector3 targetPosition_;           ///< 目標位置（計算済み）
-    float elapsedTime_ = 0.0f;         ///< 経過時間
-    float approachDuration_ = 0.0f;    ///< 接近所要時間（距離から動的計算）
-    bool isFirstExecute_ = true;       ///< 初回実行フラグ
 };
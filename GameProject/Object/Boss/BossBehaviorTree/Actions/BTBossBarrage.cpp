@@ -2,7 +2,6 @@
 #include "../../Boss.h"
 #include "../../../Player/Player.h"
 #include "../../../../Common/GameConst.h"
-#include "RandomEngine.h"
 
 #include <cmath>
 
@@ -18,17 +17,17 @@ BTBossBarrage::BTBossBarrage() {
 
 BTNodeStatus BTBossBarrage::Execute(BTBlackboard* blackboard) {
     Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
+    BTBossBarrageState* state = GetState(blackboard);
+    if (!boss || !state) {
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeBarrage(boss);
-        isFirstExecute_ = false;
+    if (state->isFirstExecute) {
+        InitializeBarrage(boss, *state);
+        state->isFirstExecute = false;
     }
 
     // フェーズ管理: Move → Charge → Firing → Recovery
@@ -37,103 +36,90 @@ BTNodeStatus BTBossBarrage::Execute(BTBlackboard* blackboard) {
     float firingEnd = chargeEnd + firingDuration_;
 
     // Phase: Move（ステージ中央への移動）
-    if (elapsedTime_ < moveEnd) {
-        UpdateMove(boss, deltaTime);
+    if (state->elapsedTime < moveEnd) {
+        UpdateMove(boss, *state);
     }
     // Phase: Charge（射撃予兆）
-    else if (elapsedTime_ < chargeEnd) {
-        bulletSignEffect_.Update(boss, deltaTime);
+    else if (state->elapsedTime < chargeEnd) {
+        state->bulletSignEffect.Update(boss, deltaTime);
     }
     // Phase: Firing（弾幕発射）
-    else if (elapsedTime_ < firingEnd) {
+    else if (state->elapsedTime < firingEnd) {
         // エフェクト終了
-        if (!hasEndedEffect_) {
-            bulletSignEffect_.End(boss);
-            hasEndedEffect_ = true;
+        if (!state->hasEndedEffect) {
+            state->bulletSignEffect.End(boss);
+            state->hasEndedEffect = true;
         }
 
         // 発射間隔チェック
-        timeSinceLastFire_ += deltaTime;
-        if (timeSinceLastFire_ >= fireInterval_) {
-            FireRandomBullet(boss);
-            timeSinceLastFire_ = 0.0f;
+        state->timeSinceLastFire += deltaTime;
+        if (state->timeSinceLastFire >= fireInterval_) {
+            FireRandomBullet(boss, blackboard->GetRandom());
+            state->timeSinceLastFire = 0.0f;
         }
     }
     // Phase: Recovery（硬直）
-    else if (!enteredRecovery_) {
+    else if (!state->enteredRecovery) {
         boss->EnterRecovery();
-        enteredRecovery_ = true;
+        state->enteredRecovery = true;
     }
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state->elapsedTime += deltaTime;
 
     // 状態終了チェック
-    if (elapsedTime_ >= totalDuration_) {
+    if (state->elapsedTime >= state->totalDuration) {
         // 硬直フェーズ終了
         boss->ExitRecovery();
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        timeSinceLastFire_ = 0.0f;
-        hasEndedEffect_ = false;
-        enteredRecovery_ = false;
-        status_ = BTNodeStatus::Success;
+        state->isFirstExecute = true;
+        state->elapsedTime = 0.0f;
+        state->timeSinceLastFire = 0.0f;
+        state->hasEndedEffect = false;
+        state->enteredRecovery = false;
         return BTNodeStatus::Success;
     }
 
     // まだ処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossBarrage::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    timeSinceLastFire_ = 0.0f;
-    isFirstExecute_ = true;
-    hasEndedEffect_ = false;
-    enteredRecovery_ = false;
-}
-
-void BTBossBarrage::InitializeBarrage(Boss* boss) {
+void BTBossBarrage::InitializeBarrage(Boss* boss, BTBossBarrageState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
-    timeSinceLastFire_ = 0.0f;
-    hasEndedEffect_ = false;
-    enteredRecovery_ = false;
+    state.elapsedTime = 0.0f;
+    state.timeSinceLastFire = 0.0f;
+    state.hasEndedEffect = false;
+    state.enteredRecovery = false;
 
     // totalDuration を計算
-    totalDuration_ = moveDuration_ + chargeTime_ + firingDuration_ + recoveryTime_;
+    state.totalDuration = moveDuration_ + chargeTime_ + firingDuration_ + recoveryTime_;
 
     // 開始位置を記録
-    startPosition_ = boss->GetTransform().translate;
+    state.startPosition = boss->GetTransform().translate;
 
     // 目標位置を GameConst から計算（ステージ中央）
     float targetX = (GameConst::kStageXMin + GameConst::kStageXMax) / 2.0f;
     float targetZ = (GameConst::kStageZMin + GameConst::kStageZMax) / 2.0f;
-    targetPosition_ = Vector3(targetX, startPosition_.y, targetZ);
+    state.targetPosition = Vector3(targetX, state.startPosition.y, targetZ);
 
     // 射撃予兆エフェクト開始（チャージフェーズ開始時に表示されるよう準備）
-    bulletSignEffect_.Start(boss, chargeTime_);
+    state.bulletSignEffect.Start(boss, chargeTime_);
 }
 
-void BTBossBarrage::UpdateMove(Boss* boss, float deltaTime) {
-    deltaTime; // 未使用警告抑制
-
-    if (elapsedTime_ < moveDuration_) {
+void BTBossBarrage::UpdateMove(Boss* boss, const BTBossBarrageState& state) const {
+    if (state.elapsedTime < moveDuration_) {
         // 移動中
-        float t = elapsedTime_ / moveDuration_;
+        float t = state.elapsedTime / moveDuration_;
 
         // イージング（加速→減速）
         t = t * t * (kEasingCoeffA - kEasingCoeffB * t);
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
 
         // 目標方向を向く
-        Vector3 direction = targetPosition_ - startPosition_;
+        Vector3 direction = state.targetPosition - state.startPosition;
         direction.y = 0.0f;
         if (direction.Length() > kDirectionEpsilon) {
             direction = direction.Normalize();
@@ -142,30 +128,30 @@ void BTBossBarrage::UpdateMove(Boss* boss, float deltaTime) {
         }
     } else {
         // 移動完了、最終位置に設定
-        boss->SetTranslate(targetPosition_);
+        boss->SetTranslate(state.targetPosition);
     }
 }
 
-void BTBossBarrage::FireRandomBullet(Boss* boss) {
-    // 発射位置
-    Vector3 firePosition = boss->GetTransform().translate;
-
-    // ランダムな方向（XZ 平面）
-    RandomEngine* rng = RandomEngine::GetInstance();
-    Vector3 direction = rng->GetRandomDirectionXZ();
-
+void BTBossBarrage::FireRandomBullet(Boss* boss, BTRandom& random) const {
     // 弾種を確率で決定
-    bool isPenetrating = rng->GetBool(penetratingRatio_);
+    bool isPenetrating = random.GetBool(penetratingRatio_);
 
-    float speed;
+    // +Z を基準に、左右反転して角度 θ を (sinθ, 0, cosθ) の向きにする
+    BulletVolley shot;
+    shot.origin = boss->GetTransform().translate;
+    shot.direction = Vector3(0.0f, 0.0f, 1.0f);
+    shot.mirrored = true;
+
+    thread_local std::vector<BulletSpawnRequest> volley;
+    volley.clear();
     if (isPenetrating) {
         // 貫通弾（遅い）
-        speed = rng->GetFloat(penetratingBulletSpeedMin_, penetratingBulletSpeedMax_);
-        boss->RequestPenetratingBulletSpawn(firePosition, direction * speed);
+        penetratingPattern_.Expand(shot, &random, volley);
+        boss->RequestPenetratingBulletSpawnBatch(volley);
     } else {
         // 通常弾（速い）
-        speed = rng->GetFloat(normalBulletSpeedMin_, normalBulletSpeedMax_);
-        boss->RequestBulletSpawn(firePosition, direction * speed);
+        normalPattern_.Expand(shot, &random, volley);
+        boss->RequestBulletSpawnBatch(volley);
     }
 }
 
@@ -176,11 +162,9 @@ nlohmann::json BTBossBarrage::ExtractParameters() const {
         {"firingDuration", firingDuration_},
         {"recoveryTime", recoveryTime_},
         {"fireInterval", fireInterval_},
-        {"normalBulletSpeedMin", normalBulletSpeedMin_},
-        {"normalBulletSpeedMax", normalBulletSpeedMax_},
-        {"penetratingBulletSpeedMin", penetratingBulletSpeedMin_},
-        {"penetratingBulletSpeedMax", penetratingBulletSpeedMax_},
-        {"penetratingRatio", penetratingRatio_}
+        {"penetratingRatio", penetratingRatio_},
+        {"normalPattern", normalPattern_.ToJson()},
+        {"penetratingPattern", penetratingPattern_.ToJson()}
     };
 }
 
@@ -210,19 +194,13 @@ bool BTBossBarrage::DrawImGui() {
     float fireRate = 1.0f / fireInterval_;
     ImGui::Text("Fire Rate: %.1f shots/sec", fireRate);
 
-    ImGui::SeparatorText("Normal Bullet Speed");
-    if (ImGui::DragFloat("Speed Min##normal", &normalBulletSpeedMin_, 1.0f, 5.0f, 100.0f)) {
-        changed = true;
-    }
-    if (ImGui::DragFloat("Speed Max##normal", &normalBulletSpeedMax_, 1.0f, 5.0f, 100.0f)) {
+    ImGui::SeparatorText("Normal Bullet Pattern");
+    if (normalPattern_.DrawImGui("##normal")) {
         changed = true;
     }
 
-    ImGui::SeparatorText("Penetrating Bullet Speed");
-    if (ImGui::DragFloat("Speed Min##penetrating", &penetratingBulletSpeedMin_, 1.0f, 5.0f, 50.0f)) {
-        changed = true;
-    }
-    if (ImGui::DragFloat("Speed Max##penetrating", &penetratingBulletSpeedMax_, 1.0f, 5.0f, 50.0f)) {
+    ImGui::SeparatorText("Penetrating Bullet Pattern");
+    if (penetratingPattern_.DrawImGui("##penetrating")) {
         changed = true;
     }
 
@@ -1,17 +1,34 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "../../../../Effect/BulletSignEffect.h"
+#include "../../../../Common/BulletPattern.h"
 #include "Vector3.h"
+#include <numbers>
 
 class Boss;
 
+/// <summary>
+/// 弾幕攻撃アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossBarrageState {
+    float totalDuration = 0.0f;          ///< 状態の総時間
+    float elapsedTime = 0.0f;            ///< 経過時間
+    float timeSinceLastFire = 0.0f;      ///< 前回発射からの経過時間
+    bool isFirstExecute = true;          ///< 初回実行フラグ
+    bool hasEndedEffect = false;         ///< エフェクト終了フラグ
+    bool enteredRecovery = false;        ///< 硬直開始フラグ
+    Tako::Vector3 startPosition;         ///< 移動開始位置
+    Tako::Vector3 targetPosition;        ///< 移動目標位置（ステージ中央）
+    BulletSignEffect bulletSignEffect;   ///< 射撃予兆エフェクト
+};
+
 /// <summary>
 /// ボスの弾幕攻撃アクションノード
 /// ステージ中央に移動し、周囲にランダムな方向でランダムな弾を一定時間撃ちまくる
 /// 通常弾（速い）と貫通弾（遅い）を混ぜて発射
 /// </summary>
-class BTBossBarrage : public BTNode {
+class BTBossBarrage : public BTStatefulNode<BTBossBarrageState> {
 public:
     /// <summary>
     /// コンストラクタ
@@ -30,11 +47,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetMoveDuration() const { return moveDuration_; }
     void SetMoveDuration(float time) { moveDuration_ = time; }
@@ -46,22 +58,26 @@ public:
     void SetRecoveryTime(float time) { recoveryTime_ = time; }
     float GetFireInterval() const { return fireInterval_; }
     void SetFireInterval(float interval) { fireInterval_ = interval; }
-    float GetNormalBulletSpeedMin() const { return normalBulletSpeedMin_; }
-    void SetNormalBulletSpeedMin(float speed) { normalBulletSpeedMin_ = speed; }
-    float GetNormalBulletSpeedMax() const { return normalBulletSpeedMax_; }
-    void SetNormalBulletSpeedMax(float speed) { normalBulletSpeedMax_ = speed; }
-    float GetPenetratingBulletSpeedMin() const { return penetratingBulletSpeedMin_; }
-    void SetPenetratingBulletSpeedMin(float speed) { penetratingBulletSpeedMin_ = speed; }
-    float GetPenetratingBulletSpeedMax() const { return penetratingBulletSpeedMax_; }
-    void SetPenetratingBulletSpeedMax(float speed) { penetratingBulletSpeedMax_ = speed; }
+    float GetNormalBulletSpeedMin() const { return normalPattern_.speed; }
+    void SetNormalBulletSpeedMin(float speed) { normalPattern_.speed = speed; }
+    float GetNormalBulletSpeedMax() const { return normalPattern_.speedMax; }
+    void SetNormalBulletSpeedMax(float speed) { normalPattern_.speedMax = speed; }
+    float GetPenetratingBulletSpeedMin() const { return penetratingPattern_.speed; }
+    void SetPenetratingBulletSpeedMin(float speed) { penetratingPattern_.speed = speed; }
+    float GetPenetratingBulletSpeedMax() const { return penetratingPattern_.speedMax; }
+    void SetPenetratingBulletSpeedMax(float speed) { penetratingPattern_.speedMax = speed; }
     float GetPenetratingRatio() const { return penetratingRatio_; }
     void SetPenetratingRatio(float ratio) { penetratingRatio_ = ratio; }
+    const BulletPattern& GetNormalPattern() const { return normalPattern_; }
+    void SetNormalPattern(const BulletPattern& pattern) { normalPattern_ = pattern; }
+    const BulletPattern& GetPenetratingPattern() const { return penetratingPattern_; }
+    void SetPenetratingPattern(const BulletPattern& pattern) { penetratingPattern_ = pattern; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("moveDuration")) {
             moveDuration_ = params["moveDuration"];
         }
@@ -78,20 +94,26 @@ public:
             fireInterval_ = params["fireInterval"];
         }
         if (params.contains("normalBulletSpeedMin")) {
-            normalBulletSpeedMin_ = params["normalBulletSpeedMin"];
+            normalPattern_.speed = params["normalBulletSpeedMin"];
         }
         if (params.contains("normalBulletSpeedMax")) {
-            normalBulletSpeedMax_ = params["normalBulletSpeedMax"];
+            normalPattern_.speedMax = params["normalBulletSpeedMax"];
         }
         if (params.contains("penetratingBulletSpeedMin")) {
-            penetratingBulletSpeedMin_ = params["penetratingBulletSpeedMin"];
+            penetratingPattern_.speed = params["penetratingBulletSpeedMin"];
         }
         if (params.contains("penetratingBulletSpeedMax")) {
-            penetratingBulletSpeedMax_ = params["penetratingBulletSpeedMax"];
+            penetratingPattern_.speedMax = params["penetratingBulletSpeedMax"];
         }
         if (params.contains("penetratingRatio")) {
             penetratingRatio_ = params["penetratingRatio"];
         }
+        if (params.contains("normalPattern")) {
+            normalPattern_.ApplyParameters(params["normalPattern"]);
+        }
+        if (params.contains("penetratingPattern")) {
+            penetratingPattern_.ApplyParameters(params["penetratingPattern"]);
+        }
     }
 
     /// <summary>
@@ -116,20 +138,22 @@ private:
     /// 弾幕パラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeBarrage(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    void InitializeBarrage(Boss* boss, BTBossBarrageState& state) const;
 
     /// <summary>
     /// 移動フェーズの更新
     /// </summary>
     /// <param name="boss">ボス</param>
-    /// <param name="deltaTime">経過時間</param>
-    void UpdateMove(Boss* boss, float deltaTime);
+    /// <param name="state">ランタイム状態</param>
+    void UpdateMove(Boss* boss, const BTBossBarrageState& state) const;
 
     /// <summary>
-    /// ランダムな弾を1発発射
+    /// 弾種を確率で決め、その弾種のパターンで1ボレー発射
     /// </summary>
     /// <param name="boss">ボス</param>
-    void FireRandomBullet(Boss* boss);
+    /// <param name="random">エージェントの乱数生成器</param>
+    void FireRandomBullet(Boss* boss, BTRandom& random) const;
 
     // === 時間制御 ===
     float moveDuration_ = 0.5f;           ///< 移動時間
@@ -138,29 +162,12 @@ private:
     float recoveryTime_ = 0.5f;           ///< 硬直時間
     float fireInterval_ = 0.08f;          ///< 発射間隔
 
-    // === 通常弾速度 ===
-    float normalBulletSpeedMin_ = 20.0f;  ///< 通常弾最低速度
-    float normalBulletSpeedMax_ = 35.0f;  ///< 通常弾最高速度
-
-    // === 貫通弾速度 ===
-    float penetratingBulletSpeedMin_ = 10.0f;   ///< 貫通弾最低速度
-    float penetratingBulletSpeedMax_ = 20.0f;   ///< 貫通弾最高速度
+    // === 弾幕パターン（既定は全周ランダムに1発、speed〜speedMax のランダムな速度） ===
+    BulletPattern normalPattern_{ BulletPatternType::RandomCone, 1, 20.0f, 35.0f, 0.0f,
+        std::numbers::pi_v<float>, std::numbers::pi_v<float> };       ///< 通常弾（速い）
+    BulletPattern penetratingPattern_{ BulletPatternType::RandomCone, 1, 10.0f, 20.0f, 0.0f,
+        std::numbers::pi_v<float>, std::numbers::pi_v<float> };       ///< 貫通弾（遅い）
 
     // === 弾種制御 ===
     float penetratingRatio_ = 0.3f;       ///< 貫通弾の割合（0.0〜1.0）
-
-    // === 状態管理 ===
-    float totalDuration_ = 0.0f;          ///< 状態の総時間
-    float elapsedTime_ = 0.0f;            ///< 経過時間
-    float timeSinceLastFire_ = 0.0f;      ///< 前回発射からの経過時間
-    bool isFirstExecute_ = true;          ///< 初回実行フラグ
-    bool hasEndedEffect_ = false;         ///< エフェクト終了フラグ
-    bool enteredRecovery_ = false;        ///< 硬直開始フラグ
-
-    // === 移動制御 ===
-    Tako::Vector3 startPosition_;         ///< 移動開始位置
-    Tako::Vector3 targetPosition_;        ///< 移動目標位置（ステージ中央）
-
-    // === エフェクト ===
-    BulletSignEffect bulletSignEffect_;   ///< 射撃予兆エフェクト
 };
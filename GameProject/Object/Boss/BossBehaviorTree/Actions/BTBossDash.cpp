@@ -2,10 +2,10 @@
 #include "../../Boss.h"
 #include "../../../Player/Player.h"
 #include "../../../../Common/GameConst.h"
-#include "RandomEngine.h"
 
 #include <algorithm>
 #include <cmath>
+#include <numbers>
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
@@ -19,114 +19,102 @@ BTBossDash::BTBossDash() {
 
 BTNodeStatus BTBossDash::Execute(BTBlackboard* blackboard) {
     Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
+    BTBossDashState* state = GetState(blackboard);
+    if (!boss || !state) {
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeDash(boss);
-        isFirstExecute_ = false;
+    if (state->isFirstExecute) {
+        InitializeDash(boss, *state, blackboard->GetRandom());
+        state->isFirstExecute = false;
         boss->SetDashing(true);  // ダッシュ開始
     }
 
     // ダッシュ移動の更新
-    UpdateDashMovement(boss, deltaTime);
+    UpdateDashMovement(boss, *state);
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state->elapsedTime += deltaTime;
 
     // ダッシュが完了したか確認
-    if (elapsedTime_ >= dashDuration_) {
+    if (state->elapsedTime >= state->duration) {
         // 最終位置に設定
-        boss->SetTranslate(targetPosition_);
+        boss->SetTranslate(state->targetPosition);
 
         // ダッシュ終了
         boss->SetDashing(false);
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        status_ = BTNodeStatus::Success;
+        state->isFirstExecute = true;
+        state->elapsedTime = 0.0f;
         return BTNodeStatus::Success;
     }
 
     // まだダッシュ中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossDash::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
-    // 注意: Reset 時は boss 参照がないため、SetDashing(false)は呼べない
-    // BossBehaviorTree::Update()でのリセット時にも安全に動作するよう
-    // BTBossDash 自体は状態を保持しない設計とする
-}
-
-void BTBossDash::InitializeDash(Boss* boss) {
+void BTBossDash::InitializeDash(Boss* boss, BTBossDashState& state, BTRandom& random) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
+    state.elapsedTime = 0.0f;
+    state.duration = dashDuration_;
 
     // 開始位置を記録
-    startPosition_ = boss->GetTransform().translate;
-
-    // ランダムな方向を生成
-    RandomEngine* rng = RandomEngine::GetInstance();
+    state.startPosition = boss->GetTransform().translate;
 
-    // XZ 平面上のランダムな方向を取得（Y=0で正規化済み）
-    dashDirection_ = rng->GetRandomDirectionXZ();
+    // XZ 平面上のランダムな方向を生成（Y=0で正規化済み）
+    float dashAngle = random.GetFloat(0.0f, 2.0f * std::numbers::pi_v<float>);
+    state.dashDirection = Vector3(sinf(dashAngle), 0.0f, cosf(dashAngle));
 
     // ランダムなダッシュ距離を取得
-    float dashDistance = rng->GetFloat(minDistance_, maxDistance_);
+    float dashDistance = random.GetFloat(minDistance_, maxDistance_);
 
     // 目標位置を計算
-    targetPosition_ = startPosition_ + dashDirection_ * dashDistance;
+    state.targetPosition = state.startPosition + state.dashDirection * dashDistance;
 
     // エリア内に収まるよう調整
-    targetPosition_ = ClampToArea(targetPosition_);
+    state.targetPosition = ClampToArea(state.targetPosition);
 
     // ダッシュ方向を再計算（エリア制限後）
-    dashDirection_ = targetPosition_ - startPosition_;
-    float actualDistance = dashDirection_.Length();
+    state.dashDirection = state.targetPosition - state.startPosition;
+    float actualDistance = state.dashDirection.Length();
     if (actualDistance > kDirectionEpsilon) {
-        dashDirection_ = dashDirection_.Normalize();
+        state.dashDirection = state.dashDirection.Normalize();
         // ダッシュ時間を調整（距離に応じて）
-        dashDuration_ = actualDistance / dashSpeed_;
+        // パラメータは共有されるため、今回の値は状態側に持つ
+        state.duration = actualDistance / dashSpeed_;
     }
 
     // ダッシュ方向を向く
-    if (dashDirection_.Length() > kDirectionEpsilon) {
-        float angle = atan2f(dashDirection_.x, dashDirection_.z);
+    if (state.dashDirection.Length() > kDirectionEpsilon) {
+        float angle = atan2f(state.dashDirection.x, state.dashDirection.z);
         boss->SetRotate(Vector3(0.0f, angle, 0.0f));
     }
 }
 
-void BTBossDash::UpdateDashMovement(Boss* boss, float deltaTime) {
-    deltaTime; // 未使用警告抑制
-    if (elapsedTime_ < dashDuration_) {
+void BTBossDash::UpdateDashMovement(Boss* boss, const BTBossDashState& state) const {
+    if (state.elapsedTime < state.duration) {
         // ダッシュ中の移動
-        float t = elapsedTime_ / dashDuration_;
+        float t = state.elapsedTime / state.duration;
 
         // イージング（加速→減速）
         t = t * t * (kEasingCoeffA - kEasingCoeffB * t);
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
 
         // ダッシュエフェクト的な表現（少し振動させる）
-        float vibration = sinf(elapsedTime_ * vibrationFreq_) * vibrationAmp_;
+        float vibration = sinf(state.elapsedTime * vibrationFreq_) * vibrationAmp_;
         Vector3 currentPos = boss->GetTransform().translate;
         currentPos.y += vibration;
         boss->SetTranslate(currentPos);
     }
 }
 
-Vector3 BTBossDash::ClampToArea(const Vector3& position) {
+Vector3 BTBossDash::ClampToArea(const Vector3& position) const {
     Vector3 clampedPos = position;
 
     // GameConstants のステージ境界を使用
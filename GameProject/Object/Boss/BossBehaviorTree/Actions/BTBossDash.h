@@ -1,14 +1,26 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
 class Boss;
 
+/// <summary>
+/// ダッシュアクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossDashState {
+    Tako::Vector3 dashDirection;   // ダッシュ方向
+    Tako::Vector3 startPosition;   // ダッシュ開始位置
+    Tako::Vector3 targetPosition;  // ダッシュ目標位置
+    float duration = 0.0f;         // 今回のダッシュ時間（距離から算出）
+    float elapsedTime = 0.0f;      // 経過時間
+    bool isFirstExecute = true;    // 初回実行フラグ
+};
+
 /// <summary>
 /// ボスのダッシュアクションノード
 /// </summary>
-class BTBossDash : public BTNode {
+class BTBossDash : public BTStatefulNode<BTBossDashState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -35,11 +47,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetDashSpeed() const { return dashSpeed_; }
     void SetDashSpeed(float speed) { dashSpeed_ = speed; }
@@ -47,10 +54,10 @@ public:
     void SetDashDuration(float duration) { dashDuration_ = duration; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("dashSpeed")) {
             dashSpeed_ = params["dashSpeed"];
         }
@@ -76,43 +83,30 @@ private:
     /// ダッシュパラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeDash(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    /// <param name="random">エージェントの乱数生成器</param>
+    void InitializeDash(Boss* boss, BTBossDashState& state, BTRandom& random) const;
 
     /// <summary>
     /// ダッシュ移動の更新
     /// </summary>
     /// <param name="boss">ボス</param>
-    /// <param name="deltaTime">経過時間</param>
-    void UpdateDashMovement(Boss* boss, float deltaTime);
+    /// <param name="state">ランタイム状態</param>
+    void UpdateDashMovement(Boss* boss, const BTBossDashState& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Tako::Vector3 ClampToArea(const Tako::Vector3& position);
-
-    // ダッシュ方向
-    Tako::Vector3 dashDirection_;
+    Tako::Vector3 ClampToArea(const Tako::Vector3& position) const;
 
     // ダッシュ速度
     float dashSpeed_ = 60.0f;
 
-    // ダッシュ時間
+    // ダッシュ時間（移動距離が短すぎる場合の既定値）
     float dashDuration_ = 0.5f;
 
-    // ダッシュ開始位置
-    Tako::Vector3 startPosition_;
-
-    // ダッシュ目標位置
-    Tako::Vector3 targetPosition_;
-
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
-
     // ダッシュ距離範囲（ImGui 調整用）
     float minDistance_ = 10.0f;  ///< 最小ダッシュ距離
     float maxDistance_ = 50.0f;  ///< 最大ダッシュ距離
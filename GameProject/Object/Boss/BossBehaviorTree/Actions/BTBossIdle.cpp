@@ -1,4 +1,5 @@
 #include "BTBossIdle.h"
+#include "../BossBlackboardKeys.h"
 #include "../../Boss.h"
 #include "../../../Player/Player.h"
 #include "Vector3.h"
@@ -11,53 +12,46 @@
 
 using namespace Tako;
 
-BTBossIdle::BTBossIdle() {
+BTBossIdle::BTBossIdle()
+    : actionCounterKey_(BossBlackboardKeys::kActionCounter) {
     name_ = "BossIdle";
 }
 
 BTNodeStatus BTBossIdle::Execute(BTBlackboard* blackboard) {
     Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
+    BTBossIdleState* state = GetState(blackboard);
+    if (!boss || !state) {
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        elapsedTime_ = 0.0f;
-        isFirstExecute_ = false;
+    if (state->isFirstExecute) {
+        state->elapsedTime = 0.0f;
+        state->isFirstExecute = false;
 
         // 次のアクションカウンターをインクリメント
-        int actionCounter = blackboard->GetInt("ActionCounter", 0);
-        blackboard->SetInt("ActionCounter", actionCounter + 1);
+        int actionCounter = blackboard->GetInt(actionCounterKey_, 0);
+        blackboard->SetInt(actionCounterKey_, actionCounter + 1);
     }
 
     // プレイヤーの方向を向く
     LookAtPlayer(boss, deltaTime);
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state->elapsedTime += deltaTime;
 
     // 待機時間が経過したら成功を返す
-    if (elapsedTime_ >= idleDuration_) {
-        isFirstExecute_ = true;  // 次回実行時のためにリセット
-        status_ = BTNodeStatus::Success;
+    if (state->elapsedTime >= idleDuration_) {
+        state->isFirstExecute = true;  // 次回実行時のためにリセット
         return BTNodeStatus::Success;
     }
 
     // まだ待機中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossIdle::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
-}
-
 void BTBossIdle::LookAtPlayer(Boss* boss, float deltaTime) {
     Player* player = boss->GetPlayer();
     if (!player) {
@@ -1,13 +1,22 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../../BehaviorTree/Core/BTBlackboardKey.h"
 
 class Boss;
 
+/// <summary>
+/// 待機アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossIdleState {
+    float elapsedTime = 0.0f;     // 経過時間
+    bool isFirstExecute = true;   // 初回実行フラグ
+};
+
 /// <summary>
 /// ボスの待機アクションノード
 /// </summary>
-class BTBossIdle : public BTNode {
+class BTBossIdle : public BTStatefulNode<BTBossIdleState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -32,11 +41,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     /// <summary>
     /// 待機時間の設定
     /// </summary>
@@ -50,10 +54,10 @@ public:
     float GetIdleDuration() const { return idleDuration_; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("idleDuration")) {
             idleDuration_ = params["idleDuration"];
         }
@@ -86,9 +90,6 @@ private:
     // 回転速度（ラジアン/秒）
     float rotationSpeed_ = 5.0f;
 
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
+    // アクションカウンターのキー（コンストラクタで解決）
+    BTBlackboardKey actionCounterKey_;
 };
\ No newline at end of file
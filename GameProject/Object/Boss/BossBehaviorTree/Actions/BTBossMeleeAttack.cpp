@@ -5,7 +5,6 @@
 #include "../../../../Common/GameConst.h"
 #include "Object3d.h"
 #include "Mat4x4Func.h"
-#include "RandomEngine.h"
 #include <cmath>
 #include <algorithm>
 
@@ -21,48 +20,48 @@ BTBossMeleeAttack::BTBossMeleeAttack() {
 
 BTNodeStatus BTBossMeleeAttack::Execute(BTBlackboard* blackboard) {
     Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
+    BTBossMeleeAttackState* state = GetState(blackboard);
+    if (!boss || !state) {
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeMeleeAttack(boss);
-        isFirstExecute_ = false;
+    if (state->isFirstExecute) {
+        InitializeMeleeAttack(boss, *state, blackboard->GetRandom());
+        state->isFirstExecute = false;
     }
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
-    phaseTimer_ += deltaTime;
+    state->elapsedTime += deltaTime;
+    state->phaseTimer += deltaTime;
 
     // フェーズに応じた処理
-    switch (currentPhase_) {
+    switch (state->currentPhase) {
     case MeleePhase::Prepare:
-        ProcessPreparePhase(boss, deltaTime);
+        ProcessPreparePhase(boss, deltaTime, *state);
         // 準備時間終了で Execute フェーズへ
-        if (phaseTimer_ >= prepareTime_) {
-            currentPhase_ = MeleePhase::Execute;
-            phaseTimer_ = 0.0f;
+        if (state->phaseTimer >= prepareTime_) {
+            state->currentPhase = MeleePhase::Execute;
+            state->phaseTimer = 0.0f;
             // 予兆エフェクトを OFF
             boss->SetAttackSignEmitterActive(false);
             // コライダーを有効化
             if (boss->GetMeleeAttackCollider()) {
                 boss->GetMeleeAttackCollider()->SetActive(true);
                 boss->GetMeleeAttackCollider()->Reset();
-                colliderActivated_ = true;
+                state->colliderActivated = true;
             }
             // 突進の初期化（Execute 開始時にプレイヤー位置を確定）
-            InitializeRush(boss);
+            InitializeRush(boss, *state);
         }
         break;
 
     case MeleePhase::Execute:
-        ProcessExecutePhase(boss, deltaTime);
+        ProcessExecutePhase(boss, deltaTime, *state);
         // 攻撃時間終了で次のフェーズへ
-        if (phaseTimer_ >= attackDuration_) {
+        if (state->phaseTimer >= attackDuration_) {
             // コライダーを無効化
             if (boss->GetMeleeAttackCollider()) {
                 boss->GetMeleeAttackCollider()->SetActive(false);
@@ -71,14 +70,14 @@ BTNodeStatus BTBossMeleeAttack::Execute(BTBlackboard* blackboard) {
             boss->SetMeleeAttackBlockVisible(false);
 
             // 次のフェーズを決定
-            if (comboIndex_ < comboMaxCount_ - 1) {
+            if (state->comboIndex < state->comboMaxCount - 1) {
                 // まだコンボが残っている → Interval へ
-                currentPhase_ = MeleePhase::Interval;
-                phaseTimer_ = 0.0f;
+                state->currentPhase = MeleePhase::Interval;
+                state->phaseTimer = 0.0f;
             } else {
                 // コンボ完了 → Recovery へ
-                currentPhase_ = MeleePhase::Recovery;
-                phaseTimer_ = 0.0f;
+                state->currentPhase = MeleePhase::Recovery;
+                state->phaseTimer = 0.0f;
                 boss->EnterRecovery();  // 硬直フェーズ開始
             }
         }
@@ -87,11 +86,11 @@ BTNodeStatus BTBossMeleeAttack::Execute(BTBlackboard* blackboard) {
     case MeleePhase::Interval:
         ProcessIntervalPhase(boss, deltaTime);
         // コンボ間隔終了で次の攻撃準備へ
-        if (phaseTimer_ >= comboInterval_) {
-            comboIndex_++;
+        if (state->phaseTimer >= comboInterval_) {
+            state->comboIndex++;
 
             // 次の攻撃の振り方向を初期化
-            InitializeSwingForCurrentCombo();
+            InitializeSwingForCurrentCombo(*state);
 
             // ブロックを再表示
             boss->SetMeleeAttackBlockVisible(true);
@@ -100,76 +99,56 @@ BTNodeStatus BTBossMeleeAttack::Execute(BTBlackboard* blackboard) {
             boss->SetAttackSignEmitterActive(true);
 
             // ブロック位置を更新
-            UpdateBlockPosition(boss);
+            UpdateBlockPosition(boss, *state);
 
             // Prepare フェーズへ（1撃目と同じ挙動）
-            currentPhase_ = MeleePhase::Prepare;
-            phaseTimer_ = 0.0f;
+            state->currentPhase = MeleePhase::Prepare;
+            state->phaseTimer = 0.0f;
         }
         break;
 
     case MeleePhase::Recovery:
         ProcessRecoveryPhase(boss);
         // 硬直時間終了で完了
-        if (phaseTimer_ >= recoveryTime_) {
+        if (state->phaseTimer >= recoveryTime_) {
             // 硬直フェーズ終了
             boss->ExitRecovery();
 
             // リセットして成功を返す
-            isFirstExecute_ = true;
-            elapsedTime_ = 0.0f;
-            phaseTimer_ = 0.0f;
-            currentPhase_ = MeleePhase::Prepare;
-            colliderActivated_ = false;
-            status_ = BTNodeStatus::Success;
+            state->isFirstExecute = true;
+            state->elapsedTime = 0.0f;
+            state->phaseTimer = 0.0f;
+            state->currentPhase = MeleePhase::Prepare;
+            state->colliderActivated = false;
             return BTNodeStatus::Success;
         }
         break;
     }
 
     // まだ処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossMeleeAttack::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    phaseTimer_ = 0.0f;
-    blockAngle_ = 0.0f;
-    isFirstExecute_ = true;
-    currentPhase_ = MeleePhase::Prepare;
-    colliderActivated_ = false;
-    rushInitialized_ = false;
-
-    // コンボ状態のリセット
-    isComboMode_ = false;
-    comboMaxCount_ = 1;
-    comboIndex_ = 0;
-    currentSwingDirection_ = 1.0f;
-    // 注意: Reset 時は boss 参照がないため、ExitRecovery()は呼べない
-}
-
-void BTBossMeleeAttack::InitializeMeleeAttack(Boss* boss) {
+void BTBossMeleeAttack::InitializeMeleeAttack(Boss* boss, BTBossMeleeAttackState& state, BTRandom& random) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
-    phaseTimer_ = 0.0f;
-    currentPhase_ = MeleePhase::Prepare;
-    colliderActivated_ = false;
+    state.elapsedTime = 0.0f;
+    state.phaseTimer = 0.0f;
+    state.currentPhase = MeleePhase::Prepare;
+    state.colliderActivated = false;
 
     // コンボモードをランダム決定
-    isComboMode_ = Tako::RandomEngine::GetInstance()->GetBool(comboProbability_);
-    comboMaxCount_ = isComboMode_ ? 3 : 1;
-    comboIndex_ = 0;
+    state.isComboMode = random.GetBool(comboProbability_);
+    state.comboMaxCount = state.isComboMode ? 3 : 1;
+    state.comboIndex = 0;
 
     // 最初の攻撃の振り方向を初期化
-    InitializeSwingForCurrentCombo();
+    InitializeSwingForCurrentCombo(state);
 
     // totalDuration を計算（コンボ時は長くなる）
-    if (isComboMode_) {
-        totalDuration_ = prepareTime_ + (attackDuration_ * 3) + (comboInterval_ * 2) + recoveryTime_;
+    if (state.isComboMode) {
+        state.totalDuration = prepareTime_ + (attackDuration_ * 3) + (comboInterval_ * 2) + recoveryTime_;
     } else {
-        totalDuration_ = prepareTime_ + attackDuration_ + recoveryTime_;
+        state.totalDuration = prepareTime_ + attackDuration_ + recoveryTime_;
     }
 
     // ブロックを表示
@@ -179,13 +158,13 @@ void BTBossMeleeAttack::InitializeMeleeAttack(Boss* boss) {
     boss->SetAttackSignEmitterActive(true);
 
     // 初期位置を設定
-    UpdateBlockPosition(boss);
+    UpdateBlockPosition(boss, state);
 
     // 突進フラグをリセット（Execute 開始時に初期化する）
-    rushInitialized_ = false;
+    state.rushInitialized = false;
 }
 
-void BTBossMeleeAttack::AimAtPlayer(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::AimAtPlayer(Boss* boss, float deltaTime) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -218,12 +197,12 @@ void BTBossMeleeAttack::AimAtPlayer(Boss* boss, float deltaTime) {
     }
 }
 
-void BTBossMeleeAttack::ProcessPreparePhase(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::ProcessPreparePhase(Boss* boss, float deltaTime, const BTBossMeleeAttackState& state) const {
     // プレイヤーの方向を向く
     AimAtPlayer(boss, deltaTime);
 
     // ブロック位置を更新（振らない、開始位置に固定）
-    UpdateBlockPosition(boss);
+    UpdateBlockPosition(boss, state);
 
     // 予兆エフェクトの位置を更新
     Object3d* block = boss->GetMeleeAttackBlock();
@@ -232,7 +211,7 @@ void BTBossMeleeAttack::ProcessPreparePhase(Boss* boss, float deltaTime) {
     }
 }
 
-void BTBossMeleeAttack::ProcessExecutePhase(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::ProcessExecutePhase(Boss* boss, float deltaTime, BTBossMeleeAttackState& state) const {
     // ヒット判定をチェック
     BossMeleeAttackCollider* collider = boss->GetMeleeAttackCollider();
     bool hasHit = collider && collider->HasHitPlayer();
@@ -258,45 +237,45 @@ void BTBossMeleeAttack::ProcessExecutePhase(Boss* boss, float deltaTime) {
         }
     } else {
         // ミス時: 通常通り突進
-        float t = phaseTimer_ / attackDuration_;
+        float t = state.phaseTimer / attackDuration_;
         t = std::clamp(t, 0.0f, 1.0f);
         t = t * t * (3.0f - 2.0f * t);  // Smoothstep
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
     }
 
     // ブロックを回転させる（振り方向を考慮）
-    float rotationSpeed = swingAngle_ / attackDuration_ * currentSwingDirection_;
-    blockAngle_ += rotationSpeed * deltaTime;
+    float rotationSpeed = swingAngle_ / attackDuration_ * state.currentSwingDirection;
+    state.blockAngle += rotationSpeed * deltaTime;
 
     // ブロック位置を更新
-    UpdateBlockPosition(boss);
+    UpdateBlockPosition(boss, state);
 }
 
-void BTBossMeleeAttack::ProcessRecoveryPhase(Boss* boss) {
+void BTBossMeleeAttack::ProcessRecoveryPhase(Boss* boss) const {
     // 硬直中は特に処理なし
     (void)boss;
 }
 
-void BTBossMeleeAttack::ProcessIntervalPhase(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::ProcessIntervalPhase(Boss* boss, float deltaTime) const {
     // コンボ間隔中はプレイヤー方向を向き続ける
     AimAtPlayer(boss, deltaTime);
 }
 
-void BTBossMeleeAttack::InitializeSwingForCurrentCombo() {
-    if (comboIndex_ % 2 == 0) {
+void BTBossMeleeAttack::InitializeSwingForCurrentCombo(BTBossMeleeAttackState& state) const {
+    if (state.comboIndex % 2 == 0) {
         // 偶数撃目（0, 2）：右→左
-        blockAngle_ = kBlockStartAngle;  // -π/2
-        currentSwingDirection_ = 1.0f;
+        state.blockAngle = kBlockStartAngle;  // -π/2
+        state.currentSwingDirection = 1.0f;
     } else {
         // 奇数撃目（1）：左→右
-        blockAngle_ = -kBlockStartAngle; // +π/2
-        currentSwingDirection_ = -1.0f;
+        state.blockAngle = -kBlockStartAngle; // +π/2
+        state.currentSwingDirection = -1.0f;
     }
 }
 
-Vector3 BTBossMeleeAttack::ClampToArea(const Vector3& position) {
+Vector3 BTBossMeleeAttack::ClampToArea(const Vector3& position) const {
     Vector3 clampedPos = position;
     clampedPos.x = std::clamp(clampedPos.x,
         GameConst::kStageXMin + GameConst::kAreaMargin,
@@ -308,37 +287,37 @@ Vector3 BTBossMeleeAttack::ClampToArea(const Vector3& position) {
     return clampedPos;
 }
 
-void BTBossMeleeAttack::InitializeRush(Boss* boss) {
-    rushInitialized_ = true;
-    startPosition_ = boss->GetTransform().translate;
+void BTBossMeleeAttack::InitializeRush(Boss* boss, BTBossMeleeAttackState& state) const {
+    state.rushInitialized = true;
+    state.startPosition = boss->GetTransform().translate;
 
     Player* player = boss->GetPlayer();
     if (player) {
         Vector3 playerPos = player->GetTransform().translate;
-        Vector3 toPlayer = playerPos - startPosition_;
+        Vector3 toPlayer = playerPos - state.startPosition;
         toPlayer.y = 0.0f;
 
         if (toPlayer.Length() > kDirectionEpsilon) {
-            rushDirection_ = toPlayer.Normalize();
+            state.rushDirection = toPlayer.Normalize();
 
             // 突進方向に向く
-            float angle = atan2f(rushDirection_.x, rushDirection_.z);
+            float angle = atan2f(state.rushDirection.x, state.rushDirection.z);
             boss->SetRotate(Vector3(0.0f, angle, 0.0f));
 
             // 目標位置 = 開始位置 + 方向 * 突進距離
-            targetPosition_ = startPosition_ + rushDirection_ * rushDistance_;
-            targetPosition_ = ClampToArea(targetPosition_);
+            state.targetPosition = state.startPosition + state.rushDirection * rushDistance_;
+            state.targetPosition = ClampToArea(state.targetPosition);
         } else {
-            rushDirection_ = Vector3(0.0f, 0.0f, 1.0f);
-            targetPosition_ = startPosition_;
+            state.rushDirection = Vector3(0.0f, 0.0f, 1.0f);
+            state.targetPosition = state.startPosition;
         }
     } else {
-        rushDirection_ = Vector3(0.0f, 0.0f, 1.0f);
-        targetPosition_ = startPosition_;
+        state.rushDirection = Vector3(0.0f, 0.0f, 1.0f);
+        state.targetPosition = state.startPosition;
     }
 }
 
-void BTBossMeleeAttack::UpdateBlockPosition(Boss* boss) {
+void BTBossMeleeAttack::UpdateBlockPosition(Boss* boss, const BTBossMeleeAttackState& state) const {
     Object3d* block = boss->GetMeleeAttackBlock();
     if (!block) return;
 
@@ -347,7 +326,7 @@ void BTBossMeleeAttack::UpdateBlockPosition(Boss* boss) {
     float bossRotY = boss->GetRotate().y;
 
     // ワールド空間での角度を計算
-    float worldAngle = bossRotY + blockAngle_;
+    float worldAngle = bossRotY + state.blockAngle;
 
     // Mat4x4::MakeRotateY で回転行列を作成
     Matrix4x4 rotationMatrix = Mat4x4::MakeRotateY(worldAngle);
@@ -369,7 +348,7 @@ void BTBossMeleeAttack::UpdateBlockPosition(Boss* boss) {
 
     // コライダーの向き設定（ボスの向きに追従）
     BossMeleeAttackCollider* collider = boss->GetMeleeAttackCollider();
-    if (collider && colliderActivated_) {
+    if (collider && state.colliderActivated) {
         collider->SetOrientation(Mat4x4::MakeRotateY(bossRotY));
     }
 }
@@ -428,13 +407,6 @@ bool BTBossMeleeAttack::DrawImGui() {
         changed = true;
     }
 
-    // デバッグ表示
-    ImGui::Separator();
-    ImGui::Text("Debug Info:");
-    ImGui::Text("Mode: %s", isComboMode_ ? "COMBO (3 hits)" : "SINGLE (1 hit)");
-    ImGui::Text("Combo: %d / %d", comboIndex_ + 1, comboMaxCount_);
-    ImGui::Text("Swing Direction: %s", currentSwingDirection_ > 0 ? "Right->Left" : "Left->Right");
-
     return changed;
 }
 #endif
@@ -1,17 +1,55 @@
 #pragma once
 #include <numbers>
 
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
 class Boss;
 
+/// <summary>
+/// 近接攻撃アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossMeleeAttackState {
+    /// <summary>
+    /// 攻撃フェーズ
+    /// </summary>
+    enum class Phase {
+        Prepare,    ///< 準備フェーズ（プレイヤー方向を向く、予兆表示）
+        Execute,    ///< 攻撃実行フェーズ（ブロック回転、ダメージ判定）
+        Interval,   ///< コンボ間隔フェーズ（次の攻撃までの待機）
+        Recovery    ///< 硬直フェーズ
+    };
+
+    // フェーズ管理
+    Phase currentPhase = Phase::Prepare;
+
+    // 時間・ブロック
+    float totalDuration = 1.6f;           ///< 総時間
+    float blockAngle = 0.0f;              ///< 現在のブロック角度
+    float elapsedTime = 0.0f;             ///< 経過時間
+    float phaseTimer = 0.0f;              ///< 現在フェーズのタイマー
+    bool isFirstExecute = true;           ///< 初回実行フラグ
+    bool colliderActivated = false;       ///< コライダー有効化済みフラグ
+
+    // 突進
+    Tako::Vector3 startPosition;          ///< 突進開始位置
+    Tako::Vector3 targetPosition;         ///< 突進目標位置（Execute 開始時に固定）
+    Tako::Vector3 rushDirection;          ///< 突進方向
+    bool rushInitialized = false;         ///< 突進初期化済みフラグ
+
+    // コンボ
+    bool isComboMode = false;             ///< コンボモードフラグ
+    int comboMaxCount = 1;                ///< 最大攻撃回数（単発:1, コンボ:3）
+    int comboIndex = 0;                   ///< 現在の攻撃回数（0-indexed）
+    float currentSwingDirection = 1.0f;   ///< 振り方向（+1:右→左, -1:左→右）
+};
+
 /// <summary>
 /// ボスの近接攻撃アクションノード
 /// 準備→攻撃→硬直の3フェーズで武器ブロックを振る
 /// </summary>
-class BTBossMeleeAttack : public BTNode {
+class BTBossMeleeAttack : public BTStatefulNode<BTBossMeleeAttackState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -20,19 +58,10 @@ private:
     static constexpr float kBlockStartAngle = -std::numbers::pi_v<float> / 2.0f; ///< ブロック開始角度（-π/2、右側から開始）
     static constexpr float kAngleEpsilon = 0.001f;      ///< 角度判定の閾値
 
-    //=========================================================================================
-    // 列挙型
-    //=========================================================================================
-private:
     /// <summary>
     /// 攻撃フェーズ
     /// </summary>
-    enum class MeleePhase {
-        Prepare,    ///< 準備フェーズ（プレイヤー方向を向く、予兆表示）
-        Execute,    ///< 攻撃実行フェーズ（ブロック回転、ダメージ判定）
-        Interval,   ///< コンボ間隔フェーズ（次の攻撃までの待機）
-        Recovery    ///< 硬直フェーズ
-    };
+    using MeleePhase = BTBossMeleeAttackState::Phase;
 
 public:
     /// <summary>
@@ -52,11 +81,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetPrepareTime() const { return prepareTime_; }
     void SetPrepareTime(float time) { prepareTime_ = time; }
@@ -76,10 +100,10 @@ public:
     void SetStopDistance(float distance) { stopDistance_ = distance; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("prepareTime")) {
             prepareTime_ = params["prepareTime"];
         }
@@ -129,108 +153,92 @@ private:
     /// 攻撃パラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeMeleeAttack(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    /// <param name="random">エージェントの乱数生成器</param>
+    void InitializeMeleeAttack(Boss* boss, BTBossMeleeAttackState& state, BTRandom& random) const;
 
     /// <summary>
     /// プレイヤー方向を向く処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    void AimAtPlayer(Boss* boss, float deltaTime) const;
 
     /// <summary>
     /// 準備フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void ProcessPreparePhase(Boss* boss, float deltaTime);
+    /// <param name="state">ランタイム状態</param>
+    void ProcessPreparePhase(Boss* boss, float deltaTime, const BTBossMeleeAttackState& state) const;
 
     /// <summary>
     /// 攻撃実行フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void ProcessExecutePhase(Boss* boss, float deltaTime);
+    /// <param name="state">ランタイム状態</param>
+    void ProcessExecutePhase(Boss* boss, float deltaTime, BTBossMeleeAttackState& state) const;
 
     /// <summary>
     /// 硬直フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
-    void ProcessRecoveryPhase(Boss* boss);
+    void ProcessRecoveryPhase(Boss* boss) const;
 
     /// <summary>
     /// コンボ間隔フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void ProcessIntervalPhase(Boss* boss, float deltaTime);
+    void ProcessIntervalPhase(Boss* boss, float deltaTime) const;
 
     /// <summary>
     /// 現在のコンボインデックスに応じた振り方向を初期化
     /// </summary>
-    void InitializeSwingForCurrentCombo();
+    /// <param name="state">ランタイム状態</param>
+    void InitializeSwingForCurrentCombo(BTBossMeleeAttackState& state) const;
 
     /// <summary>
     /// ブロック位置の更新（Mat4x4使用）
     /// </summary>
     /// <param name="boss">ボス</param>
-    void UpdateBlockPosition(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    void UpdateBlockPosition(Boss* boss, const BTBossMeleeAttackState& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Tako::Vector3 ClampToArea(const Tako::Vector3& position);
+    Tako::Vector3 ClampToArea(const Tako::Vector3& position) const;
 
     /// <summary>
     /// 突進の初期化（Execute 開始時に呼ぶ）
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeRush(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    void InitializeRush(Boss* boss, BTBossMeleeAttackState& state) const;
 
     //=========================================================================================
     // メンバ変数
     //=========================================================================================
 private:
-    // フェーズ管理
-    MeleePhase currentPhase_ = MeleePhase::Prepare;
-
     // 時間パラメータ
     float prepareTime_ = 1.0f;      ///< 準備時間
     float attackDuration_ = 0.3f;   ///< 攻撃持続時間
     float recoveryTime_ = 0.3f;     ///< 硬直時間
-    float totalDuration_ = 1.6f;    ///< 総時間
 
     // ブロックパラメータ
     float blockRadius_ = 8.0f;      ///< ボスからの距離
     float blockScale_ = 0.5f;       ///< ブロックスケール
     float swingAngle_ =             ///< 振り幅（π = 180度）
         static_cast<float>(std::numbers::pi);
-    float blockAngle_ = 0.0f;       ///< 現在のブロック角度
-
-    // 状態管理
-    float elapsedTime_ = 0.0f;      ///< 経過時間
-    float phaseTimer_ = 0.0f;       ///< 現在フェーズのタイマー
-    bool isFirstExecute_ = true;    ///< 初回実行フラグ
-    bool colliderActivated_ = false;///< コライダー有効化済みフラグ
 
     // 突進パラメータ
     float rushDistance_ = 20.0f;    ///< 突進距離（ミス時）
     float stopDistance_ = 5.0f;     ///< ヒット時の停止距離（プレイヤーからの距離）
 
-    // 突進状態管理
-    Tako::Vector3 startPosition_;         ///< 突進開始位置
-    Tako::Vector3 targetPosition_;        ///< 突進目標位置（Execute 開始時に固定）
-    Tako::Vector3 rushDirection_;         ///< 突進方向
-    bool rushInitialized_ = false;  ///< 突進初期化済みフラグ
-
-    // コンボ管理
-    bool isComboMode_ = false;           ///< コンボモードフラグ
-    int comboMaxCount_ = 1;              ///< 最大攻撃回数（単発:1, コンボ:3）
-    int comboIndex_ = 0;                 ///< 現在の攻撃回数（0-indexed）
-    float currentSwingDirection_ = 1.0f; ///< 振り方向（+1:右→左, -1:左→右）
-
     // コンボパラメータ（GlobalVariables 連携）
     float comboInterval_ = 0.5f;         ///< コンボ間隔（デフォルト0.5秒）
     float comboProbability_ = 0.5f;      ///< コンボ発動確率（デフォルト50%）
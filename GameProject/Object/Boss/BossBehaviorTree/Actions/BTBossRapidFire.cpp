@@ -16,43 +16,43 @@ BTBossRapidFire::BTBossRapidFire() {
 
 BTNodeStatus BTBossRapidFire::Execute(BTBlackboard* blackboard) {
     Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
+    BTBossRapidFireState* state = GetState(blackboard);
+    if (!boss || !state) {
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeRapidFire(boss);
-        isFirstExecute_ = false;
+    if (state->isFirstExecute) {
+        InitializeRapidFire(boss, *state);
+        state->isFirstExecute = false;
     }
 
     // フェーズ1: チャージ中（プレイヤーに照準）
-    if (elapsedTime_ < chargeTime_) {
+    if (state->elapsedTime < chargeTime_) {
         AimAtPlayer(boss, deltaTime);
-        bulletSignEffect_.Update(boss, deltaTime);
+        state->bulletSignEffect.Update(boss, deltaTime);
     }
     // フェーズ2: 連続発射中（追尾しながら発射）
-    else if (firedCount_ < bulletCount_) {
+    else if (state->firedCount < bulletCount_) {
         // 最初の発射開始時にエフェクト終了
-        if (bulletSignEffect_.IsActive()) {
-            bulletSignEffect_.End(boss);
+        if (state->bulletSignEffect.IsActive()) {
+            state->bulletSignEffect.End(boss);
         }
 
         // 発射中もプレイヤー方向を追尾
         AimAtPlayer(boss, deltaTime);
 
         // 発射間隔チェック
-        timeSinceLastFire_ += deltaTime;
-        if (timeSinceLastFire_ >= fireInterval_) {
-            FireBullet(boss);
-            firedCount_++;
-            timeSinceLastFire_ = 0.0f;
+        state->timeSinceLastFire += deltaTime;
+        if (state->timeSinceLastFire >= fireInterval_) {
+            FireBullet(boss, blackboard->GetRandom());
+            state->firedCount++;
+            state->timeSinceLastFire = 0.0f;
 
             // 最後の弾を発射したら硬直フェーズ開始
-            if (firedCount_ >= bulletCount_) {
+            if (state->firedCount >= bulletCount_) {
                 boss->EnterRecovery();
             }
         }
@@ -60,52 +60,41 @@ BTNodeStatus BTBossRapidFire::Execute(BTBlackboard* blackboard) {
     // フェーズ3: 硬直中（何もしない）
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state->elapsedTime += deltaTime;
 
     // 状態終了チェック
-    if (elapsedTime_ >= totalDuration_) {
+    if (state->elapsedTime >= state->totalDuration) {
         // 硬直フェーズ終了
         boss->ExitRecovery();
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        firedCount_ = 0;
-        timeSinceLastFire_ = 0.0f;
-        status_ = BTNodeStatus::Success;
+        state->isFirstExecute = true;
+        state->elapsedTime = 0.0f;
+        state->firedCount = 0;
+        state->timeSinceLastFire = 0.0f;
         return BTNodeStatus::Success;
     }
 
     // まだ射撃処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossRapidFire::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    firedCount_ = 0;
-    timeSinceLastFire_ = 0.0f;
-    isFirstExecute_ = true;
-    // 注意: Reset 時は boss 参照がないため、ExitRecovery()は呼べない
-}
-
-void BTBossRapidFire::InitializeRapidFire(Boss* boss) {
+void BTBossRapidFire::InitializeRapidFire(Boss* boss, BTBossRapidFireState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
-    firedCount_ = 0;
+    state.elapsedTime = 0.0f;
+    state.firedCount = 0;
     // 即座に1発目を撃てるように
-    timeSinceLastFire_ = fireInterval_;
+    state.timeSinceLastFire = fireInterval_;
 
     // totalDuration を計算
     // チャージ時間 + (発射間隔 × 弾数) + 硬直時間
-    totalDuration_ = chargeTime_ + (fireInterval_ * static_cast<float>(bulletCount_)) + recoveryTime_;
+    state.totalDuration = chargeTime_ + (fireInterval_ * static_cast<float>(bulletCount_)) + recoveryTime_;
 
     // 射撃予兆エフェクト開始
-    bulletSignEffect_.Start(boss, chargeTime_);
+    state.bulletSignEffect.Start(boss, chargeTime_);
 }
 
-void BTBossRapidFire::AimAtPlayer(Boss* boss, float deltaTime) {
+void BTBossRapidFire::AimAtPlayer(Boss* boss, float deltaTime) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -123,21 +112,20 @@ void BTBossRapidFire::AimAtPlayer(Boss* boss, float deltaTime) {
     }
 }
 
-void BTBossRapidFire::FireBullet(Boss* boss) {
-    // 発射位置（ボスの座標）
-    Vector3 firePosition = boss->GetTransform().translate;
-
-    // プレイヤーへの方向を計算
-    Vector3 direction = CalculateDirectionToPlayer(boss);
-
-    // 弾の速度ベクトルを計算
-    Vector3 bulletVelocity = direction * bulletSpeed_;
-
-    // ボスに弾生成をリクエスト
-    boss->RequestBulletSpawn(firePosition, bulletVelocity);
+void BTBossRapidFire::FireBullet(Boss* boss, BTRandom& random) const {
+    // 発射位置（ボスの座標）とプレイヤーへの方向
+    BulletVolley shot;
+    shot.origin = boss->GetTransform().translate;
+    shot.direction = CalculateDirectionToPlayer(boss);
+
+    // パターンを展開してまとめてリクエスト
+    thread_local std::vector<BulletSpawnRequest> volley;
+    volley.clear();
+    pattern_.Expand(shot, &random, volley);
+    boss->RequestBulletSpawnBatch(volley);
 }
 
-Vector3 BTBossRapidFire::CalculateDirectionToPlayer(Boss* boss) {
+Vector3 BTBossRapidFire::CalculateDirectionToPlayer(Boss* boss) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         // プレイヤーがいない場合は前方向を返す
@@ -165,8 +153,8 @@ nlohmann::json BTBossRapidFire::ExtractParameters() const {
         {"chargeTime", chargeTime_},
         {"bulletCount", bulletCount_},
         {"fireInterval", fireInterval_},
-        {"bulletSpeed", bulletSpeed_},
-        {"recoveryTime", recoveryTime_}
+        {"recoveryTime", recoveryTime_},
+        {"pattern", pattern_.ToJson()}
     };
 }
 
@@ -177,16 +165,18 @@ bool BTBossRapidFire::DrawImGui() {
     if (ImGui::DragFloat("Charge Time##rapidfire", &chargeTime_, 0.05f, 0.0f, 3.0f)) {
         changed = true;
     }
-    if (ImGui::DragInt("Bullet Count##rapidfire", &bulletCount_, 1, 1, 20)) {
+    if (ImGui::DragInt("Volley Count##rapidfire", &bulletCount_, 1, 1, 20)) {
         changed = true;
     }
     if (ImGui::DragFloat("Fire Interval##rapidfire", &fireInterval_, 0.01f, 0.05f, 1.0f)) {
         changed = true;
     }
-    if (ImGui::DragFloat("Bullet Speed##rapidfire", &bulletSpeed_, 1.0f, 5.0f, 100.0f)) {
+    if (ImGui::DragFloat("Recovery Time##rapidfire", &recoveryTime_, 0.05f, 0.0f, 3.0f)) {
         changed = true;
     }
-    if (ImGui::DragFloat("Recovery Time##rapidfire", &recoveryTime_, 0.05f, 0.0f, 3.0f)) {
+
+    ImGui::SeparatorText("Pattern");
+    if (pattern_.DrawImGui("##rapidfire")) {
         changed = true;
     }
 
@@ -1,17 +1,30 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "../../../../Effect/BulletSignEffect.h"
+#include "../../../../Common/BulletPattern.h"
 #include "Vector3.h"
 
 class Boss;
 
+/// <summary>
+/// 連射アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossRapidFireState {
+    float totalDuration = 0.0f;          // 状態の総時間
+    float elapsedTime = 0.0f;            // 経過時間
+    int firedCount = 0;                  // 発射済み弾数
+    float timeSinceLastFire = 0.0f;      // 前回発射からの経過時間
+    bool isFirstExecute = true;          // 初回実行フラグ
+    BulletSignEffect bulletSignEffect;   // 射撃予兆エフェクト
+};
+
 /// <summary>
 /// ボスの連続追尾射撃アクションノード
 /// プレイヤー方向に連続で弾を発射する攻撃パターン
 /// 発射中もプレイヤーの方向を追尾し続ける
 /// </summary>
-class BTBossRapidFire : public BTNode {
+class BTBossRapidFire : public BTStatefulNode<BTBossRapidFireState> {
 public:
     /// <summary>
     /// コンストラクタ
@@ -30,11 +43,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetChargeTime() const { return chargeTime_; }
     void SetChargeTime(float time) { chargeTime_ = time; }
@@ -42,16 +50,16 @@ public:
     void SetBulletCount(int count) { bulletCount_ = count; }
     float GetFireInterval() const { return fireInterval_; }
     void SetFireInterval(float interval) { fireInterval_ = interval; }
-    float GetBulletSpeed() const { return bulletSpeed_; }
-    void SetBulletSpeed(float speed) { bulletSpeed_ = speed; }
+    float GetBulletSpeed() const { return pattern_.speed; }
+    void SetBulletSpeed(float speed) { pattern_.speed = speed; }
     float GetRecoveryTime() const { return recoveryTime_; }
     void SetRecoveryTime(float time) { recoveryTime_ = time; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("chargeTime")) {
             chargeTime_ = params["chargeTime"];
         }
@@ -61,12 +69,16 @@ public:
         if (params.contains("fireInterval")) {
             fireInterval_ = params["fireInterval"];
         }
+        // 旧形式のキー（1発ずつの弾速）
         if (params.contains("bulletSpeed")) {
-            bulletSpeed_ = params["bulletSpeed"];
+            pattern_.speed = params["bulletSpeed"];
         }
         if (params.contains("recoveryTime")) {
             recoveryTime_ = params["recoveryTime"];
         }
+        if (params.contains("pattern")) {
+            pattern_.ApplyParameters(params["pattern"]);
+        }
     }
 
     /// <summary>
@@ -86,32 +98,34 @@ private:
     /// 射撃パラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeRapidFire(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    void InitializeRapidFire(Boss* boss, BTBossRapidFireState& state) const;
 
     /// <summary>
     /// プレイヤーを狙う処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    void AimAtPlayer(Boss* boss, float deltaTime) const;
 
     /// <summary>
-    /// 弾を1発発射
+    /// プレイヤー方向へ1ボレー発射
     /// </summary>
     /// <param name="boss">ボス</param>
-    void FireBullet(Boss* boss);
+    /// <param name="random">乱数（ランダムなパターン用）</param>
+    void FireBullet(Boss* boss, BTRandom& random) const;
 
     /// <summary>
     /// プレイヤーへの方向を計算
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <returns>プレイヤーへの正規化された方向ベクトル</returns>
-    Tako::Vector3 CalculateDirectionToPlayer(Boss* boss);
+    Tako::Vector3 CalculateDirectionToPlayer(Boss* boss) const;
 
     // 射撃前の準備時間
     float chargeTime_ = 0.9f;
 
-    // 発射する弾の数
+    // 発射する回数（ボレー数）
     int bulletCount_ = 5;
 
     // 発射間隔（秒）
@@ -120,24 +134,6 @@ private:
     // 射撃後の硬直時間
     float recoveryTime_ = 0.5f;
 
-    // 状態の総時間
-    float totalDuration_ = 0.0f;
-
-    // 弾の速度
-    float bulletSpeed_ = 20.0f;
-
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 発射済み弾数
-    int firedCount_ = 0;
-
-    // 前回発射からの経過時間
-    float timeSinceLastFire_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
-
-    // 射撃予兆エフェクト
-    BulletSignEffect bulletSignEffect_;
+    // 1回の発射で撃つ弾幕パターン（既定はプレイヤー方向へ1発）
+    BulletPattern pattern_{ BulletPatternType::AimedBurst, 1, 20.0f };
 };
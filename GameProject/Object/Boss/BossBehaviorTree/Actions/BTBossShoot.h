@@ -1,21 +1,32 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "../../../../Effect/BulletSignEffect.h"
+#include "../../../../Common/BulletPattern.h"
 #include "Vector3.h"
 
 class Boss;
 
+/// <summary>
+/// 射撃アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossShootState {
+    float totalDuration = 1.0f;          // 状態の総時間
+    float elapsedTime = 0.0f;            // 経過時間
+    bool hasFired = false;               // 弾が発射済みかどうか
+    bool isFirstExecute = true;          // 初回実行フラグ
+    BulletSignEffect bulletSignEffect;   // 射撃予兆エフェクト
+};
+
 /// <summary>
 /// ボスの射撃アクションノード
 /// </summary>
-class BTBossShoot : public BTNode {
+class BTBossShoot : public BTStatefulNode<BTBossShootState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
 private:
     static constexpr float kDirectionEpsilon = 0.01f;  ///< 方向判定の閾値
-    static constexpr float kAngleEpsilon = 0.001f;     ///< 角度判定の閾値
 
 public:
     /// <summary>
@@ -35,38 +46,39 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetChargeTime() const { return chargeTime_; }
     void SetChargeTime(float time) { chargeTime_ = time; }
-    float GetBulletSpeed() const { return bulletSpeed_; }
-    void SetBulletSpeed(float speed) { bulletSpeed_ = speed; }
-    float GetSpreadAngle() const { return spreadAngle_; }
-    void SetSpreadAngle(float angle) { spreadAngle_ = angle; }
+    float GetBulletSpeed() const { return pattern_.speed; }
+    void SetBulletSpeed(float speed) { pattern_.speed = speed; }
+    float GetSpreadAngle() const { return pattern_.spreadAngle; }
+    void SetSpreadAngle(float angle) { pattern_.spreadAngle = angle; }
+    const BulletPattern& GetPattern() const { return pattern_; }
+    void SetPattern(const BulletPattern& pattern) { pattern_ = pattern; }
     float GetRecoveryTime() const { return recoveryTime_; }
     void SetRecoveryTime(float time) { recoveryTime_ = time; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("chargeTime")) {
             chargeTime_ = params["chargeTime"];
         }
+        // 旧形式のキー（扇状パターンの弾速と広がり）
         if (params.contains("bulletSpeed")) {
-            bulletSpeed_ = params["bulletSpeed"];
+            pattern_.speed = params["bulletSpeed"];
         }
         if (params.contains("spreadAngle")) {
-            spreadAngle_ = params["spreadAngle"];
+            pattern_.spreadAngle = params["spreadAngle"];
         }
         if (params.contains("recoveryTime")) {
             recoveryTime_ = params["recoveryTime"];
         }
+        if (params.contains("pattern")) {
+            pattern_.ApplyParameters(params["pattern"]);
+        }
     }
 
     /// <summary>
@@ -86,28 +98,22 @@ private:
     /// 射撃パラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeShoot(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    void InitializeShoot(Boss* boss, BTBossShootState& state) const;
 
     /// <summary>
     /// プレイヤーを狙う処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    void AimAtPlayer(Boss* boss, float deltaTime) const;
 
     /// <summary>
     /// 弾を発射
     /// </summary>
     /// <param name="boss">ボス</param>
-    void FireBullets(Boss* boss);
-
-    /// <summary>
-    /// 弾の発射方向を計算
-    /// </summary>
-    /// <param name="baseDirection">基準方向</param>
-    /// <param name="angleOffset">角度オフセット（ラジアン）</param>
-    /// <returns>発射方向</returns>
-    Tako::Vector3 CalculateBulletDirection(const Tako::Vector3& baseDirection, float angleOffset);
+    /// <param name="random">乱数（ランダムなパターン用）</param>
+    void FireBullets(Boss* boss, BTRandom& random) const;
 
     // 射撃前の準備時間
     float chargeTime_ = 0.9f;
@@ -115,27 +121,6 @@ private:
     // 射撃後の硬直時間
     float recoveryTime_ = 0.5f;
 
-    // 状態の総時間
-    float totalDuration_ = 1.0f;
-
-    // 弾が発射済みかどうか
-    bool hasFired_ = false;
-
-    // 弾の速度
-    float bulletSpeed_ = 20.0f;
-
-    // 扇状発射の角度（ラジアン）
-    float spreadAngle_ = 0.2618f; // 約15度
-
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
-
-    // 弾数（ImGui 調整用）
-    int bulletCount_ = 3;  ///< 発射する弾数
-
-    // 射撃予兆エフェクト
-    BulletSignEffect bulletSignEffect_;
+    // 弾幕パターン（既定はプレイヤー方向へ約15度の扇状に3発）
+    BulletPattern pattern_{ BulletPatternType::Fan, 3, 20.0f, 0.0f, 0.0f, 0.2618f };
 };
\ No newline at end of file
@@ -15,46 +15,46 @@ BTBossWideShoot::BTBossWideShoot() {
 
 BTNodeStatus BTBossWideShoot::Execute(BTBlackboard* blackboard) {
     Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
+    BTBossWideShootState* state = GetState(blackboard);
+    if (!boss || !state) {
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeWideShoot(boss);
-        isFirstExecute_ = false;
+    if (state->isFirstExecute) {
+        InitializeWideShoot(boss, *state);
+        state->isFirstExecute = false;
     }
 
     // チャージフェーズ：プレイヤーの方向を向く
-    if (elapsedTime_ < chargeTime_) {
-        AimAtPlayer(boss, deltaTime);
-        bulletSignEffect_.Update(boss, deltaTime);
+    if (state->elapsedTime < chargeTime_) {
+        AimAtPlayer(boss, deltaTime, *state);
+        state->bulletSignEffect.Update(boss, deltaTime);
     }
     // 発射フェーズ
-    else if (currentSweep_ < sweepCount_) {
+    else if (state->currentSweep < sweepCount_) {
         // 最初の発射前にエフェクトを終了
-        if (!hasEndedEffect_) {
-            bulletSignEffect_.End(boss);
-            hasEndedEffect_ = true;
+        if (!state->hasEndedEffect) {
+            state->bulletSignEffect.End(boss);
+            state->hasEndedEffect = true;
         }
 
         // 発射間隔チェック
-        timeSinceLastFire_ += deltaTime;
-        if (timeSinceLastFire_ >= fireInterval_) {
-            FireBullet(boss);
-            firedInSweep_++;
-            timeSinceLastFire_ = 0.0f;
+        state->timeSinceLastFire += deltaTime;
+        if (state->timeSinceLastFire >= state->fireInterval) {
+            FireBullet(boss, *state);
+            state->firedInSweep++;
+            state->timeSinceLastFire = 0.0f;
 
             // 1スイープ完了チェック
-            if (firedInSweep_ >= bulletsPerSweep_) {
-                currentSweep_++;
-                firedInSweep_ = 0;
+            if (state->firedInSweep >= bulletsPerSweep_) {
+                state->currentSweep++;
+                state->firedInSweep = 0;
 
                 // 全スイープ完了で硬直フェーズ開始
-                if (currentSweep_ >= sweepCount_) {
+                if (state->currentSweep >= sweepCount_) {
                     boss->EnterRecovery();
                 }
             }
@@ -62,76 +62,63 @@ BTNodeStatus BTBossWideShoot::Execute(BTBlackboard* blackboard) {
     }
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state->elapsedTime += deltaTime;
 
     // 状態終了チェック
-    if (elapsedTime_ >= totalDuration_) {
+    if (state->elapsedTime >= state->totalDuration) {
         // 硬直フェーズ終了
         boss->ExitRecovery();
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        timeSinceLastFire_ = 0.0f;
-        currentSweep_ = 0;
-        firedInSweep_ = 0;
-        hasEndedEffect_ = false;
-        status_ = BTNodeStatus::Success;
+        state->isFirstExecute = true;
+        state->elapsedTime = 0.0f;
+        state->timeSinceLastFire = 0.0f;
+        state->currentSweep = 0;
+        state->firedInSweep = 0;
+        state->hasEndedEffect = false;
         return BTNodeStatus::Success;
     }
 
     // まだ射撃処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossWideShoot::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    timeSinceLastFire_ = 0.0f;
-    currentSweep_ = 0;
-    firedInSweep_ = 0;
-    isFirstExecute_ = true;
-    hasEndedEffect_ = false;
-    // 注意: Reset 時は boss 参照がないため、ExitRecovery()は呼べない
-}
-
-void BTBossWideShoot::InitializeWideShoot(Boss* boss) {
+void BTBossWideShoot::InitializeWideShoot(Boss* boss, BTBossWideShootState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
-    timeSinceLastFire_ = 0.0f;
-    currentSweep_ = 0;
-    firedInSweep_ = 0;
-    hasEndedEffect_ = false;
+    state.elapsedTime = 0.0f;
+    state.timeSinceLastFire = 0.0f;
+    state.currentSweep = 0;
+    state.firedInSweep = 0;
+    state.hasEndedEffect = false;
 
     // firingDuration から fireInterval を計算
     int totalBullets = bulletsPerSweep_ * sweepCount_;
     if (totalBullets > 0) {
-        fireInterval_ = firingDuration_ / static_cast<float>(totalBullets);
+        state.fireInterval = firingDuration_ / static_cast<float>(totalBullets);
     }
 
     // totalDuration を計算
-    totalDuration_ = chargeTime_ + firingDuration_ + recoveryTime_;
+    state.totalDuration = chargeTime_ + firingDuration_ + recoveryTime_;
 
     // 射撃予兆エフェクト開始
-    bulletSignEffect_.Start(boss, chargeTime_);
+    state.bulletSignEffect.Start(boss, chargeTime_);
 
     // 基準方向を計算（プレイヤー方向）
     Player* player = boss->GetPlayer();
     if (player) {
         Vector3 playerPos = player->GetTransform().translate;
         Vector3 bossPos = boss->GetTransform().translate;
-        baseDirection_ = playerPos - bossPos;
-        baseDirection_.y = 0.0f;
-        if (baseDirection_.Length() > kDirectionEpsilon) {
-            baseDirection_ = baseDirection_.Normalize();
+        state.baseDirection = playerPos - bossPos;
+        state.baseDirection.y = 0.0f;
+        if (state.baseDirection.Length() > kDirectionEpsilon) {
+            state.baseDirection = state.baseDirection.Normalize();
         } else {
-            baseDirection_ = Vector3(0.0f, 0.0f, 1.0f);
+            state.baseDirection = Vector3(0.0f, 0.0f, 1.0f);
         }
     }
 }
 
-void BTBossWideShoot::AimAtPlayer(Boss* boss, float deltaTime) {
+void BTBossWideShoot::AimAtPlayer(Boss* boss, float deltaTime, BTBossWideShootState& state) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -148,53 +135,42 @@ void BTBossWideShoot::AimAtPlayer(Boss* boss, float deltaTime) {
         boss->SetRotate(Vector3(0.0f, angle, 0.0f));
 
         // 基準方向を更新
-        baseDirection_ = toPlayer;
+        state.baseDirection = toPlayer;
     }
 }
 
-void BTBossWideShoot::FireBullet(Boss* boss) {
-    // 発射位置
-    Vector3 firePosition = boss->GetTransform().translate;
-
-    // 角度オフセットを取得
-    float angleOffset = GetCurrentAngleOffset();
-
-    // 発射方向を計算
-    Vector3 bulletDirection = CalculateBulletDirection(baseDirection_, angleOffset);
-
+void BTBossWideShoot::FireBullet(Boss* boss, const BTBossWideShootState& state) const {
     // 弾種と速度を決定
-    bool isPenetrating = IsPenetratingBullet();
-    float speed = isPenetrating ? penetratingBulletSpeed_ : normalBulletSpeed_;
+    bool isPenetrating = IsPenetratingBullet(state);
+
+    // 1スイープを扇状パターンとみなし、その中の1発だけを展開する
+    BulletPattern sweep;
+    sweep.type = BulletPatternType::Fan;
+    sweep.count = bulletsPerSweep_;
+    sweep.spreadAngle = sweepAngle_;
+    sweep.speed = isPenetrating ? penetratingBulletSpeed_ : normalBulletSpeed_;
+
+    BulletVolley shot;
+    shot.origin = boss->GetTransform().translate;
+    shot.direction = state.baseDirection;
+    shot.first = static_cast<uint32_t>(state.firedInSweep);
+    shot.count = 1;
+    // 偶数回目のスイープは逆方向
+    shot.mirrored = (state.currentSweep % 2 == 1);
 
-    // 弾の速度ベクトルを計算
-    Vector3 bulletVelocity = bulletDirection * speed;
+    thread_local std::vector<BulletSpawnRequest> volley;
+    volley.clear();
+    sweep.Expand(shot, nullptr, volley);
 
     // 弾を生成リクエスト
     if (isPenetrating) {
-        boss->RequestPenetratingBulletSpawn(firePosition, bulletVelocity);
+        boss->RequestPenetratingBulletSpawnBatch(volley);
     } else {
-        boss->RequestBulletSpawn(firePosition, bulletVelocity);
-    }
-}
-
-float BTBossWideShoot::GetCurrentAngleOffset() const {
-    if (bulletsPerSweep_ <= 1) {
-        return 0.0f;
-    }
-
-    // 0番目: -sweepAngle_, 最後: +sweepAngle_
-    float t = static_cast<float>(firedInSweep_) / static_cast<float>(bulletsPerSweep_ - 1);
-    float baseOffset = sweepAngle_ * (2.0f * t - 1.0f);
-
-    // 偶数回目のスイープは逆方向
-    if (currentSweep_ % 2 == 1) {
-        baseOffset = -baseOffset;
+        boss->RequestBulletSpawnBatch(volley);
     }
-
-    return baseOffset;
 }
 
-bool BTBossWideShoot::IsPenetratingBullet() const {
+bool BTBossWideShoot::IsPenetratingBullet(const BTBossWideShootState& state) const {
     if (penetratingCount_ <= 0) {
         return false;
     }
@@ -208,27 +184,8 @@ bool BTBossWideShoot::IsPenetratingBullet() const {
         interval = 1;
     }
 
-    return (firedInSweep_ % interval == 0) &&
-           (firedInSweep_ / interval < penetratingCount_);
-}
-
-Vector3 BTBossWideShoot::CalculateBulletDirection(const Vector3& baseDirection, float angleOffset) {
-    if (std::abs(angleOffset) < kAngleEpsilon) {
-        return baseDirection;
-    }
-
-    // Y 軸回転行列を作成
-    float cos_angle = cosf(angleOffset);
-    float sin_angle = sinf(angleOffset);
-
-    // 回転を適用（Y 軸回転）
-    Vector3 rotatedDirection;
-    rotatedDirection.x = baseDirection.x * cos_angle - baseDirection.z * sin_angle;
-    rotatedDirection.y = baseDirection.y;
-    rotatedDirection.z = baseDirection.x * sin_angle + baseDirection.z * cos_angle;
-
-    rotatedDirection = rotatedDirection.Normalize();
-    return rotatedDirection;
+    return (state.firedInSweep % interval == 0) &&
+           (state.firedInSweep / interval < penetratingCount_);
 }
 
 nlohmann::json BTBossWideShoot::ExtractParameters() const {
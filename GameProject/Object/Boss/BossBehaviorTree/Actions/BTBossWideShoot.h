@@ -1,17 +1,34 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTStatefulNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "../../../../Effect/BulletSignEffect.h"
+#include "../../../../Common/BulletPattern.h"
 #include "Vector3.h"
 
 class Boss;
 
+/// <summary>
+/// 扇状射撃アクションのランタイム状態（エージェントごと）
+/// </summary>
+struct BTBossWideShootState {
+    float fireInterval = 0.0f;           ///< 発射間隔（発射時間と弾数から算出）
+    float totalDuration = 0.0f;          ///< 状態の総時間
+    float elapsedTime = 0.0f;            ///< 経過時間
+    float timeSinceLastFire = 0.0f;      ///< 前回発射からの経過時間
+    int currentSweep = 0;                ///< 現在のスイープ回数
+    int firedInSweep = 0;                ///< 現在のスイープで発射した弾数
+    bool isFirstExecute = true;          ///< 初回実行フラグ
+    bool hasEndedEffect = false;         ///< エフェクト終了フラグ
+    Tako::Vector3 baseDirection;         ///< 発射基準方向（プレイヤー方向）
+    BulletSignEffect bulletSignEffect;   ///< 射撃予兆エフェクト
+};
+
 /// <summary>
 /// ボスの大範囲射撃アクションノード
 /// プレイヤー方向に向きながら、角度をスイープしながら弾を連射
 /// 通常弾（速い）と貫通弾（遅い）を混ぜて発射
 /// </summary>
-class BTBossWideShoot : public BTNode {
+class BTBossWideShoot : public BTStatefulNode<BTBossWideShootState> {
 public:
     /// <summary>
     /// コンストラクタ
@@ -30,11 +47,6 @@ public:
     /// <returns>実行結果</returns>
     BTNodeStatus Execute(BTBlackboard* blackboard) override;
 
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
-
     // パラメータ取得・設定
     float GetChargeTime() const { return chargeTime_; }
     void SetChargeTime(float time) { chargeTime_ = time; }
@@ -56,10 +68,10 @@ public:
     void SetPenetratingCount(int count) { penetratingCount_ = count; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("chargeTime")) {
             chargeTime_ = params["chargeTime"];
         }
@@ -104,52 +116,40 @@ public:
 private:
     // 定数
     static constexpr float kDirectionEpsilon = 0.001f;  ///< 方向計算の閾値
-    static constexpr float kAngleEpsilon = 0.0001f;     ///< 角度計算の閾値
 
     /// <summary>
     /// 射撃パラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeWideShoot(Boss* boss);
+    /// <param name="state">ランタイム状態</param>
+    void InitializeWideShoot(Boss* boss, BTBossWideShootState& state) const;
 
     /// <summary>
     /// プレイヤーを狙う処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    /// <param name="state">ランタイム状態</param>
+    void AimAtPlayer(Boss* boss, float deltaTime, BTBossWideShootState& state) const;
 
     /// <summary>
     /// 弾を1発発射
     /// </summary>
     /// <param name="boss">ボス</param>
-    void FireBullet(Boss* boss);
-
-    /// <summary>
-    /// 現在の発射角度オフセットを取得
-    /// </summary>
-    /// <returns>角度オフセット（ラジアン）</returns>
-    float GetCurrentAngleOffset() const;
+    /// <param name="state">ランタイム状態</param>
+    void FireBullet(Boss* boss, const BTBossWideShootState& state) const;
 
     /// <summary>
     /// 現在の弾が貫通弾かどうか判定
     /// </summary>
+    /// <param name="state">ランタイム状態</param>
     /// <returns>貫通弾なら true</returns>
-    bool IsPenetratingBullet() const;
-
-    /// <summary>
-    /// 弾の発射方向を計算
-    /// </summary>
-    /// <param name="baseDirection">基準方向</param>
-    /// <param name="angleOffset">角度オフセット</param>
-    /// <returns>発射方向ベクトル</returns>
-    Tako::Vector3 CalculateBulletDirection(const Tako::Vector3& baseDirection, float angleOffset);
+    bool IsPenetratingBullet(const BTBossWideShootState& state) const;
 
     // === 時間制御 ===
     float chargeTime_ = 0.8f;       ///< チャージ時間
     float recoveryTime_ = 0.5f;     ///< 硬直時間
     float firingDuration_ = 1.0f;   ///< 全体の発射時間（秒）
-    float fireInterval_ = 0.0f;     ///< 発射間隔（自動計算）
 
     // === 角度制御 ===
     float sweepAngle_ = 1.0472f;    ///< スイープ角度（約60度）
@@ -164,19 +164,4 @@ private:
 
     // === 弾種制御 ===
     int penetratingCount_ = 4;      ///< 1スイープあたりの貫通弾の数
-
-    // === 状態管理 ===
-    float totalDuration_ = 0.0f;    ///< 状態の総時間
-    float elapsedTime_ = 0.0f;      ///< 経過時間
-    float timeSinceLastFire_ = 0.0f;///< 前回発射からの経過時間
-    int currentSweep_ = 0;          ///< 現在のスイープ回数
-    int firedInSweep_ = 0;          ///< 現在のスイープで発射した弾数
-    bool isFirstExecute_ = true;    ///< 初回実行フラグ
-    bool hasEndedEffect_ = false;   ///< エフェクト終了フラグ
-
-    // === 方向キャッシュ ===
-    Tako::Vector3 baseDirection_;   ///< 発射基準方向（プレイヤー方向）
-
-    // === エフェクト ===
-    BulletSignEffect bulletSignEffect_;  ///< 射撃予兆エフェクト
 };
@@ -1,5 +1,10 @@
 #include "BossBehaviorTree.h"
 #include "../../../BehaviorTree/Core/BTComposite.h"
+#include "../../../BehaviorTree/Core/BTTreeDefinition.h"
+#include "../../../BehaviorTree/Core/BTBinaryTree.h"
+#include "../../../BehaviorTree/Core/BTBatchTicker.h"
+#include "../../../BehaviorTree/Core/BTProfiler.h"
+#include "../../../BehaviorTree/Core/BTTreeHotReloader.h"
 #include "../../../BehaviorTree/Composites/BTSelector.h"
 #include "../../../BehaviorTree/Composites/BTSequence.h"
 #include "Actions/BTBossIdle.h"
@@ -9,50 +14,177 @@
 #include "../Boss.h"
 #include "../../Player/Player.h"
 #include "../BossBehaviorTree/BossNodeFactory.h"
-#include <fstream>
+#include "BossBlackboardKeys.h"
+#include "RandomEngine.h"
+#include <climits>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
-BossBehaviorTree::BossBehaviorTree(Boss* boss, Player* player) {
+namespace {
+
+/// <summary>
+/// 読み込み済みツリーのキャッシュの1要素
+/// ホットリロードのツリーは保存のたびに新しい世代に差し替わり、結び付いたエージェントは世代に追従して
+/// 実行状態を移し替える。差し替わらない通常のツリーとして渡すと追従しなくなるため、ホットリロードごと分けて持つ
+/// </summary>
+struct SharedTreeEntry {
+    std::weak_ptr<const BTCompiledTree> tree;
+    std::weak_ptr<BTTreeHotReloader> reloader;
+};
+
+/// <summary>
+/// 読み込み済みツリーのキャッシュ（ファイルパス → 共有ツリー）と、ツリーごとの状態プール
+/// 使用中のエージェントがいなくなったツリー・プールは自動的に解放される
+/// （プールはツリーを保持するので、生きているプールのツリーのアドレスが別のツリーに再利用されることはない）
+/// </summary>
+struct SharedTreeCache {
+    std::mutex mutex;
+    std::unordered_map<std::string, SharedTreeEntry> entries;
+    std::unordered_map<const BTCompiledTree*, std::weak_ptr<BTAgentStatePool>> statePools;
+};
+
+SharedTreeCache& GetSharedTreeCache() {
+    static SharedTreeCache cache;
+    return cache;
+}
+
+} // namespace
+
+BossBehaviorTree::BossBehaviorTree(Boss* boss, Player* player)
+    : actionCounterKey_(BossBlackboardKeys::kActionCounter) {
     // ブラックボードの初期化
     blackboard_ = std::make_unique<BTBlackboard>();
     blackboard_->SetBoss(boss);
     blackboard_->SetPlayer(player);
-    blackboard_->SetInt("ActionCounter", 0);
+    blackboard_->SetInt(actionCounterKey_, 0);
 
-    // ツリーを読み込み
-    LoadFromJSON("resources/Json/BossTree.json");
+    // ノードの乱数はボスごとに独立させる（シードだけ共有の乱数から取る）
+    SetRandomSeed(static_cast<uint64_t>(Tako::RandomEngine::GetInstance()->GetInt(0, INT_MAX)));
+
+    // ツリーを読み込み（他のボスが読み込み済みならそのツリーを共有する）
+    LoadTree("resources/Json/BossTree.json");
 }
 
-BossBehaviorTree::~BossBehaviorTree() = default;
+BossBehaviorTree::~BossBehaviorTree() {
+    ReleaseStateSlot();
+}
 
 void BossBehaviorTree::Update(float deltaTime) {
-    if (!rootNode_) {
+    PollHotReload();
+
+    if (!BeginUpdate(deltaTime)) {
         return;
     }
 
-    // ブラックボードにデルタータイムを設定
-    blackboard_->SetDeltaTime(deltaTime);
+    // コンパイル済みツリー: フラット配列をインデックスで評価
+    if (useCompiledTree_) {
+        EndCompiledUpdate(tree_->Tick(blackboard_.get()));
+    }
+    else {
+        UpdateGraph();
+    }
 
-    // 実行前に実行中ノード情報をクリア
-    currentRunningNode_ = nullptr;
+    CollectProfile();
+}
 
+void BossBehaviorTree::UpdateGraph() {
     // ルートノードを実行
-    BTNodeStatus status = rootNode_->Execute(blackboard_.get());
+    // 評価中のノードは決まらないので、状態を持つノードは評価中のツリーから自分のオフセットを引く
+    BTNode* root = tree_->GetRoot().get();
+    blackboard_->SetActiveNode(tree_.get(), nullptr, BTNode::kNoStateOffset);
+    BTNodeStatus status = BTExecuteNode(root, blackboard_.get());
+    blackboard_->SetActiveNode(nullptr, nullptr, BTNode::kNoStateOffset);
 
     // 実行中ノードを検索
-    FindRunningNodeRecursive(rootNode_);
+    FindRunningNodeInGraph(root, status);
 
     // 完了したらリセット
     if (status != BTNodeStatus::Running) {
-        rootNode_->Reset();
+        root->Reset();
+        ResetAgentState();
     }
 }
 
+void BossBehaviorTree::UpdateBatch(std::span<BossBehaviorTree* const> trees, float deltaTime, BTBatchTicker& ticker) {
+    std::vector<BossBehaviorTree*> batched;
+    std::vector<BTBatchAgent> agents;
+    batched.reserve(trees.size());
+    agents.reserve(trees.size());
+
+    // ツリーの差し替えは評価するツリーを集める前に全員分済ませる
+    for (BossBehaviorTree* tree : trees) {
+        if (tree) {
+            tree->PollHotReload();
+        }
+    }
+
+    for (BossBehaviorTree* tree : trees) {
+        if (!tree) {
+            continue;
+        }
+        // ノードグラフ評価はコンポジットが進行状態を持つため並列化できない
+        if (!tree->useCompiledTree_) {
+            if (tree->BeginUpdate(deltaTime)) {
+                tree->UpdateGraph();
+            }
+            continue;
+        }
+        if (!tree->BeginUpdate(deltaTime)) {
+            continue;
+        }
+        batched.push_back(tree);
+        agents.push_back({ tree->tree_.get(), tree->blackboard_.get() });
+    }
+
+    std::vector<BTNodeStatus> results(agents.size(), BTNodeStatus::Failure);
+    ticker.Tick(agents, results);
+
+    for (size_t i = 0; i < batched.size(); ++i) {
+        batched[i]->EndCompiledUpdate(results[i]);
+    }
+
+    CollectProfile();
+}
+
+bool BossBehaviorTree::BeginUpdate(float deltaTime) {
+    if (!tree_ || !tree_->IsCompiled()) {
+        return false;
+    }
+
+    // ブラックボードにデルタータイムを設定し、エージェントの時計を進める
+    blackboard_->AdvanceTime(deltaTime);
+
+    // 実行前に実行中ノード情報をクリア
+    currentRunningNode_ = nullptr;
+    return true;
+}
+
+void BossBehaviorTree::EndCompiledUpdate(BTNodeStatus status) {
+    currentRunningNode_ = tree_->GetNode(tree_->FindRunningNodeIndex(stateBlock_));
+
+    // 完了したらリセット
+    if (status != BTNodeStatus::Running) {
+        ResetAgentState();
+    }
+}
+
+void BossBehaviorTree::CollectProfile() {
+#if BT_PROFILER_ENABLED
+    // ワーカーが記録した区間を、ノードが差し替えられる前にメインスレッドで集計する
+    if (BTProfiler::IsEnabled()) {
+        BTProfiler::GetInstance()->Collect();
+    }
+#endif
+}
+
 void BossBehaviorTree::Reset() {
-    if (rootNode_) {
-        rootNode_->Reset();
+    // ノードグラフ評価時はコンポジット自身が進行状態を持つ
+    if (!useCompiledTree_ && tree_ && tree_->GetRoot()) {
+        tree_->GetRoot()->Reset();
     }
-    blackboard_->SetInt("ActionCounter", 0);
+    ResetAgentState();
+    blackboard_->SetInt(actionCounterKey_, 0);
     // 状態フラグのクリーンアップは Boss::ResetActionState()に集約
     // NormalState::Exit()から呼ばれる
 }
@@ -70,177 +202,362 @@ const std::string& BossBehaviorTree::GetCurrentNodeName() const {
 /// </summary>
 void BossBehaviorTree::SetRootNode(BTNodePtr rootNode) {
     if (rootNode) {
-        rootNode_ = rootNode;
-        // 既存のツリーをリセット
-        Reset();
+        // 外部から渡されたノードグラフはファイルの監視対象から外す
+        hotReloader_.reset();
+        ReplaceTree(CompileTree(std::move(rootNode)));
         currentNodeName_ = "External Tree";
     }
 }
 
 /// <summary>
-/// JSON ファイルからツリーを読み込み
+/// 共有ツリーを設定
 /// </summary>
-bool BossBehaviorTree::LoadFromJSON(const std::string& filepath) {
-    try {
-        // JSON ファイルを読み込み
-        std::ifstream file(filepath);
-        if (!file.is_open()) {
-            return false;
-        }
+void BossBehaviorTree::SetSharedTree(std::shared_ptr<const BTCompiledTree> tree) {
+    if (!tree) {
+        return;
+    }
 
-        nlohmann::json json;
-        file >> json;
-        file.close();
+#if BT_PROFILER_ENABLED
+    // 統計はノードのポインタで引くため、ツリーが変わったら集計をやり直す
+    if (tree_ != tree) {
+        BTProfiler::GetInstance()->Reset();
+    }
+#endif
 
-        // バージョンチェック
-        if (!json.contains("version") || json["version"] != "1.0") {
-            return false;
-        }
+    // ツリーの状態プールからこのエージェントの状態ブロックを取り直す
+    std::shared_ptr<BTAgentStatePool> pool = AcquireStatePool(tree);
+    uint32_t slot = pool->Acquire();
+    tree_ = std::move(tree);
+    BindStateSlot(std::move(pool), slot);
 
-        // ノードマップを作成（ID → ノード情報）
-        std::unordered_map<int, nlohmann::json> nodeMap;
-        if (json.contains("nodes")) {
-            for (const auto& nodeJson : json["nodes"]) {
-                int nodeId = nodeJson["id"];
-                nodeMap[nodeId] = nodeJson;
-            }
-        }
+    // 既存のツリーをリセット
+    Reset();
+}
 
-        // リンク情報を取得
-        std::vector<nlohmann::json> links;
-        if (json.contains("links")) {
-            links = json["links"].get<std::vector<nlohmann::json>>();
-        }
+/// <summary>
+/// 実行状態を引き継いでツリーを差し替え
+/// </summary>
+void BossBehaviorTree::ReplaceTree(std::shared_ptr<const BTCompiledTree> tree) {
+    if (!tree || tree == tree_) {
+        return;
+    }
 
-        // ルートノードを探す（親リンクを持たないノード）
-        int rootNodeId = -1;
-        std::unordered_set<int> childNodeIds;
-        for (const auto& link : links) {
-            childNodeIds.insert(link["targetNodeId"].get<int>());
-        }
+    // ノードグラフ評価ではコンポジット自身が進行状態を持つため引き継がない
+    if (!useCompiledTree_ || !tree_ || !tree_->IsCompiled()) {
+        SetSharedTree(std::move(tree));
+        return;
+    }
 
-        for (const auto& [nodeId, nodeJson] : nodeMap) {
-            if (childNodeIds.find(nodeId) == childNodeIds.end()) {
-                rootNodeId = nodeId;
-                break;
-            }
-        }
+    // 新しいツリーの状態プールに取ったスロットへ実行中の経路を移す
+    std::shared_ptr<BTAgentStatePool> pool = AcquireStatePool(tree);
+    uint32_t slot = pool->Acquire();
+    if (!tree->MigrateState(*tree_, stateBlock_, pool->GetAgentState(slot))) {
+        pool->Release(slot);
+        SetSharedTree(std::move(tree));
+        return;
+    }
 
-        if (rootNodeId == -1 && !nodeMap.empty()) {
-            // ルートが見つからない場合、最初のノードをルートとする
-            rootNodeId = nodeMap.begin()->first;
-        }
+#if BT_PROFILER_ENABLED
+    // 外れたノードのアドレスが再利用されると統計が混ざるため集計をやり直す
+    BTProfiler::GetInstance()->Reset();
+#endif
+
+    tree_ = std::move(tree);
+    BindStateSlot(std::move(pool), slot);
+    currentRunningNode_ = tree_->GetNode(tree_->FindRunningNodeIndex(stateBlock_));
+}
+
+/// <summary>
+/// 確保済みのスロットをこのボスの状態ブロックにする
+/// </summary>
+void BossBehaviorTree::BindStateSlot(std::shared_ptr<BTAgentStatePool> pool, uint32_t slot) {
+    ReleaseStateSlot();
+    statePool_ = std::move(pool);
+    stateSlot_ = slot;
+    stateBlock_ = statePool_->GetAgentState(slot);
+    blackboard_->SetNodeStateBlock(stateBlock_);
+}
+
+/// <summary>
+/// 状態プールのスロットを返す
+/// </summary>
+void BossBehaviorTree::ReleaseStateSlot() {
+    if (statePool_) {
+        statePool_->Release(stateSlot_);
+    }
+    statePool_.reset();
+    stateSlot_ = BTAgentStatePool::kInvalidSlot;
+    stateBlock_ = nullptr;
+    blackboard_->SetNodeStateBlock(nullptr);
+}
+
+/// <summary>
+/// このボスの状態を初期状態に戻す
+/// </summary>
+void BossBehaviorTree::ResetAgentState() {
+    if (statePool_) {
+        statePool_->ResetAgent(stateSlot_);
+    }
+}
 
-        if (rootNodeId == -1) {
-            return false;
+/// <summary>
+/// 共有ツリーの状態プールの取得
+/// </summary>
+std::shared_ptr<BTAgentStatePool> BossBehaviorTree::AcquireStatePool(const std::shared_ptr<const BTCompiledTree>& tree) {
+    SharedTreeCache& cache = GetSharedTreeCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    auto it = cache.statePools.find(tree.get());
+    if (it != cache.statePools.end()) {
+        if (auto pool = it->second.lock()) {
+            return pool;
         }
+    }
+
+    // 使われなくなったプールの要素を掃除してから登録する
+    std::erase_if(cache.statePools, [](const auto& entry) { return entry.second.expired(); });
+    auto pool = std::make_shared<BTAgentStatePool>(tree);
+    cache.statePools[tree.get()] = pool;
+    return pool;
+}
+
+/// <summary>
+/// ツリーファイルの更新を確認して差し替え
+/// </summary>
+void BossBehaviorTree::PollHotReload() {
+    if (!hotReloader_) {
+        return;
+    }
 
-        // ツリーを再帰的に構築
-        std::unordered_set<int> visitedNodes;
-        rootNode_ = BuildNodeFromJSON(nodeMap[rootNodeId], nodeMap, links, visitedNodes);
+    // 無効化されていても、他のボスが進めた世代には必ず追従する
+    if (hotReloadEnabled_) {
+        hotReloader_->CheckForChanges();
+    }
+    if (hotReloader_->GetGeneration() != hotReloadGeneration_) {
+        hotReloadGeneration_ = hotReloader_->GetGeneration();
+        ReplaceTree(hotReloader_->GetTree());
+    }
+}
 
-        if (!rootNode_) {
-            return false;
+/// <summary>
+/// ホットリロードに結び付ける
+/// </summary>
+void BossBehaviorTree::BindHotReloader(std::shared_ptr<BTTreeHotReloader> reloader) {
+    hotReloader_ = std::move(reloader);
+    hotReloadGeneration_ = hotReloader_->GetGeneration();
+    ReplaceTree(hotReloader_->GetTree());
+}
+
+/// <summary>
+/// JSON ファイルからツリーを読み込み
+/// </summary>
+bool BossBehaviorTree::LoadFromJSON(const std::string& filepath) {
+    // ホットリロード中のツリーは作り直さず、差分だけを反映して実行状態を引き継ぐ
+    if (hotReloadEnabled_) {
+        if (auto reloader = AcquireHotReloader(filepath); reloader && reloader->Reload()) {
+            BindHotReloader(std::move(reloader));
+            currentNodeName_ = "Loaded from JSON";
+            return true;
         }
+    }
 
-        // ツリーをリセット
-        Reset();
-        currentNodeName_ = "Loaded from JSON";
+    BTNodePtr rootNode = BuildFromJSON(filepath);
+    if (!rootNode) {
+        return false;
+    }
 
-        return true;
+    // 明示的に読み直したツリーは、以降に生成されるボスとも共有する
+    auto tree = CompileTree(std::move(rootNode));
+    {
+        SharedTreeCache& cache = GetSharedTreeCache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.entries[filepath].tree = tree;
     }
-    catch (const std::exception&) {
-        // エラー処理
+    hotReloader_.reset();
+    SetSharedTree(std::move(tree));
+    currentNodeName_ = "Loaded from JSON";
+
+    return true;
+}
+
+/// <summary>
+/// プリコンパイル済みバイナリからツリーを読み込み
+/// </summary>
+bool BossBehaviorTree::LoadFromBinary(const std::string& binaryPath, const std::string& sourcePath) {
+    BTNodePtr rootNode = BuildFromBinary(binaryPath, sourcePath);
+    if (!rootNode) {
         return false;
     }
+
+    hotReloader_.reset();
+    SetSharedTree(CompileTree(std::move(rootNode)));
+    currentNodeName_ = "Loaded from BTBIN";
+
+    return true;
 }
 
 /// <summary>
-/// JSON からノードツリーを再帰的に構築
+/// ツリーを読み込み（バイナリ優先、古ければ JSON から再生成）
 /// </summary>
-BTNodePtr BossBehaviorTree::BuildNodeFromJSON(
-    const nlohmann::json& nodeJson,
-    const std::unordered_map<int, nlohmann::json>& nodeMap,
-    const std::vector<nlohmann::json>& links,
-    std::unordered_set<int>& visitedNodes) {
+bool BossBehaviorTree::LoadTree(const std::string& filepath) {
+    // ホットリロード時は差分を取れるよう、.btbin ではなく JSON の定義を保持して読み込む
+    if (hotReloadEnabled_) {
+        if (auto reloader = AcquireHotReloader(filepath)) {
+            BindHotReloader(std::move(reloader));
+            currentNodeName_ = "Shared Tree";
+            return true;
+        }
+    }
+
+    auto tree = AcquireSharedTree(filepath);
+    if (!tree) {
+        return false;
+    }
 
-    if (nodeJson.empty()) return nullptr;
+    hotReloader_.reset();
+    SetSharedTree(std::move(tree));
+    currentNodeName_ = "Shared Tree";
 
-    int nodeId = nodeJson["id"];
+    return true;
+}
 
-    // 循環参照を防ぐ
-    if (visitedNodes.find(nodeId) != visitedNodes.end()) {
+/// <summary>
+/// 共有ツリーの取得（未読み込みなら読み込んでキャッシュ）
+/// </summary>
+std::shared_ptr<const BTCompiledTree> BossBehaviorTree::AcquireSharedTree(const std::string& filepath) {
+    SharedTreeCache& cache = GetSharedTreeCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    auto it = cache.entries.find(filepath);
+    if (it != cache.entries.end()) {
+        if (auto tree = it->second.tree.lock()) {
+            return tree;
+        }
+    }
+
+    BTNodePtr rootNode = BuildFromBinary(GetBinaryPath(filepath), filepath);
+    if (!rootNode) {
+        rootNode = BuildFromJSON(filepath);
+    }
+    if (!rootNode) {
         return nullptr;
     }
-    visitedNodes.insert(nodeId);
 
-    // ノードを作成（BossNodeFactory を使用）
-    std::string nodeType = nodeJson["type"];
-    BTNodePtr node = BossNodeFactory::CreateNode(nodeType);
+    auto tree = CompileTree(std::move(rootNode));
+    cache.entries[filepath].tree = tree;
+    return tree;
+}
 
-    if (!node) {
+/// <summary>
+/// ホットリロード用に読み込んだツリーの取得（未読み込みなら読み込んでキャッシュ）
+/// </summary>
+std::shared_ptr<BTTreeHotReloader> BossBehaviorTree::AcquireHotReloader(const std::string& filepath) {
+    SharedTreeCache& cache = GetSharedTreeCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    auto it = cache.entries.find(filepath);
+    if (it != cache.entries.end()) {
+        if (auto reloader = it->second.reloader.lock()) {
+            return reloader;
+        }
+    }
+
+    auto reloader = std::make_shared<BTTreeHotReloader>(filepath, &BossNodeFactory::CreateNode);
+    if (!reloader->Load()) {
         return nullptr;
     }
 
-    // パラメータを適用（ポリモーフィズムで各ノードが自己処理）
-    if (nodeJson.contains("parameters") && !nodeJson["parameters"].is_null()) {
-        node->ApplyParameters(nodeJson["parameters"]);
+    cache.entries[filepath].reloader = reloader;
+    return reloader;
+}
+
+/// <summary>
+/// ノードグラフをコンパイルして共有ツリーを生成
+/// </summary>
+std::shared_ptr<const BTCompiledTree> BossBehaviorTree::CompileTree(BTNodePtr rootNode) {
+    auto tree = std::make_shared<BTCompiledTree>();
+    if (!tree->Compile(rootNode)) {
+        return nullptr;
     }
+    return tree;
+}
 
-    // 表示名を設定（オプション）
-    if (nodeJson.contains("displayName")) {
-        node->SetName(nodeJson["displayName"]);
+/// <summary>
+/// JSON からノードグラフを生成
+/// </summary>
+BTNodePtr BossBehaviorTree::BuildFromJSON(const std::string& filepath) {
+    // ノードテーブルと隣接リストを1回の走査で構築
+    BTTreeDefinition definition;
+    if (!definition.LoadFromFile(filepath)) {
+        return nullptr;
     }
 
-    // コンポジットノードの場合、子ノードを追加
-    if (node->IsComposite()) {
-        auto compositeNode = std::dynamic_pointer_cast<BTComposite>(node);
-        if (compositeNode) {
-            // このノードの子ノード ID を収集
-            std::vector<int> childIds;
-            for (const auto& link : links) {
-                if (link["sourceNodeId"] == nodeId) {
-                    childIds.push_back(link["targetNodeId"]);
-                }
-            }
+    // 次回以降の読み込み用にバイナリを書き出す（失敗しても読み込みは続行）
+    BTBinaryTree::SourceStamp stamp;
+    if (BTBinaryTree::GetSourceStamp(filepath, stamp)) {
+        BTBinaryTree::Write(GetBinaryPath(filepath), definition, &BossNodeFactory::GetNodeTypeId,
+                            BossNodeFactory::GetTypeTableHash(), stamp);
+    }
 
-            // 子ノードを再帰的に構築
-            for (int childId : childIds) {
-                auto childIt = nodeMap.find(childId);
-                if (childIt != nodeMap.end()) {
-                    BTNodePtr childNode = BuildNodeFromJSON(childIt->second, nodeMap, links, visitedNodes);
-                    if (childNode) {
-                        compositeNode->AddChild(childNode);
-                    }
-                }
-            }
-        }
+    // 隣接リストをたどって O(N) でノードグラフを生成
+    return definition.Instantiate(&BossNodeFactory::CreateNode);
+}
+
+/// <summary>
+/// プリコンパイル済みバイナリからノードグラフを生成
+/// </summary>
+BTNodePtr BossBehaviorTree::BuildFromBinary(const std::string& binaryPath, const std::string& sourcePath) {
+    // 変換元の JSON があれば、それより古いバイナリは使わない
+    BTBinaryTree::SourceStamp stamp;
+    bool hasSource = BTBinaryTree::GetSourceStamp(sourcePath, stamp);
+
+    BTBinaryTree binary;
+    if (!binary.Open(binaryPath, BossNodeFactory::GetTypeTableHash(), hasSource ? &stamp : nullptr)) {
+        return nullptr;
     }
+    return binary.Instantiate(&BossNodeFactory::CreateNodeById);
+}
 
-    return node;
+/// <summary>
+/// ノードグラフ上の実行中ノードを検索
+/// </summary>
+void BossBehaviorTree::FindRunningNodeInGraph(BTNode* root, BTNodeStatus rootStatus) {
+    if (rootStatus != BTNodeStatus::Running) {
+        return;
+    }
+
+    // 葉ノードは共有されるため状態を書き込まない。Running のコンポジットが指す子をたどる
+    BTNode* node = root;
+    while (node) {
+        currentRunningNode_ = node;
+        if (!node->IsComposite()) {
+            break;
+        }
+        node = static_cast<BTComposite*>(node)->GetRunningChild();
+    }
 }
 
 /// <summary>
-/// 実行中のノードを再帰的に検索
+/// コンパイル済みツリーで評価するかの設定
 /// </summary>
-void BossBehaviorTree::FindRunningNodeRecursive(const BTNodePtr& node) {
-    if (!node || !node->IsRunning()) {
+void BossBehaviorTree::SetUseCompiledTree(bool useCompiledTree) {
+    if (useCompiledTree_ == useCompiledTree) {
         return;
     }
 
-    // 現在実行中のノードを更新
-    currentRunningNode_ = node;
+    // 評価方式を切り替えるときは実行状態を持ち越さない
+    useCompiledTree_ = useCompiledTree;
+    Reset();
+}
 
-    // コンポジットノードの場合、子ノードも探索
-    auto composite = std::dynamic_pointer_cast<BTComposite>(node);
-    if (composite) {
-        const auto& children = composite->GetChildren();
-        for (const auto& child : children) {
-            if (child && child->IsRunning()) {
-                // 実行中の子ノードを再帰的に探索
-                FindRunningNodeRecursive(child);
-                break;  // 最初に見つかった実行中の子ノードのみ処理
-            }
-        }
+/// <summary>
+/// JSON パスに対応するバイナリのパスを取得
+/// </summary>
+std::string BossBehaviorTree::GetBinaryPath(const std::string& filepath) {
+    size_t dot = filepath.find_last_of('.');
+    size_t slash = filepath.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return filepath + ".btbin";
     }
-}
\ No newline at end of file
+    return filepath.substr(0, dot) + ".btbin";
+}
@@ -1,15 +1,24 @@
 #pragma once
 #include "../../../BehaviorTree/Core/BTNode.h"
 #include "../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../BehaviorTree/Core/BTCompiledTree.h"
+#include "../../../BehaviorTree/Core/BTAgentStatePool.h"
+#include <cstdint>
 #include <memory>
-#include <json.hpp>
-#include <unordered_set>
+#include <span>
+#include <string>
+
+class BTBatchTicker;
+class BTTreeHotReloader;
 
 class Boss;
 class Player;
 
 /// <summary>
 /// ボス用ビヘイビアツリー
+/// ツリー本体（BTCompiledTree）は同じファイルを読み込んだボス間で共有し、
+/// 各ボスはブラックボードと、ツリーごとの状態プール（BTAgentStatePool）のスロットだけを持つ
+/// 同じツリーのボスの状態ブロックはプールのチャンク内に連続して並ぶ
 /// </summary>
 class BossBehaviorTree {
 public:
@@ -31,6 +40,15 @@ public:
     /// <param name="deltaTime">経過時間</param>
     void Update(float deltaTime);
 
+    /// <summary>
+    /// 複数ボスのビヘイビアツリーを一括更新（コンパイル済みツリーはワーカープールで並列評価）
+    /// 弾の生成やエミッター操作などの副作用は評価後にボスの並び順で適用される
+    /// </summary>
+    /// <param name="trees">更新するツリー</param>
+    /// <param name="deltaTime">経過時間</param>
+    /// <param name="ticker">評価に使うワーカープール</param>
+    static void UpdateBatch(std::span<BossBehaviorTree* const> trees, float deltaTime, BTBatchTicker& ticker);
+
     /// <summary>
     /// ビヘイビアツリーのリセット
     /// </summary>
@@ -52,14 +70,67 @@ public:
     /// ルートノードの取得（エディタ用）
     /// </summary>
     /// <returns>ルートノード</returns>
-    BTNodePtr GetRootNode() const { return rootNode_; }
+    BTNodePtr GetRootNode() const { return tree_ ? tree_->GetRoot() : nullptr; }
 
     /// <summary>
     /// ルートノードを外部から設定
+    /// 現在のツリーとノードを共有している場合（エディタで構造だけ編集した場合など）は実行状態を引き継ぐ
     /// </summary>
     /// <param name="rootNode">新しいルートノード</param>
     void SetRootNode(BTNodePtr rootNode);
 
+    /// <summary>
+    /// 共有ツリーを設定（このボスの状態ブロックはツリーの状態プールから取り直す）
+    /// </summary>
+    /// <param name="tree">コンパイル済みツリー</param>
+    void SetSharedTree(std::shared_ptr<const BTCompiledTree> tree);
+
+    /// <summary>
+    /// 共有ツリーの取得
+    /// </summary>
+    /// <returns>コンパイル済みツリー</returns>
+    const std::shared_ptr<const BTCompiledTree>& GetSharedTree() const { return tree_; }
+
+    /// <summary>
+    /// ファイルから読み込んだ共有ツリーを取得（読み込み済みなら同じインスタンスを返す）
+    /// </summary>
+    /// <param name="filepath">JSON ファイルのパス</param>
+    /// <returns>コンパイル済みツリー（失敗時は nullptr）</returns>
+    static std::shared_ptr<const BTCompiledTree> AcquireSharedTree(const std::string& filepath);
+
+    /// <summary>
+    /// ホットリロード用に読み込んだツリーを取得（読み込み済みなら同じインスタンスを返す）
+    /// </summary>
+    /// <param name="filepath">JSON ファイルのパス</param>
+    /// <returns>ホットリロード（失敗時は nullptr）</returns>
+    static std::shared_ptr<BTTreeHotReloader> AcquireHotReloader(const std::string& filepath);
+
+    /// <summary>
+    /// ファイルから読み込んだツリーのホットリロードを有効にするか（既定ではデバッグビルドのみ有効）
+    /// 有効にした後に読み込んだツリーから監視対象になる
+    /// </summary>
+    /// <param name="enabled">有効にするなら true</param>
+    static void SetHotReloadEnabled(bool enabled) { hotReloadEnabled_ = enabled; }
+
+    /// <summary>
+    /// ホットリロードが有効か
+    /// </summary>
+    /// <returns>有効なら true</returns>
+    static bool IsHotReloadEnabled() { return hotReloadEnabled_; }
+
+    /// <summary>
+    /// このボスのツリーを監視しているホットリロードを取得
+    /// </summary>
+    /// <returns>ホットリロード（ファイルに結び付いていなければ nullptr）</returns>
+    const BTTreeHotReloader* GetHotReloader() const { return hotReloader_.get(); }
+
+    /// <summary>
+    /// ノードグラフをコンパイルして共有ツリーを生成
+    /// </summary>
+    /// <param name="rootNode">ルートノード</param>
+    /// <returns>コンパイル済みツリー（失敗時は nullptr）</returns>
+    static std::shared_ptr<const BTCompiledTree> CompileTree(BTNodePtr rootNode);
+
     /// <summary>
     /// ブラックボードの取得（ノード初期化用）
     /// </summary>
@@ -68,39 +139,170 @@ public:
 
     /// <summary>
     /// JSON ファイルからツリーを読み込み
+    /// ホットリロードが有効なら、読み込み済みのツリーに差分だけを反映して実行状態を引き継ぐ
     /// </summary>
     /// <param name="filepath">JSON ファイルのパス</param>
     /// <returns>成功したら true</returns>
     bool LoadFromJSON(const std::string& filepath);
 
+    /// <summary>
+    /// プリコンパイル済みバイナリ（.btbin）からツリーを読み込み
+    /// </summary>
+    /// <param name="binaryPath">バイナリのパス</param>
+    /// <param name="sourcePath">変換元 JSON のパス（鮮度確認用）</param>
+    /// <returns>バイナリが有効かつ最新で、読み込みに成功したら true</returns>
+    bool LoadFromBinary(const std::string& binaryPath, const std::string& sourcePath);
+
+    /// <summary>
+    /// ツリーを読み込み（.btbin を優先し、無いか古ければ JSON から読み込んで .btbin を再生成）
+    /// </summary>
+    /// <param name="filepath">JSON ファイルのパス</param>
+    /// <returns>成功したら true</returns>
+    bool LoadTree(const std::string& filepath);
+
+    /// <summary>
+    /// JSON パスに対応するバイナリのパスを取得（拡張子を .btbin に置き換え）
+    /// </summary>
+    /// <param name="filepath">JSON ファイルのパス</param>
+    /// <returns>バイナリのパス</returns>
+    static std::string GetBinaryPath(const std::string& filepath);
+
     /// <summary>
     /// 現在実行中のノードを取得
     /// </summary>
     /// <returns>実行中のノード（なければ nullptr）</returns>
-    BTNodePtr GetCurrentRunningNode() const { return currentRunningNode_; }
+    BTNode* GetCurrentRunningNode() const { return currentRunningNode_; }
+
+    /// <summary>
+    /// コンパイル済みツリーで評価するかの設定
+    /// false の場合はノードグラフを直接評価する（コンポジットが進行状態を持つため、
+    /// ツリーを他のボスと共有していない場合のデバッグ用）
+    /// </summary>
+    /// <param name="useCompiledTree">コンパイル済みツリーを使う場合 true</param>
+    void SetUseCompiledTree(bool useCompiledTree);
+
+    /// <summary>
+    /// コンパイル済みツリーで評価しているか
+    /// </summary>
+    /// <returns>コンパイル済みツリーを使用中なら true</returns>
+    bool IsUsingCompiledTree() const { return useCompiledTree_; }
+
+    /// <summary>
+    /// コンパイル済みツリーの取得
+    /// </summary>
+    /// <returns>コンパイル済みツリー</returns>
+    const BTCompiledTree& GetCompiledTree() const { return *tree_; }
+
+    /// <summary>
+    /// ツリーの状態プールの取得
+    /// </summary>
+    /// <returns>状態プール（ツリー未設定なら nullptr）</returns>
+    const BTAgentStatePool* GetStatePool() const { return statePool_.get(); }
+
+    /// <summary>
+    /// 共有ツリーの状態プールの取得（同じツリーを使うボスで共有し、使うボスがいなくなれば解放される）
+    /// </summary>
+    /// <param name="tree">コンパイル済みツリー</param>
+    /// <returns>状態プール</returns>
+    static std::shared_ptr<BTAgentStatePool> AcquireStatePool(const std::shared_ptr<const BTCompiledTree>& tree);
+
+    /// <summary>
+    /// ノードが使う乱数のシードを設定（リプレイ・シミュレーションの再現用）
+    /// </summary>
+    /// <param name="seed">シード</param>
+    void SetRandomSeed(uint64_t seed) { blackboard_->GetRandom().Seed(seed); }
 
 private:
     /// <summary>
-    /// JSON からノードツリーを再帰的に構築
+    /// 評価前の準備（デルタタイムの設定など）
+    /// </summary>
+    /// <param name="deltaTime">経過時間</param>
+    /// <returns>評価できる状態なら true</returns>
+    bool BeginUpdate(float deltaTime);
+
+    /// <summary>
+    /// ノードグラフを直接評価（useCompiledTree_ が false の場合）
+    /// </summary>
+    void UpdateGraph();
+
+    /// <summary>
+    /// ツリーファイルの更新を確認し、新しい世代のツリーがあれば実行状態を引き継いで差し替える
+    /// 評価の前に呼び、このティックから最新の世代のツリーと状態ブロックで評価する
+    /// </summary>
+    void PollHotReload();
+
+    /// <summary>
+    /// ホットリロードに結び付けて、その現在のツリーを使う
+    /// </summary>
+    /// <param name="reloader">ホットリロード</param>
+    void BindHotReloader(std::shared_ptr<BTTreeHotReloader> reloader);
+
+    /// <summary>
+    /// 実行状態を引き継いでツリーを差し替え（引き継げなければ SetSharedTree と同じくリセット）
+    /// </summary>
+    /// <param name="tree">新しいツリー</param>
+    void ReplaceTree(std::shared_ptr<const BTCompiledTree> tree);
+
+    /// <summary>
+    /// 確保済みのスロットをこのボスの状態ブロックにする（使っていたスロットは返す）
+    /// </summary>
+    /// <param name="pool">状態プール</param>
+    /// <param name="slot">pool から確保したスロット</param>
+    void BindStateSlot(std::shared_ptr<BTAgentStatePool> pool, uint32_t slot);
+
+    /// <summary>
+    /// 状態プールのスロットを返す
+    /// </summary>
+    void ReleaseStateSlot();
+
+    /// <summary>
+    /// このボスの状態を初期状態に戻す
     /// </summary>
-    /// <param name="nodeJson">ノードの JSON</param>
-    /// <param name="nodeMap">全ノードのマップ</param>
-    /// <param name="links">リンク情報</param>
-    /// <param name="visitedNodes">訪問済みノードセット</param>
-    /// <returns>構築したノード</returns>
-    BTNodePtr BuildNodeFromJSON(const nlohmann::json& nodeJson,
-                                const std::unordered_map<int, nlohmann::json>& nodeMap,
-                                const std::vector<nlohmann::json>& links,
-                                std::unordered_set<int>& visitedNodes);
+    void ResetAgentState();
 
     /// <summary>
-    /// 実行中のノードを再帰的に検索
+    /// コンパイル済みツリーの評価後処理（実行中ノードの記録と完了時のリセット）
     /// </summary>
-    /// <param name="node">検索開始ノード</param>
-    void FindRunningNodeRecursive(const BTNodePtr& node);
+    /// <param name="status">ルートの実行結果</param>
+    void EndCompiledUpdate(BTNodeStatus status);
 
-    // ルートノード
-    BTNodePtr rootNode_;
+    /// <summary>
+    /// プロファイラが有効なら記録済みの実行区間を集計
+    /// </summary>
+    static void CollectProfile();
+
+    /// <summary>
+    /// JSON からノードグラフを生成（.btbin も書き出す）
+    /// </summary>
+    /// <param name="filepath">JSON ファイルのパス</param>
+    /// <returns>ルートノード（失敗時は nullptr）</returns>
+    static BTNodePtr BuildFromJSON(const std::string& filepath);
+
+    /// <summary>
+    /// プリコンパイル済みバイナリからノードグラフを生成
+    /// </summary>
+    /// <param name="binaryPath">バイナリのパス</param>
+    /// <param name="sourcePath">変換元 JSON のパス（鮮度確認用）</param>
+    /// <returns>ルートノード（無効・古い場合は nullptr）</returns>
+    static BTNodePtr BuildFromBinary(const std::string& binaryPath, const std::string& sourcePath);
+
+    /// <summary>
+    /// ノードグラフ上の実行中ノードを検索
+    /// </summary>
+    /// <param name="root">ルートノード</param>
+    /// <param name="rootStatus">ルートの実行結果</param>
+    void FindRunningNodeInGraph(BTNode* root, BTNodeStatus rootStatus);
+
+    // 共有ツリー（不変。ノードグラフの所有も含む）
+    std::shared_ptr<const BTCompiledTree> tree_ = std::make_shared<BTCompiledTree>();
+
+    // このボスのランタイム状態（コンポジットの進行位置・各アクションの状態）が入る、ツリーの状態プールのスロット
+    std::shared_ptr<BTAgentStatePool> statePool_;
+    uint32_t stateSlot_ = BTAgentStatePool::kInvalidSlot;
+    std::byte* stateBlock_ = nullptr;
+
+    // コンパイル済みツリーで評価するか
+    bool useCompiledTree_ = true;
 
     // ブラックボード
     std::unique_ptr<BTBlackboard> blackboard_;
@@ -108,6 +310,19 @@ private:
     // 現在のノード名
     std::string currentNodeName_;
 
-    // 実行中ノード追跡用
-    BTNodePtr currentRunningNode_;
+    // 実行中ノード追跡用（tree_ が所有するノードを参照）
+    BTNode* currentRunningNode_ = nullptr;
+
+    // アクションカウンターのキー
+    BTBlackboardKey actionCounterKey_;
+
+    // ツリーファイルのホットリロード（ファイルに結び付いていなければ nullptr）と反映済みの世代
+    std::shared_ptr<BTTreeHotReloader> hotReloader_;
+    uint32_t hotReloadGeneration_ = 0;
+
+#ifdef _DEBUG
+    static inline bool hotReloadEnabled_ = true;
+#else
+    static inline bool hotReloadEnabled_ = false;
+#endif
 };
\ No newline at end of file
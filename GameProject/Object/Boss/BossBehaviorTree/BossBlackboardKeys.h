@@ -0,0 +1,15 @@
+#pragma once
+#include <string_view>
+
+/// <summary>
+/// ボス用ブラックボードのキー名
+/// ノードはコンストラクタでこの名前から BTBlackboardKey を生成して保持する
+/// </summary>
+namespace BossBlackboardKeys {
+
+/// <summary>
+/// 行動カウンター（偶数: ダッシュ系、奇数: 射撃系）
+/// </summary>
+inline constexpr std::string_view kActionCounter = "ActionCounter";
+
+} // namespace BossBlackboardKeys
@@ -6,6 +6,7 @@
 #include "../../../BehaviorTree/Composites/BTSelector.h"
 #include "../../../BehaviorTree/Composites/BTSequence.h"
 #include "../../../BehaviorTree/Composites/BTRandomSelector.h"
+#include "../../../BehaviorTree/Decorators/BTTimeSlice.h"
 #include "../BossBehaviorTree/Actions/BTBossIdle.h"
 #include "../BossBehaviorTree/Actions/BTBossDash.h"
 #include "../BossBehaviorTree/Actions/BTBossShoot.h"
@@ -19,64 +20,101 @@
 #include "../BossBehaviorTree/Conditions/BTBossPhaseCondition.h"
 #include "../BossBehaviorTree/Conditions/BTBossHPCondition.h"
 #include "../BossBehaviorTree/Conditions/BTBossDistanceCondition.h"
+#include <iterator>
+
+namespace {
 
 /// <summary>
-/// ノードの生成
+/// ノードタイプ表のエントリ
 /// </summary>
-BTNodePtr BossNodeFactory::CreateNode(const std::string& nodeType) {
+struct NodeTypeEntry {
+    const char* typeName;       // ノードタイプ名
+    BTNodePtr (*create)();      // 生成関数
+};
+
+template <class T>
+BTNodePtr MakeNode() {
+    return std::make_shared<T>();
+}
+
+/// <summary>
+/// ノードタイプ表（インデックスがタイプ ID。.btbin に保存されるため、
+/// 並びを変えるとハッシュが変わり既存のバイナリは作り直しになる）
+/// </summary>
+const NodeTypeEntry kNodeTypeTable[] = {
     // Composite ノード
-    if (nodeType == "BTSelector") {
-        return std::make_shared<BTSelector>();
-    }
-    else if (nodeType == "BTSequence") {
-        return std::make_shared<BTSequence>();
-    }
-    else if (nodeType == "BTRandomSelector") {
-        return std::make_shared<BTRandomSelector>();
-    }
+    { "BTSelector", &MakeNode<BTSelector> },
+    { "BTSequence", &MakeNode<BTSequence> },
+    { "BTRandomSelector", &MakeNode<BTRandomSelector> },
+    { "BTTimeSlice", &MakeNode<BTTimeSlice> },
     // Action ノード（Blackboard 経由で Boss/Player にアクセス）
-    else if (nodeType == "BTBossIdle") {
-        return std::make_shared<BTBossIdle>();
-    }
-    else if (nodeType == "BTBossDash") {
-        return std::make_shared<BTBossDash>();
-    }
-    else if (nodeType == "BTBossShoot") {
-        return std::make_shared<BTBossShoot>();
-    }
-    else if (nodeType == "BTBossRapidFire") {
-        return std::make_shared<BTBossRapidFire>();
-    }
-    else if (nodeType == "BTBossWideShoot") {
-        return std::make_shared<BTBossWideShoot>();
-    }
-    else if (nodeType == "BTBossMeleeAttack") {
-        return std::make_shared<BTBossMeleeAttack>();
-    }
-    else if (nodeType == "BTBossApproach") {
-        return std::make_shared<BTBossApproach>();
-    }
-    else if (nodeType == "BTBossRetreat") {
-        return std::make_shared<BTBossRetreat>();
-    }
-    else if (nodeType == "BTBossBarrage") {
-        return std::make_shared<BTBossBarrage>();
-    }
+    { "BTBossIdle", &MakeNode<BTBossIdle> },
+    { "BTBossDash", &MakeNode<BTBossDash> },
+    { "BTBossShoot", &MakeNode<BTBossShoot> },
+    { "BTBossRapidFire", &MakeNode<BTBossRapidFire> },
+    { "BTBossWideShoot", &MakeNode<BTBossWideShoot> },
+    { "BTBossMeleeAttack", &MakeNode<BTBossMeleeAttack> },
+    { "BTBossApproach", &MakeNode<BTBossApproach> },
+    { "BTBossRetreat", &MakeNode<BTBossRetreat> },
+    { "BTBossBarrage", &MakeNode<BTBossBarrage> },
     // Condition ノード
-    else if (nodeType == "BTActionSelector") {
+    { "BTActionSelector", []() -> BTNodePtr {
         return std::make_shared<BTActionSelector>(BTActionSelector::ActionType::Dash);
+    } },
+    { "BTBossPhaseCondition", &MakeNode<BTBossPhaseCondition> },
+    { "BTBossHPCondition", &MakeNode<BTBossHPCondition> },
+    { "BTBossDistanceCondition", &MakeNode<BTBossDistanceCondition> },
+};
+
+constexpr uint16_t kNodeTypeCount = static_cast<uint16_t>(std::size(kNodeTypeTable));
+
+} // namespace
+
+/// <summary>
+/// ノードの生成
+/// </summary>
+BTNodePtr BossNodeFactory::CreateNode(const std::string& nodeType) {
+    return CreateNodeById(GetNodeTypeId(nodeType));
+}
+
+/// <summary>
+/// タイプ ID からノードを生成
+/// </summary>
+BTNodePtr BossNodeFactory::CreateNodeById(uint16_t typeId) {
+    if (typeId >= kNodeTypeCount) {
+        return nullptr;
     }
-    else if (nodeType == "BTBossPhaseCondition") {
-        return std::make_shared<BTBossPhaseCondition>();
-    }
-    else if (nodeType == "BTBossHPCondition") {
-        return std::make_shared<BTBossHPCondition>();
-    }
-    else if (nodeType == "BTBossDistanceCondition") {
-        return std::make_shared<BTBossDistanceCondition>();
+    return kNodeTypeTable[typeId].create();
+}
+
+/// <summary>
+/// ノードタイプ名からタイプ ID を取得
+/// </summary>
+uint16_t BossNodeFactory::GetNodeTypeId(const std::string& nodeType) {
+    for (uint16_t i = 0; i < kNodeTypeCount; ++i) {
+        if (nodeType == kNodeTypeTable[i].typeName) {
+            return i;
+        }
     }
+    return kInvalidTypeId;
+}
 
-    return nullptr;
+/// <summary>
+/// タイプ ID 表のハッシュ（FNV-1a）
+/// </summary>
+uint32_t BossNodeFactory::GetTypeTableHash() {
+    uint32_t hash = 2166136261u;
+    for (const NodeTypeEntry& entry : kNodeTypeTable) {
+        // 名前の区切りも含めてハッシュする
+        for (const char* c = entry.typeName; ; ++c) {
+            hash ^= static_cast<uint8_t>(*c);
+            hash *= 16777619u;
+            if (*c == '\0') {
+                break;
+            }
+        }
+    }
+    return hash;
 }
 
 /// <summary>
@@ -132,6 +170,13 @@ void BossNodeFactory::InitializeNodeTypes() {
             ImVec4(0.9f, 0.6f, 0.2f, 1.0f),  // 明るいオレンジ
             true  // 子ノードを持てる
         },
+        {
+            "BTTimeSlice",
+            "Time Slice",
+            NodeCategory::Composite,
+            ImVec4(0.5f, 0.5f, 0.8f, 1.0f),  // 薄紫
+            true  // 子ノードを持てる（1つ目のみ評価）
+        },
 
         // ========== Action ノード ==========
         {
@@ -273,6 +318,7 @@ std::string BossNodeFactory::GetNodeType(const BTNodePtr& node) {
     if (typeInfo == typeid(BTSelector)) return "BTSelector";
     if (typeInfo == typeid(BTSequence)) return "BTSequence";
     if (typeInfo == typeid(BTRandomSelector)) return "BTRandomSelector";
+    if (typeInfo == typeid(BTTimeSlice)) return "BTTimeSlice";
     if (typeInfo == typeid(BTBossIdle)) return "BTBossIdle";
     if (typeInfo == typeid(BTBossDash)) return "BTBossDash";
     if (typeInfo == typeid(BTBossShoot)) return "BTBossShoot";
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -27,6 +28,31 @@ public:
     /// <returns>生成されたノード（失敗時は nullptr）</returns>
     static BTNodePtr CreateNode(const std::string& nodeType);
 
+    /// <summary>
+    /// 無効なタイプ ID
+    /// </summary>
+    static constexpr uint16_t kInvalidTypeId = UINT16_MAX;
+
+    /// <summary>
+    /// タイプ ID からノードを生成（.btbin の読み込み用）
+    /// </summary>
+    /// <param name="typeId">ノードタイプ ID</param>
+    /// <returns>生成されたノード（失敗時は nullptr）</returns>
+    static BTNodePtr CreateNodeById(uint16_t typeId);
+
+    /// <summary>
+    /// ノードタイプ名からタイプ ID を取得
+    /// </summary>
+    /// <param name="nodeType">ノードタイプ名</param>
+    /// <returns>タイプ ID（未知のタイプなら kInvalidTypeId）</returns>
+    static uint16_t GetNodeTypeId(const std::string& nodeType);
+
+    /// <summary>
+    /// タイプ ID 表のハッシュを取得（.btbin の互換性確認用）
+    /// </summary>
+    /// <returns>タイプ名の並びから計算したハッシュ</returns>
+    static uint32_t GetTypeTableHash();
+
     /// <summary>
     /// Boss/Player の依存関係を持つノードの生成
     /// </summary>
@@ -1,28 +1,28 @@
 #include "BTActionSelector.h"
+#include "../BossBlackboardKeys.h"
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
 #endif
 
 BTActionSelector::BTActionSelector(ActionType type)
-    : expectedType_(type) {
+    : expectedType_(type)
+    , actionCounterKey_(BossBlackboardKeys::kActionCounter) {
     name_ = (type == ActionType::Dash) ? "ActionSelector(Dash)" : "ActionSelector(Shoot)";
 }
 
 BTNodeStatus BTActionSelector::Execute(BTBlackboard* blackboard) {
     // アクションカウンターを取得
-    int actionCounter = blackboard->GetInt("ActionCounter", 0);
+    int actionCounter = blackboard->GetInt(actionCounterKey_, 0);
 
     // カウンターの偶奇で判定
     int currentType = actionCounter % 2;
 
     // 期待するタイプと一致すれば成功
     if (currentType == static_cast<int>(expectedType_)) {
-        status_ = BTNodeStatus::Success;
         return BTNodeStatus::Success;
     }
 
-    status_ = BTNodeStatus::Failure;
     return BTNodeStatus::Failure;
 }
 
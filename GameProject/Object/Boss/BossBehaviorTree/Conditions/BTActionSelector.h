@@ -1,6 +1,7 @@
 #pragma once
 #include "../../../../BehaviorTree/Core/BTNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../../BehaviorTree/Core/BTBlackboardKey.h"
 
 /// <summary>
 /// アクション選択条件ノード
@@ -52,10 +53,10 @@ public:
     void SetActionType(ActionType type) { expectedType_ = type; }
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override {
+    /// <param name="params">パラメータ</param>
+    void ApplyParameters(const BTParameters& params) override {
         if (params.contains("actionType")) {
             expectedType_ = static_cast<ActionType>(params["actionType"].get<int>());
         }
@@ -76,4 +77,7 @@ public:
 private:
     // 期待するアクションタイプ
     ActionType expectedType_;
+
+    // アクションカウンターのキー（コンストラクタで解決）
+    BTBlackboardKey actionCounterKey_;
 };
\ No newline at end of file
@@ -11,42 +11,41 @@ using namespace Tako;
 
 BTBossDistanceCondition::BTBossDistanceCondition() {
     name_ = "DistanceCondition";
+
+    // 位置は毎フレーム細かく動くため、わずかな移動と短い間隔では再評価しない
+    cacheInterval_ = 0.2f;
+    inputTolerance_ = 0.05f;
 }
 
-BTNodeStatus BTBossDistanceCondition::Execute(BTBlackboard* blackboard) {
+void BTBossDistanceCondition::GatherInputs(BTBlackboard* blackboard, BTConditionInputs& inputs) const {
     // ボスとプレイヤーを取得
     Boss* boss = blackboard->GetBoss();
     Player* player = blackboard->GetPlayer();
 
     if (!boss || !player) {
-        status_ = BTNodeStatus::Failure;
-        return BTNodeStatus::Failure;
+        inputs.Invalidate();
+        return;
     }
 
-    // 位置を取得
-    Vector3 bossPos = boss->GetTransform().translate;
-    Vector3 playerPos = player->GetTransform().translate;
+    // 水平位置のみに依存する（Y 軸を無視）
+    const Vector3& bossPos = boss->GetTransform().translate;
+    const Vector3& playerPos = player->GetTransform().translate;
+    inputs.Add(bossPos.x);
+    inputs.Add(bossPos.z);
+    inputs.Add(playerPos.x);
+    inputs.Add(playerPos.z);
+}
 
-    // 水平距離を計算（Y 軸を無視）
-    Vector3 diff = playerPos - bossPos;
-    diff.y = 0.0f;
+bool BTBossDistanceCondition::Evaluate(const BTConditionInputs& inputs) const {
+    // 水平距離を計算
+    Vector3 diff = { inputs.values[2] - inputs.values[0], 0.0f, inputs.values[3] - inputs.values[1] };
     float distance = diff.Length();
 
     // 範囲内チェック: minDistance_ <= distance <= maxDistance_
-    if (distance >= minDistance_ && distance <= maxDistance_) {
-        status_ = BTNodeStatus::Success;
-        return BTNodeStatus::Success;
-    }
-
-    status_ = BTNodeStatus::Failure;
-    return BTNodeStatus::Failure;
-}
-
-void BTBossDistanceCondition::Reset() {
-    BTNode::Reset();
+    return distance >= minDistance_ && distance <= maxDistance_;
 }
 
-void BTBossDistanceCondition::ApplyParameters(const nlohmann::json& params) {
+void BTBossDistanceCondition::ApplyConditionParameters(const BTParameters& params) {
     if (params.contains("minDistance")) {
         minDistance_ = params["minDistance"].get<float>();
     }
@@ -55,7 +54,7 @@ void BTBossDistanceCondition::ApplyParameters(const nlohmann::json& params) {
     }
 }
 
-nlohmann::json BTBossDistanceCondition::ExtractParameters() const {
+nlohmann::json BTBossDistanceCondition::ExtractConditionParameters() const {
     return {
         {"minDistance", minDistance_},
         {"maxDistance", maxDistance_}
@@ -63,7 +62,7 @@ nlohmann::json BTBossDistanceCondition::ExtractParameters() const {
 }
 
 #ifdef _DEBUG
-bool BTBossDistanceCondition::DrawImGui() {
+bool BTBossDistanceCondition::DrawConditionImGui() {
     bool changed = false;
 
     // 最小距離の編集
@@ -1,12 +1,11 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
-#include "../../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../../BehaviorTree/Core/BTCachedCondition.h"
 
 /// <summary>
 /// 距離条件ノード
 /// プレイヤーとの距離が指定範囲内かを判定して成功/失敗を返す
 /// </summary>
-class BTBossDistanceCondition : public BTNode {
+class BTBossDistanceCondition : public BTCachedCondition {
 public:
     /// <summary>
     /// コンストラクタ
@@ -18,43 +17,46 @@ public:
     /// </summary>
     virtual ~BTBossDistanceCondition() = default;
 
+    // Getters/Setters
+    float GetMinDistance() const { return minDistance_; }
+    void SetMinDistance(float dist) { minDistance_ = dist; InvalidateCache(); }
+
+    float GetMaxDistance() const { return maxDistance_; }
+    void SetMaxDistance(float dist) { maxDistance_ = dist; InvalidateCache(); }
+
+protected:
     /// <summary>
-    /// ノードの実行
+    /// 判定に使う入力値を集める
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
-    /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
+    /// <param name="inputs">入力の格納先</param>
+    void GatherInputs(BTBlackboard* blackboard, BTConditionInputs& inputs) const override;
 
     /// <summary>
-    /// ノードのリセット
+    /// 入力値から条件を判定
     /// </summary>
-    void Reset() override;
+    /// <param name="inputs">入力値</param>
+    /// <returns>条件を満たしていれば true</returns>
+    bool Evaluate(const BTConditionInputs& inputs) const override;
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override;
+    /// <param name="params">パラメータ</param>
+    void ApplyConditionParameters(const BTParameters& params) override;
 
     /// <summary>
     /// パラメータを JSON として抽出
     /// </summary>
-    nlohmann::json ExtractParameters() const override;
+    nlohmann::json ExtractConditionParameters() const override;
 
 #ifdef _DEBUG
     /// <summary>
     /// ImGui でパラメータ編集 UI を描画
     /// </summary>
-    bool DrawImGui() override;
+    bool DrawConditionImGui() override;
 #endif
 
-    // Getters/Setters
-    float GetMinDistance() const { return minDistance_; }
-    void SetMinDistance(float dist) { minDistance_ = dist; }
-
-    float GetMaxDistance() const { return maxDistance_; }
-    void SetMaxDistance(float dist) { maxDistance_ = dist; }
-
 private:
     // 最小距離（これ以上離れている必要がある）
     float minDistance_ = 0.0f;
@@ -9,29 +9,21 @@ BTBossHPCondition::BTBossHPCondition() {
     name_ = "HPCondition";
 }
 
-BTNodeStatus BTBossHPCondition::Execute(BTBlackboard* blackboard) {
+void BTBossHPCondition::GatherInputs(BTBlackboard* blackboard, BTConditionInputs& inputs) const {
     // ボスを取得
     Boss* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
-        return BTNodeStatus::Failure;
+        inputs.Invalidate();
+        return;
     }
 
     // 現在の HP をパーセンテージに変換
     float currentHp = boss->GetHp();
-    float currentPercent = (currentHp / Boss::GetMaxHp()) * 100.0f;
-
-    if (EvaluateCondition(currentPercent)) {
-        status_ = BTNodeStatus::Success;
-        return BTNodeStatus::Success;
-    }
-
-    status_ = BTNodeStatus::Failure;
-    return BTNodeStatus::Failure;
+    inputs.Add((currentHp / Boss::GetMaxHp()) * 100.0f);
 }
 
-void BTBossHPCondition::Reset() {
-    BTNode::Reset();
+bool BTBossHPCondition::Evaluate(const BTConditionInputs& inputs) const {
+    return EvaluateCondition(inputs.values[0]);
 }
 
 bool BTBossHPCondition::EvaluateCondition(float currentPercent) const {
@@ -49,7 +41,7 @@ bool BTBossHPCondition::EvaluateCondition(float currentPercent) const {
     }
 }
 
-void BTBossHPCondition::ApplyParameters(const nlohmann::json& params) {
+void BTBossHPCondition::ApplyConditionParameters(const BTParameters& params) {
     if (params.contains("thresholdPercent")) {
         thresholdPercent_ = params["thresholdPercent"].get<float>();
     }
@@ -58,7 +50,7 @@ void BTBossHPCondition::ApplyParameters(const nlohmann::json& params) {
     }
 }
 
-nlohmann::json BTBossHPCondition::ExtractParameters() const {
+nlohmann::json BTBossHPCondition::ExtractConditionParameters() const {
     return {
         {"thresholdPercent", thresholdPercent_},
         {"comparison", static_cast<int>(comparison_)}
@@ -66,7 +58,7 @@ nlohmann::json BTBossHPCondition::ExtractParameters() const {
 }
 
 #ifdef _DEBUG
-bool BTBossHPCondition::DrawImGui() {
+bool BTBossHPCondition::DrawConditionImGui() {
     bool changed = false;
 
     // HP 閾値の編集（パーセンテージ）
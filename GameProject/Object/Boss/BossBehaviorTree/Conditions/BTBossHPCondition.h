@@ -1,12 +1,11 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
-#include "../../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../../BehaviorTree/Core/BTCachedCondition.h"
 
 /// <summary>
 /// HP 条件ノード
 /// 現在のボス HP を最大 HP に対するパーセンテージで比較して成功/失敗を返す
 /// </summary>
-class BTBossHPCondition : public BTNode {
+class BTBossHPCondition : public BTCachedCondition {
 public:
     /// <summary>
     /// 比較タイプ
@@ -28,43 +27,46 @@ public:
     /// </summary>
     virtual ~BTBossHPCondition() = default;
 
+    // Getters/Setters
+    float GetThresholdPercent() const { return thresholdPercent_; }
+    void SetThresholdPercent(float percent) { thresholdPercent_ = percent; InvalidateCache(); }
+
+    Comparison GetComparison() const { return comparison_; }
+    void SetComparison(Comparison comp) { comparison_ = comp; InvalidateCache(); }
+
+protected:
     /// <summary>
-    /// ノードの実行
+    /// 判定に使う入力値を集める
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
-    /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
+    /// <param name="inputs">入力の格納先</param>
+    void GatherInputs(BTBlackboard* blackboard, BTConditionInputs& inputs) const override;
 
     /// <summary>
-    /// ノードのリセット
+    /// 入力値から条件を判定
     /// </summary>
-    void Reset() override;
+    /// <param name="inputs">入力値</param>
+    /// <returns>条件を満たしていれば true</returns>
+    bool Evaluate(const BTConditionInputs& inputs) const override;
 
     /// <summary>
-    /// JSON からパラメータを適用
+    /// パラメータを適用
     /// </summary>
-    /// <param name="params">パラメータ JSON</param>
-    void ApplyParameters(const nlohmann::json& params) override;
+    /// <param name="params">パラメータ</param>
+    void ApplyConditionParameters(const BTParameters& params) override;
 
     /// <summary>
     /// パラメータを JSON として抽出
     /// </summary>
-    nlohmann::json ExtractParameters() const override;
+    nlohmann::json ExtractConditionParameters() const override;
 
 #ifdef _DEBUG
     /// <summary>
     /// ImGui でパラメータ編集 UI を描画
     /// </summary>
-    bool DrawImGui() override;
+    bool DrawConditionImGui() override;
 #endif
 
-    // Getters/Setters
-    float GetThresholdPercent() const { return thresholdPercent_; }
-    void SetThresholdPercent(float percent) { thresholdPercent_ = percent; }
-
-    Comparison GetComparison() const { return comparison_; }
-    void SetComparison(Comparison comp) { comparison_ = comp; }
-
 private:
     /// <summary>
     /// 比較条件を評価
@@ -9,28 +9,20 @@ BTBossPhaseCondition::BTBossPhaseCondition() {
     name_ = "PhaseCondition";
 }
 
-BTNodeStatus BTBossPhaseCondition::Execute(BTBlackboard* blackboard) {
+void BTBossPhaseCondition::GatherInputs(BTBlackboard* blackboard, BTConditionInputs& inputs) const {
     // ボスを取得
     Boss* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
-        return BTNodeStatus::Failure;
+        inputs.Invalidate();
+        return;
     }
 
-    // 現在のフェーズを取得して比較
-    uint32_t currentPhase = boss->GetPhase();
-
-    if (EvaluateCondition(currentPhase)) {
-        status_ = BTNodeStatus::Success;
-        return BTNodeStatus::Success;
-    }
-
-    status_ = BTNodeStatus::Failure;
-    return BTNodeStatus::Failure;
+    // 現在のフェーズ（float で正確に表せる範囲の整数）
+    inputs.Add(static_cast<float>(boss->GetPhase()));
 }
 
-void BTBossPhaseCondition::Reset() {
-    BTNode::Reset();
+bool BTBossPhaseCondition::Evaluate(const BTConditionInputs& inputs) const {
+    return EvaluateCondition(static_cast<uint32_t>(inputs.values[0]));
 }
 
 bool BTBossPhaseCondition::EvaluateCondition(uint32_t currentPhase) const {
@@ -48,7 +40,7 @@ bool BTBossPhaseCondition::EvaluateCondition(uint32_t currentPhase) const {
     }
 }
 
-void BTBossPhaseCondition::ApplyParameters(const nlohmann::json& params) {
+void BTBossPhaseCondition::ApplyConditionParameters(const BTParameters& params) {
     if (params.contains("targetPhase")) {
         targetPhase_ = params["targetPhase"].get<uint32_t>();
     }
@@ -57,7 +49,7 @@ void BTBossPhaseCondition::ApplyParameters(const nlohmann::json& params) {
     }
 }
 
-nlohmann::json BTBossPhaseCondition::ExtractParameters() const {
+nlohmann::json BTBossPhaseCondition::ExtractConditionParameters() const {
     return {
         {"targetPhase", targetPhase_},
         {"comparison", static_cast<int>(comparison_)}
@@ -65,7 +57,7 @@ nlohmann::json BTBossPhaseCondition::ExtractParameters() const {
 }
 
 #ifdef _DEBUG
-bool BTBossPhaseCondition::DrawImGui() {
+bool BTBossPhaseCondition::DrawConditionImGui() {
     bool changed = false;
 
     // フェーズ値の編集
@@ -5,6 +5,7 @@
 #include "../BossBehaviorTree/BossBehaviorTree.h"
 #include "../../../BehaviorTree/Core/BTComposite.h"
 #include "../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../BehaviorTree/Core/BTProfiler.h"
 #include "../BossBehaviorTree/Conditions/BTActionSelector.h"
 #include "DebugUIManager.h"
 #include <imgui_internal.h>
@@ -82,6 +83,7 @@ void BossNodeEditor::Update() {
     if (ImGui::Begin("Boss Behavior Tree Editor", &isVisible_)) {
         // ツールバーの描画
         DrawToolbar();
+        DrawProfilerToolbar();
 
         ImGui::Separator();
 
@@ -253,6 +255,55 @@ void BossNodeEditor::DrawToolbar() {
     }
 }
 
+/// <summary>
+/// プロファイラ操作用ツールバーの描画
+/// </summary>
+void BossNodeEditor::DrawProfilerToolbar() {
+#if BT_PROFILER_ENABLED
+    BTProfiler* profiler = BTProfiler::GetInstance();
+
+    bool profiling = BTProfiler::IsEnabled();
+    if (ImGui::Checkbox("Profile##bne_profiler", &profiling)) {
+        BTProfiler::SetEnabled(profiling);
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Heat Map##bne_profiler", &showHeatMap_);
+    ImGui::SameLine();
+
+    if (ImGui::Button("Reset##bne_profiler")) {
+        profiler->Reset();
+    }
+    ImGui::SameLine();
+
+    if (ImGui::Button("Export Trace##bne_profiler")) {
+        bool exported = profiler->ExportChromeTrace(kProfileTracePath) && profiler->ExportStatsJSON(kProfileStatsPath);
+        DebugUIManager::GetInstance()->AddLog(
+            exported ? "[BossNodeEditor] Exported profile to: " + std::string(kProfileTracePath)
+                     : "[BossNodeEditor] Failed to export profile",
+            exported ? DebugUIManager::LogType::Info : DebugUIManager::LogType::Error);
+    }
+
+    uint64_t dropped = profiler->GetDroppedCount();
+    if (dropped > 0) {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "Dropped: %llu", static_cast<unsigned long long>(dropped));
+    }
+#endif
+}
+
+/// <summary>
+/// ヒートマップの色（0: 青 → 0.5: 黄 → 1: 赤）
+/// </summary>
+ImVec4 BossNodeEditor::GetHeatColor(float heat) {
+    heat = std::clamp(heat, 0.0f, 1.0f);
+    if (heat < 0.5f) {
+        float t = heat * 2.0f;
+        return ImVec4(0.15f + t * 0.65f, 0.25f + t * 0.5f, 0.6f - t * 0.5f, 1.0f);
+    }
+    float t = (heat - 0.5f) * 2.0f;
+    return ImVec4(0.8f, 0.75f - t * 0.6f, 0.1f, 1.0f);
+}
+
 /// <summary>
 /// ノードの描画
 /// </summary>
@@ -278,6 +329,14 @@ void BossNodeEditor::DrawNode(const EditorNode& node) {
         1.0f
     );
 
+    // プロファイラのヒートマップ（自己時間が長いノードほど赤く）
+    const BTProfiler::NodeStats* profile = showHeatMap_ ? BTProfiler::GetInstance()->GetNodeStats(node.runtimeNode.get()) : nullptr;
+    if (profile) {
+        uint64_t maxSelfNs = BTProfiler::GetInstance()->GetMaxSelfNs();
+        float heat = maxSelfNs > 0 ? static_cast<float>(profile->selfNs) / static_cast<float>(maxSelfNs) : 0.0f;
+        nodeColor = GetHeatColor(heat);
+    }
+
     // 実行中ノードのパルスエフェクト計算
     bool isHighlighted = (node.id == highlightedNodeId_);
 
@@ -301,9 +360,9 @@ void BossNodeEditor::DrawNode(const EditorNode& node) {
 
         // ノード背景色も少し明るく
         nodeColor = ImVec4(
-            node.color.x * 0.7f + pulseIntensity * 0.1f,
-            node.color.y * 0.7f + pulseIntensity * 0.1f,
-            node.color.z * 0.7f + pulseIntensity * 0.1f,
+            nodeColor.x + pulseIntensity * 0.1f,
+            nodeColor.y + pulseIntensity * 0.1f,
+            nodeColor.z + pulseIntensity * 0.1f,
             1.0f
         );
     }
@@ -368,6 +427,16 @@ void BossNodeEditor::DrawNode(const EditorNode& node) {
     ImGui::Dummy(ImVec2((nodeWidth - typeWidth) * 0.5f, 0));
     ImGui::SameLine(0, 0);
     ImGui::Text("%s", node.nodeType.c_str());
+
+    // 計測値（実行回数と1回あたりの平均時間）
+    if (profile && profile->tickCount > 0) {
+        std::string profileText = std::format("{} ticks  {:.2f} us",
+            profile->tickCount, static_cast<double>(profile->totalNs) / 1000.0 / static_cast<double>(profile->tickCount));
+        float profileWidth = ImGui::CalcTextSize(profileText.c_str()).x * 0.85f;
+        ImGui::Dummy(ImVec2((nodeWidth - profileWidth) * 0.5f, 0));
+        ImGui::SameLine(0, 0);
+        ImGui::Text("%s", profileText.c_str());
+    }
     ImGui::SetWindowFontScale(1.0f);
     ImGui::PopStyleColor();
 
@@ -730,6 +799,21 @@ void BossNodeEditor::DrawNodeInspector() {
         ImGui::TextDisabled("No runtime node");
     }
 
+    // プロファイラの計測値
+    if (const BTProfiler::NodeStats* profile = BTProfiler::GetInstance()->GetNodeStats(node->runtimeNode.get())) {
+        ImGui::Separator();
+        ImGui::Text("Profile");
+        double ticks = static_cast<double>(std::max<uint64_t>(profile->tickCount, 1));
+        ImGui::Text("Ticks: %llu", static_cast<unsigned long long>(profile->tickCount));
+        ImGui::Text("Total: %.3f ms  (avg %.2f us)", profile->totalNs / 1e6, profile->totalNs / 1e3 / ticks);
+        ImGui::Text("Self:  %.3f ms  (avg %.2f us)", profile->selfNs / 1e6, profile->selfNs / 1e3 / ticks);
+        ImGui::Text("Peak:  %.2f us", profile->peakNs / 1e3);
+        ImGui::Text("Success %llu / Failure %llu / Running %llu",
+            static_cast<unsigned long long>(profile->statusCounts[static_cast<size_t>(BTNodeStatus::Success)]),
+            static_cast<unsigned long long>(profile->statusCounts[static_cast<size_t>(BTNodeStatus::Failure)]),
+            static_cast<unsigned long long>(profile->statusCounts[static_cast<size_t>(BTNodeStatus::Running)]));
+    }
+
     ImGui::End();
 }
 
@@ -776,8 +860,10 @@ bool BossNodeEditor::LoadFromJSON(const std::string& filepath) {
                     nodeJson["position"]["y"]
                 );
 
-                // ノードを作成（ID は自動生成される）
-                int newId = CreateNodeWithId(nextNodeId_++, nodeType, position);
+                // ノードを作成（保存時の ID を維持し、ホットリロードで同じノードとして対応付けられるようにする）
+                int nodeId = FindNodeById(oldId) ? nextNodeId_++ : oldId;
+                nextNodeId_ = std::max(nextNodeId_, nodeId + 1);
+                int newId = CreateNodeWithId(nodeId, nodeType, position);
                 if (newId != -1) {
                     oldToNewNodeIdMap[oldId] = newId;
 
@@ -959,13 +1045,13 @@ BTNodePtr BossNodeEditor::BuildRuntimeTree() {
 /// <summary>
 /// 現在実行中のノードをハイライト表示（パルスエフェクト付き）
 /// </summary>
-void BossNodeEditor::HighlightRunningNode(const BTNodePtr& nodePtr) {
-    if (!nodePtr) {
+void BossNodeEditor::HighlightRunningNode(BTNode* node) {
+    if (!node) {
         highlightedNodeId_ = -1;
         return;
     }
 
-    EditorNode* editorNode = FindNodeByRuntimeNode(nodePtr);
+    EditorNode* editorNode = FindNodeByRuntimeNode(node);
     if (editorNode) {
         // ハイライトノードを更新
         if (highlightedNodeId_ != editorNode->id) {
@@ -1006,10 +1092,10 @@ const BossNodeEditor::EditorNode* BossNodeEditor::FindNodeById(int nodeId) const
 /// <summary>
 /// ランタイムノードでエディタノードを検索
 /// </summary>
-BossNodeEditor::EditorNode* BossNodeEditor::FindNodeByRuntimeNode(const BTNodePtr& node) {
+BossNodeEditor::EditorNode* BossNodeEditor::FindNodeByRuntimeNode(BTNode* node) {
     if (!node) return nullptr;
 
-    auto it = runtimeNodeToEditorId_.find(node.get());
+    auto it = runtimeNodeToEditorId_.find(node);
     if (it != runtimeNodeToEditorId_.end()) {
         return FindNodeById(it->second);
     }
@@ -121,8 +121,8 @@ public:
     /// <summary>
     /// 現在実行中のノードをハイライト表示（デバッグ用）
     /// </summary>
-    /// <param name="nodePtr">実行中のノード</param>
-    void HighlightRunningNode(const BTNodePtr& nodePtr);
+    /// <param name="node">実行中のノード</param>
+    void HighlightRunningNode(BTNode* node);
 
     /// <summary>
     /// エディタのクリア
@@ -138,6 +138,10 @@ private:
     void DrawContextMenu();
     void DrawNodeInspector();
     void DrawToolbar();
+    void DrawProfilerToolbar();
+
+    // プロファイラのヒートマップ色（heat: 0～1）
+    static ImVec4 GetHeatColor(float heat);
 
     // ノード作成
     void CreateNode(const std::string& nodeType, const ImVec2& position);
@@ -149,7 +153,7 @@ private:
     // ヘルパー関数
     EditorNode* FindNodeById(int nodeId);
     const EditorNode* FindNodeById(int nodeId) const;
-    EditorNode* FindNodeByRuntimeNode(const BTNodePtr& node);
+    EditorNode* FindNodeByRuntimeNode(BTNode* node);
     EditorPin* FindPinById(int pinId);
     const EditorPin* FindPinById(int pinId) const;
     EditorLink* FindLinkById(int linkId);
@@ -185,6 +189,11 @@ private:
     float highlightStartTime_;  // ハイライト開始時刻（パルスエフェクト用）
     int selectedNodeId_ = -1;  // 選択中のノード ID（インスペクター用）
 
+    // プロファイラ
+    static constexpr const char* kProfileTracePath = "resources/Profile/BossTreeTrace.json";
+    static constexpr const char* kProfileStatsPath = "resources/Profile/BossTreeStats.json";
+    bool showHeatMap_ = true;  // 計測値でノードを色分けするか
+
     // ノード・ピン ID マッピング管理
     std::unordered_map<BTNode*, int> runtimeNodeToEditorId_;
 };
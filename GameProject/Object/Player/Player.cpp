@@ -22,6 +22,7 @@
 #include "../../Common/DamageFeedback.h"
 #include "FrameTimer.h"
 #include "EmitterManager.h"
+#include "Vec3Func.h"
 
 #include <cmath>
 #include <algorithm>
@@ -698,7 +699,7 @@ void Player::RequestBulletSpawn(const Vector3& position, const Vector3& velocity
     bulletSpawner_.RequestSpawn(position, velocity);
 }
 
-std::vector<BulletSpawnRequest> Player::ConsumePendingBullets()
+std::span<const BulletSpawnRequest> Player::ConsumePendingBullets()
 {
     return bulletSpawner_.Consume();
 }
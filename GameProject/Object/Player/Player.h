@@ -150,8 +150,8 @@ public: // メンバ関数
     /// <summary>
     /// 保留中の弾生成リクエストを取得して消費
     /// </summary>
-    /// <returns>弾生成リクエストのリスト</returns>
-    std::vector<BulletSpawnRequest> ConsumePendingBullets();
+    /// <returns>弾生成リクエストの配列（次のフレームの終わりまで有効）</returns>
+    std::span<const BulletSpawnRequest> ConsumePendingBullets();
 
     //----------------------------------Setters-----------------------------------//
     /// <summary>
@@ -344,6 +344,12 @@ public: // メンバ関数
     /// <returns>近接攻撃コライダーのポインタ</returns>
     MeleeAttackCollider* GetMeleeAttackCollider() const { return meleeAttackCollider_.get(); }
 
+    /// <summary>
+    /// 体のコライダーを取得
+    /// </summary>
+    /// <returns>体のコライダーのポインタ</returns>
+    Tako::OBBCollider* GetBodyCollider() const { return bodyCollider_.get(); }
+
     /// <summary>
     /// 攻撃ブロックを取得
     /// </summary>
@@ -1,24 +1,26 @@
 #include "BossBullet.h"
 #include "../../Collision/BossBulletCollider.h"
 #include "../../Object/Player/Player.h"
-#include "../../Common/GameConst.h"
 #include "ModelManager.h"
 #include "Object3d.h"
-#include "CollisionManager.h"
-#include "EmitterManager.h"
 #include "RandomEngine.h"
 #include "GlobalVariables.h"
-#include <format>
 
 using namespace Tako;
 
-uint32_t BossBullet::id = 0;
+BossBullet::BossBullet() {
+    // モデルとコライダーは生成時に用意し、プールで再利用する
+    Projectile::SetDefaultModel();
+    collider_ = std::make_unique<BossBulletCollider>(this);
+}
+
+BossBullet::~BossBullet() = default;
 
-BossBullet::BossBullet(EmitterManager* emittermanager) {
+void BossBullet::Initialize(const Vector3& position, const Vector3& velocity) {
     // GlobalVariables から値を取得
     GlobalVariables* gv = GlobalVariables::GetInstance();
 
-    // 弾のパラメータ設定（GlobalVariables から取得）
+    // 弾のパラメータ設定（再利用時も調整中の値を反映するため発射ごとに取得）
     damage_ = gv->GetValueFloat("BossBullet", "Damage");
     lifeTime_ = gv->GetValueFloat("BossBullet", "Lifetime");
 
@@ -31,92 +33,30 @@ BossBullet::BossBullet(EmitterManager* emittermanager) {
         rng->GetFloat(rotationSpeedMin_, rotationSpeedMax_)
     );
 
-    // エミッターマネージャーの設定
-    emitterManager_ = emittermanager;
-
-    // エフェクトプリセットをロード
-    if (emitterManager_) {
-        bulletEmitterName_ = std::format("boss_bullet{}", id);
-        explodeEmitterName_ = std::format("boss_bullet_explode{}", id);
-        emitterManager_->LoadPreset("boss_bullet", bulletEmitterName_);
-        emitterManager_->SetEmitterActive(bulletEmitterName_, false);
-        emitterManager_->LoadPreset("boss_bullet_explode", explodeEmitterName_);
-        emitterManager_->SetEmitterActive(explodeEmitterName_, false);
-    }
-
-    id++;
-
-    if (id > kIdResetThreshold) {
-        id = 0; // ID のリセット
-    }
-}
-
-BossBullet::~BossBullet() = default;
-
-void BossBullet::Initialize(const Vector3& position, const Vector3& velocity) {
     // 親クラスの初期化
     Projectile::Initialize(position, velocity);
 
-    // モデルをロード
+    // モデルをロード（再利用時は設定済み）
     Projectile::SetDefaultModel();
     model_->Update();
 
     // スケールを設定（球体モデルのサイズ調整）
     transform_.scale = Vector3(kInitialScale, kInitialScale, kInitialScale);
 
-    // エミッターを有効化
-    Projectile::ActivateBulletEmitter(position);
-
     // コライダーの設定
-    if (!collider_) {
-        collider_ = std::make_unique<BossBulletCollider>(this);
-    }
-    float colliderRadius = GlobalVariables::GetInstance()->GetValueFloat("BossBullet", "ColliderRadius");
+    float colliderRadius = gv->GetValueFloat("BossBullet", "ColliderRadius");
     collider_->SetTransform(&transform_);
     collider_->SetRadius(colliderRadius);
+    collisionRadius_ = colliderRadius;
     collider_->SetOffset(Vector3(0.0f, 0.0f, 0.0f));
     collider_->SetTypeID(static_cast<uint32_t>(CollisionTypeId::BOSS_ATTACK));
     collider_->SetOwner(this);
     collider_->SetActive(true);
     collider_->Reset();
 
-    // CollisionManager に登録
-    CollisionManager::GetInstance()->AddCollider(collider_.get());
+    // 当たり判定は ProjectileManager::CheckCollisions が位置の配列に対してまとめて行うので CollisionManager には登録しない
 }
 
-void BossBullet::Finalize() {
-    // CollisionManager から削除
-    if (collider_) {
-        CollisionManager::GetInstance()->RemoveCollider(collider_.get());
-    }
-
-    // エミッター終了処理
-    Projectile::FinalizeEmitters();
+Collider* BossBullet::GetHitCollider() const {
+    return collider_.get();
 }
-
-void BossBullet::Update(float deltaTime) {
-    if (!isActive_) {
-        return;
-    }
-
-    // 親クラスの更新処理
-    Projectile::Update(deltaTime);
-
-    // 回転アニメーション
-    transform_.rotate += rotationSpeed_ * deltaTime;
-
-    // 軌跡エフェクト
-    if (emitterManager_) {
-        emitterManager_->SetEmitterPosition(bulletEmitterName_, transform_.translate);
-        emitterManager_->SetEmitterPosition(explodeEmitterName_, transform_.translate);
-    }
-
-    // エリア外に出たら非アクティブ化
-    Vector3 pos = transform_.translate;
-    if (pos.x < GameConst::kStageXMin || pos.x > GameConst::kStageXMax ||
-        pos.z < GameConst::kStageZMin || pos.z > GameConst::kStageZMax ||
-        pos.y < yBoundaryMin_ || pos.y > yBoundaryMax_) {
-        isActive_ = false;
-    }
-}
-
@@ -1,15 +1,11 @@
 #pragma once
 
 #include "Projectile.h"
+#include "ProjectileBatch.h"
 #include "../../Collision/CollisionTypeIdDef.h"
 #include <memory>
 #include <string>
 
-namespace Tako {
-    class EmitterManager;
-    class ModelManager;
-}
-
 class PenetratingBossBulletCollider;
 
 /// <summary>
@@ -21,14 +17,24 @@ class PenetratingBossBullet : public Projectile {
     // 定数
     //=========================================================================================
 private:
-    static constexpr uint32_t kIdResetThreshold = 10000;///< ID リセット閾値
     static constexpr float kInitialScale = 0.0f;        ///< 初期スケール
 
 public:
+    /// <summary>
+    /// 一括計算での挙動（回転しながら飛び、範囲外に出たら消える。プレイヤー側との当たり判定は一括で行う）
+    /// </summary>
+    static constexpr uint32_t kSimulationFlags = ProjectileBatch::kFlagRotate | ProjectileBatch::kFlagCullBounds | ProjectileBatch::kFlagHostile;
+
+    /// <summary>
+    /// 軌跡・爆発エフェクトのプリセット名（ProjectileManager がエミッターを用意する）
+    /// </summary>
+    static constexpr const char* kTrailEmitterPreset = "boss_penetrate_bullet";
+    static constexpr const char* kExplodeEmitterPreset = "boss_penetrate_bullet_explode";
+
     /// <summary>
     /// コンストラクタ
     /// </summary>
-    PenetratingBossBullet(Tako::EmitterManager* emittermanager);
+    PenetratingBossBullet();
 
     /// <summary>
     /// デストラクタ
@@ -42,17 +48,6 @@ public:
     /// <param name="velocity">初期速度</param>
     void Initialize(const Tako::Vector3& position, const Tako::Vector3& velocity) override;
 
-    /// <summary>
-    /// 終了処理
-    /// </summary>
-    void Finalize();
-
-    /// <summary>
-    /// 更新
-    /// </summary>
-    /// <param name="deltaTime">前フレームからの経過時間</param>
-    void Update(float deltaTime) override;
-
     /// <summary>
     /// コリジョンタイプ ID を取得
     /// </summary>
@@ -63,19 +58,16 @@ public:
     /// </summary>
     PenetratingBossBulletCollider* GetCollider() const { return collider_.get(); }
 
-private:
-    // エフェクト用の回転速度
-    Tako::Vector3 rotationSpeed_;
+    /// <summary>
+    /// 衝突を通知するコライダーを取得
+    /// </summary>
+    Tako::Collider* GetHitCollider() const override;
 
+private:
     // 専用コライダー
     std::unique_ptr<PenetratingBossBulletCollider> collider_;
 
-    // id
-    static uint32_t id;
-
     // 調整可能パラメータ
     float rotationSpeedMin_ = -10.0f;  ///< 回転速度の最小値
     float rotationSpeedMax_ = 10.0f;   ///< 回転速度の最大値
-    float yBoundaryMin_ = -10.0f;      ///< Y 座標の下限
-    float yBoundaryMax_ = 50.0f;       ///< Y 座標の上限
 };
@@ -1,15 +1,11 @@
 #pragma once
 
 #include "Projectile.h"
+#include "ProjectileBatch.h"
 #include "../../../GameProject/Collision/CollisionTypeIdDef.h"
 #include <memory>
 #include <string>
 
-namespace  Tako
-{
-    class EmitterManager;
-}
-
 class PlayerBulletCollider;
 
 /// <summary>
@@ -21,15 +17,24 @@ class PlayerBullet : public Projectile {
     // 定数
     //=========================================================================================
 private:
-    static constexpr uint32_t kIdResetThreshold = 10000; ///< ID リセット閾値
     static constexpr float kInitialScale = 0.0f;         ///< 初期スケール（パーティクル描画のため0）
 
 public:
+    /// <summary>
+    /// 一括計算での挙動（回転せずに飛び、範囲外に出たら消える）
+    /// </summary>
+    static constexpr uint32_t kSimulationFlags = ProjectileBatch::kFlagCullBounds;
+
+    /// <summary>
+    /// 軌跡・爆発エフェクトのプリセット名（ProjectileManager がエミッターを用意する）
+    /// </summary>
+    static constexpr const char* kTrailEmitterPreset = "player_bullet";
+    static constexpr const char* kExplodeEmitterPreset = "player_bullet_explode";
+
     /// <summary>
     /// コンストラクタ
     /// </summary>
-    /// <param name="emitterManager">エミッターマネージャー</param>
-    PlayerBullet(Tako::EmitterManager* emitterManager);
+    PlayerBullet();
 
     /// <summary>
     /// デストラクタ
@@ -44,15 +49,9 @@ public:
     void Initialize(const Tako::Vector3& position, const Tako::Vector3& velocity) override;
 
     /// <summary>
-    /// 終了処理
+    /// 終了処理（コライダーの登録解除。弾本体は次の発射で再利用する）
     /// </summary>
-    void Finalize();
-
-    /// <summary>
-    /// 更新
-    /// </summary>
-    /// <param name="deltaTime">前フレームからの経過時間</param>
-    void Update(float deltaTime) override;
+    void Finalize() override;
 
     /// <summary>
     /// コリジョンタイプ ID を取得
@@ -64,14 +63,12 @@ public:
     /// </summary>
     PlayerBulletCollider* GetCollider() const { return collider_.get(); }
 
+    /// <summary>
+    /// 衝突を通知するコライダーを取得
+    /// </summary>
+    Tako::Collider* GetHitCollider() const override;
+
 private:
     // 専用コライダー
     std::unique_ptr<PlayerBulletCollider> collider_;
-
-    // id（複数弾の識別用）
-    static uint32_t id;
-
-    // 調整可能パラメータ
-    float yBoundaryMin_ = -10.0f;  ///< Y 座標の下限
-    float yBoundaryMax_ = 50.0f;   ///< Y 座標の上限
 };
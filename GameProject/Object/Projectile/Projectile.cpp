@@ -1,47 +1,37 @@
 #include "Projectile.h"
 #include "Object3d.h"
 #include "Model.h"
-#include "EmitterManager.h"
 
 using namespace Tako;
 
 Projectile::Projectile() {
+    // モデルは生成時に1度だけ用意し、再利用時はそのまま使う
+    model_ = std::make_unique<Object3d>();
+    model_->Initialize();
 }
 
 Projectile::~Projectile() {
 }
 
 void Projectile::Initialize(const Vector3& position, const Vector3& velocity) {
-    // 位置と速度を設定
+    // 位置と速度を設定（再利用時に前回の回転を持ち越さない）
     transform_.translate = position;
+    transform_.rotate = Vector3(0.0f, 0.0f, 0.0f);
     velocity_ = velocity;
 
-    // モデルの初期化
-    if (!model_) {
-        model_ = std::make_unique<Object3d>();
-        model_->Initialize();
-    }
-
     // モデルに Transform を設定
     model_->SetTransform(transform_);
 
-    // タイマーリセット
-    elapsedTime_ = 0.0f;
-
     // アクティブ化
     isActive_ = true;
 }
 
-void Projectile::Update(float deltaTime) {
-    if (!isActive_) {
-        return;
-    }
-
-    // 生存時間を更新
-    UpdateLifetime(deltaTime);
+void Projectile::Finalize() {
+}
 
-    // 移動処理
-    Move(deltaTime);
+void Projectile::SyncSimulation(const Vector3& position, const Vector3& rotation) {
+    transform_.translate = position;
+    transform_.rotate = rotation;
 
     // モデルの更新
     if (model_) {
@@ -59,22 +49,9 @@ void Projectile::Draw() {
     model_->Draw();
 }
 
-void Projectile::UpdateLifetime(float deltaTime) {
-    elapsedTime_ += deltaTime;
-
-    // 生存時間を超えたら非アクティブ化
-    if (elapsedTime_ >= lifeTime_) {
-        isActive_ = false;
-    }
-}
-
-void Projectile::Move(float deltaTime) {
-    // 速度に基づいて移動
-    transform_.translate += velocity_ * deltaTime;
-}
-
 void Projectile::SetDefaultModel() {
-    if (model_) {
+    // 再利用時は設定済みのモデルをそのまま使う
+    if (model_ && !model_->GetModel()) {
         model_->SetModel("sphere.gltf");
         if (!model_->GetModel()) {
             // sphere モデルがない場合は代替モデルを使用
@@ -82,23 +59,3 @@ void Projectile::SetDefaultModel() {
         }
     }
 }
-
-void Projectile::ActivateBulletEmitter(const Vector3& position) {
-    if (emitterManager_) {
-        emitterManager_->SetEmitterActive(bulletEmitterName_, true);
-        emitterManager_->SetEmitterPosition(bulletEmitterName_, position);
-    }
-}
-
-void Projectile::FinalizeEmitters() {
-    if (emitterManager_) {
-        // 爆発エフェクトを一時的に生成
-        emitterManager_->CreateTemporaryEmitterFrom(
-            explodeEmitterName_,
-            explodeEmitterName_ + "temp",
-            0.5f);
-        // エミッターを削除
-        emitterManager_->RemoveEmitter(bulletEmitterName_);
-        emitterManager_->RemoveEmitter(explodeEmitterName_);
-    }
-}
\ No newline at end of file
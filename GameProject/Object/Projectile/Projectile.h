@@ -3,20 +3,20 @@
 #include "Transform.h"
 #include "Vector3.h"
 #include <memory>
-#include <string>
 
 namespace Tako
 {
     class Object3d;
     class Model;
-    class EmitterManager;
+    class Collider;
 }
 
 
 /// <summary>
 /// プロジェクタイル（弾）基底クラス
-/// 移動と生存時間の管理のみを担当
-/// 衝突判定は派生クラスで実装
+/// 移動・回転・生存時間は ProjectileManager が ProjectileBatch で全種類まとめて計算し、SyncSimulation で反映する
+/// 軌跡・爆発エフェクトのエミッターは ProjectileManager がハンドルで管理する
+/// 衝突時の処理は派生クラスのコライダーで実装（ボスの弾は CollisionManager に登録せず、ProjectileManager::CheckCollisions から通知される）
 /// </summary>
 class Projectile {
 public:
@@ -38,10 +38,16 @@ public:
     virtual void Initialize(const Tako::Vector3& position, const Tako::Vector3& velocity);
 
     /// <summary>
-    /// 更新
+    /// 終了処理（コライダーの登録解除など。弾本体は次の発射で再利用する）
     /// </summary>
-    /// <param name="deltaTime">前フレームからの経過時間</param>
-    virtual void Update(float deltaTime);
+    virtual void Finalize();
+
+    /// <summary>
+    /// 一括計算した位置と回転をモデルに反映
+    /// </summary>
+    /// <param name="position">位置</param>
+    /// <param name="rotation">回転</param>
+    void SyncSimulation(const Tako::Vector3& position, const Tako::Vector3& rotation);
 
     /// <summary>
     /// 描画
@@ -74,9 +80,24 @@ public:
     const Tako::Vector3& GetVelocity() const { return velocity_; }
 
     /// <summary>
-    /// 速度を設定
+    /// 回転速度を取得
+    /// </summary>
+    const Tako::Vector3& GetRotationSpeed() const { return rotationSpeed_; }
+
+    /// <summary>
+    /// 生存時間を取得
+    /// </summary>
+    float GetLifeTime() const { return lifeTime_; }
+
+    /// <summary>
+    /// 当たり判定の半径を取得
     /// </summary>
-    void SetVelocity(const Tako::Vector3& velocity) { velocity_ = velocity; }
+    float GetCollisionRadius() const { return collisionRadius_; }
+
+    /// <summary>
+    /// 衝突を通知するコライダーを取得（当たり判定を持たない弾は nullptr）
+    /// </summary>
+    virtual Tako::Collider* GetHitCollider() const { return nullptr; }
 
     /// <summary>
     /// Transform を取得
@@ -94,34 +115,12 @@ public:
     Tako::Object3d* GetModel() const { return model_.get(); }
 
 protected:
-    /// <summary>
-    /// 生存時間を更新
-    /// </summary>
-    void UpdateLifetime(float deltaTime);
-
-    /// <summary>
-    /// 移動処理
-    /// </summary>
-    virtual void Move(float deltaTime);
-
     /// <summary>
     /// デフォルトモデルを設定
     /// sphere.gltf を試し、なければ white_cube.gltf を使用
     /// </summary>
     void SetDefaultModel();
 
-    /// <summary>
-    /// エミッターを有効化し位置を設定
-    /// </summary>
-    /// <param name="position">エミッターの位置</param>
-    void ActivateBulletEmitter(const Tako::Vector3& position);
-
-    /// <summary>
-    /// エミッター終了処理
-    /// 爆発エフェクトを生成し、エミッターを削除
-    /// </summary>
-    void FinalizeEmitters();
-
 protected:
     /// <summary>
     /// 3D モデルオブジェクト（描画用）
@@ -139,10 +138,15 @@ protected:
     bool isActive_ = false;
 
     /// <summary>
-    /// 速度ベクトル
+    /// 発射時の速度ベクトル
     /// </summary>
     Tako::Vector3 velocity_;
 
+    /// <summary>
+    /// 回転速度（回転しない弾では使わない）
+    /// </summary>
+    Tako::Vector3 rotationSpeed_;
+
     /// <summary>
     /// ダメージ量
     /// </summary>
@@ -154,22 +158,7 @@ protected:
     float lifeTime_ = 5.0f;
 
     /// <summary>
-    /// 経過時間
-    /// </summary>
-    float elapsedTime_ = 0.0f;
-
-    /// <summary>
-    /// エミッターマネージャーへのポインタ
-    /// </summary>
-    Tako::EmitterManager* emitterManager_ = nullptr;
-
-    /// <summary>
-    /// 弾丸エミッター名
-    /// </summary>
-    std::string bulletEmitterName_;
-
-    /// <summary>
-    /// 爆発エミッター名
+    /// 当たり判定の半径
     /// </summary>
-    std::string explodeEmitterName_;
+    float collisionRadius_ = 0.5f;
 };
\ No newline at end of file
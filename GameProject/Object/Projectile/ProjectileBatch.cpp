@@ -0,0 +1,339 @@
+#include "ProjectileBatch.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX__)
+#define PROJECTILE_BATCH_AVX
+#include <immintrin.h>
+#elif defined(_M_X64) || defined(__SSE2__)
+#define PROJECTILE_BATCH_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace Tako;
+
+namespace {
+    // 配列の容量を切り上げる単位（AVX の1レジスタ分。SSE・スカラーでもこの幅で確保する）
+    constexpr uint32_t kLaneWidth = 8;
+
+    uint32_t RoundUpToLane(uint32_t value) {
+        return (value + kLaneWidth - 1) / kLaneWidth * kLaneWidth;
+    }
+}
+
+void ProjectileBatch::Initialize(uint32_t capacity, const Bounds& bounds) {
+    const uint32_t padded = RoundUpToLane(capacity);
+    for (auto* array : { &posX_, &posY_, &posZ_, &velX_, &velY_, &velZ_,
+                         &rotX_, &rotY_, &rotZ_, &rotSpeedX_, &rotSpeedY_, &rotSpeedZ_, &radius_ }) {
+        array->assign(padded, 0.0f);
+    }
+    // 端数のレーンは範囲外判定・当たり判定をしない
+    cullMask_.assign(padded, 0u);
+    hostileMask_.assign(padded, 0u);
+    flags_.assign(padded, kFlagNone);
+    ids_.assign(padded, 0u);
+
+    indices_.assign(capacity, kInvalidIndex);
+    expired_.clear();
+    expired_.reserve(capacity);
+
+    count_ = 0;
+    bounds_ = bounds;
+}
+
+bool ProjectileBatch::Add(uint32_t id, const Vector3& position, const Vector3& velocity,
+                          const Vector3& rotationSpeed, uint32_t flags, float radius) {
+    if (id >= indices_.size() || indices_[id] != kInvalidIndex) {
+        return false;
+    }
+
+    const uint32_t index = count_++;
+    posX_[index] = position.x;
+    posY_[index] = position.y;
+    posZ_[index] = position.z;
+    velX_[index] = velocity.x;
+    velY_[index] = velocity.y;
+    velZ_[index] = velocity.z;
+    rotX_[index] = 0.0f;
+    rotY_[index] = 0.0f;
+    rotZ_[index] = 0.0f;
+
+    // 回転しない弾は回転速度 0 として同じ計算に乗せる
+    const bool rotate = (flags & kFlagRotate) != 0;
+    rotSpeedX_[index] = rotate ? rotationSpeed.x : 0.0f;
+    rotSpeedY_[index] = rotate ? rotationSpeed.y : 0.0f;
+    rotSpeedZ_[index] = rotate ? rotationSpeed.z : 0.0f;
+
+    radius_[index] = radius;
+    cullMask_[index] = (flags & kFlagCullBounds) ? 0xFFFFFFFFu : 0u;
+    hostileMask_[index] = (flags & kFlagHostile) ? 0xFFFFFFFFu : 0u;
+    flags_[index] = flags;
+    ids_[index] = id;
+    indices_[id] = index;
+    return true;
+}
+
+void ProjectileBatch::Remove(uint32_t id) {
+    const uint32_t index = FindIndex(id);
+    if (index == kInvalidIndex) {
+        return;
+    }
+
+    // 末尾の弾で穴を埋めて先頭に詰めた状態を保つ
+    const uint32_t last = count_ - 1;
+    if (index != last) {
+        MoveElement(last, index);
+    }
+    indices_[id] = kInvalidIndex;
+    --count_;
+}
+
+void ProjectileBatch::Clear() {
+    for (uint32_t i = 0; i < count_; ++i) {
+        indices_[ids_[i]] = kInvalidIndex;
+    }
+    count_ = 0;
+    expired_.clear();
+}
+
+void ProjectileBatch::Integrate(float deltaTime) {
+    expired_.clear();
+
+#if defined(PROJECTILE_BATCH_AVX)
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 minX = _mm256_set1_ps(bounds_.min.x);
+    const __m256 minY = _mm256_set1_ps(bounds_.min.y);
+    const __m256 minZ = _mm256_set1_ps(bounds_.min.z);
+    const __m256 maxX = _mm256_set1_ps(bounds_.max.x);
+    const __m256 maxY = _mm256_set1_ps(bounds_.max.y);
+    const __m256 maxZ = _mm256_set1_ps(bounds_.max.z);
+
+    for (uint32_t i = 0; i < count_; i += 8) {
+        // 移動
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(&posX_[i]), _mm256_mul_ps(_mm256_loadu_ps(&velX_[i]), dt));
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(&posY_[i]), _mm256_mul_ps(_mm256_loadu_ps(&velY_[i]), dt));
+        __m256 z = _mm256_add_ps(_mm256_loadu_ps(&posZ_[i]), _mm256_mul_ps(_mm256_loadu_ps(&velZ_[i]), dt));
+        _mm256_storeu_ps(&posX_[i], x);
+        _mm256_storeu_ps(&posY_[i], y);
+        _mm256_storeu_ps(&posZ_[i], z);
+
+        // 回転
+        _mm256_storeu_ps(&rotX_[i], _mm256_add_ps(_mm256_loadu_ps(&rotX_[i]), _mm256_mul_ps(_mm256_loadu_ps(&rotSpeedX_[i]), dt)));
+        _mm256_storeu_ps(&rotY_[i], _mm256_add_ps(_mm256_loadu_ps(&rotY_[i]), _mm256_mul_ps(_mm256_loadu_ps(&rotSpeedY_[i]), dt)));
+        _mm256_storeu_ps(&rotZ_[i], _mm256_add_ps(_mm256_loadu_ps(&rotZ_[i]), _mm256_mul_ps(_mm256_loadu_ps(&rotSpeedZ_[i]), dt)));
+
+        // 範囲外（kFlagCullBounds の弾のみ）
+        __m256 outside = _mm256_or_ps(
+            _mm256_or_ps(_mm256_cmp_ps(x, minX, _CMP_LT_OQ), _mm256_cmp_ps(x, maxX, _CMP_GT_OQ)),
+            _mm256_or_ps(
+                _mm256_or_ps(_mm256_cmp_ps(y, minY, _CMP_LT_OQ), _mm256_cmp_ps(y, maxY, _CMP_GT_OQ)),
+                _mm256_or_ps(_mm256_cmp_ps(z, minZ, _CMP_LT_OQ), _mm256_cmp_ps(z, maxZ, _CMP_GT_OQ))));
+        __m256 expired = _mm256_and_ps(outside, _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&cullMask_[i]))));
+
+        // 有効なレーンだけを見る
+        uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(expired));
+        if (count_ - i < 8) {
+            bits &= (1u << (count_ - i)) - 1u;
+        }
+        while (bits) {
+            expired_.push_back(ids_[i + std::countr_zero(bits)]);
+            bits &= bits - 1u;
+        }
+    }
+#elif defined(PROJECTILE_BATCH_SSE)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 minX = _mm_set1_ps(bounds_.min.x);
+    const __m128 minY = _mm_set1_ps(bounds_.min.y);
+    const __m128 minZ = _mm_set1_ps(bounds_.min.z);
+    const __m128 maxX = _mm_set1_ps(bounds_.max.x);
+    const __m128 maxY = _mm_set1_ps(bounds_.max.y);
+    const __m128 maxZ = _mm_set1_ps(bounds_.max.z);
+
+    for (uint32_t i = 0; i < count_; i += 4) {
+        // 移動
+        __m128 x = _mm_add_ps(_mm_loadu_ps(&posX_[i]), _mm_mul_ps(_mm_loadu_ps(&velX_[i]), dt));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(&posY_[i]), _mm_mul_ps(_mm_loadu_ps(&velY_[i]), dt));
+        __m128 z = _mm_add_ps(_mm_loadu_ps(&posZ_[i]), _mm_mul_ps(_mm_loadu_ps(&velZ_[i]), dt));
+        _mm_storeu_ps(&posX_[i], x);
+        _mm_storeu_ps(&posY_[i], y);
+        _mm_storeu_ps(&posZ_[i], z);
+
+        // 回転
+        _mm_storeu_ps(&rotX_[i], _mm_add_ps(_mm_loadu_ps(&rotX_[i]), _mm_mul_ps(_mm_loadu_ps(&rotSpeedX_[i]), dt)));
+        _mm_storeu_ps(&rotY_[i], _mm_add_ps(_mm_loadu_ps(&rotY_[i]), _mm_mul_ps(_mm_loadu_ps(&rotSpeedY_[i]), dt)));
+        _mm_storeu_ps(&rotZ_[i], _mm_add_ps(_mm_loadu_ps(&rotZ_[i]), _mm_mul_ps(_mm_loadu_ps(&rotSpeedZ_[i]), dt)));
+
+        // 範囲外（kFlagCullBounds の弾のみ）
+        __m128 outside = _mm_or_ps(
+            _mm_or_ps(_mm_cmplt_ps(x, minX), _mm_cmpgt_ps(x, maxX)),
+            _mm_or_ps(
+                _mm_or_ps(_mm_cmplt_ps(y, minY), _mm_cmpgt_ps(y, maxY)),
+                _mm_or_ps(_mm_cmplt_ps(z, minZ), _mm_cmpgt_ps(z, maxZ))));
+        __m128 expired = _mm_and_ps(outside, _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&cullMask_[i]))));
+
+        // 有効なレーンだけを見る
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(expired));
+        if (count_ - i < 4) {
+            bits &= (1u << (count_ - i)) - 1u;
+        }
+        while (bits) {
+            expired_.push_back(ids_[i + std::countr_zero(bits)]);
+            bits &= bits - 1u;
+        }
+    }
+#else
+    for (uint32_t i = 0; i < count_; ++i) {
+        posX_[i] += velX_[i] * deltaTime;
+        posY_[i] += velY_[i] * deltaTime;
+        posZ_[i] += velZ_[i] * deltaTime;
+        rotX_[i] += rotSpeedX_[i] * deltaTime;
+        rotY_[i] += rotSpeedY_[i] * deltaTime;
+        rotZ_[i] += rotSpeedZ_[i] * deltaTime;
+
+        bool outside =
+            posX_[i] < bounds_.min.x || posX_[i] > bounds_.max.x ||
+            posY_[i] < bounds_.min.y || posY_[i] > bounds_.max.y ||
+            posZ_[i] < bounds_.min.z || posZ_[i] > bounds_.max.z;
+        if (outside && cullMask_[i] != 0) {
+            expired_.push_back(ids_[i]);
+        }
+    }
+#endif
+}
+
+void ProjectileBatch::QueryHostile(const QueryShape& shape, std::vector<uint32_t>& outIds) const {
+    // 中心からの差を形状の各軸に射影し、箱からはみ出した分の二乗和を（弾の半径 + 形状の半径）の二乗と比べる
+#if defined(PROJECTILE_BATCH_AVX)
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 cx = _mm256_set1_ps(shape.center.x);
+    const __m256 cy = _mm256_set1_ps(shape.center.y);
+    const __m256 cz = _mm256_set1_ps(shape.center.z);
+    const __m256 shapeRadius = _mm256_set1_ps(shape.radius);
+    const float halfExtents[3] = { shape.halfExtents.x, shape.halfExtents.y, shape.halfExtents.z };
+    __m256 ax[3], ay[3], az[3], h[3];
+    for (int k = 0; k < 3; ++k) {
+        ax[k] = _mm256_set1_ps(shape.axes[k].x);
+        ay[k] = _mm256_set1_ps(shape.axes[k].y);
+        az[k] = _mm256_set1_ps(shape.axes[k].z);
+        h[k] = _mm256_set1_ps(halfExtents[k]);
+    }
+
+    for (uint32_t i = 0; i < count_; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&posX_[i]), cx);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&posY_[i]), cy);
+        __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(&posZ_[i]), cz);
+
+        __m256 distanceSq = zero;
+        for (int k = 0; k < 3; ++k) {
+            __m256 projection = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, ax[k]), _mm256_mul_ps(dy, ay[k])), _mm256_mul_ps(dz, az[k]));
+            __m256 excess = _mm256_max_ps(_mm256_sub_ps(_mm256_andnot_ps(signMask, projection), h[k]), zero);
+            distanceSq = _mm256_add_ps(distanceSq, _mm256_mul_ps(excess, excess));
+        }
+        __m256 radius = _mm256_add_ps(_mm256_loadu_ps(&radius_[i]), shapeRadius);
+        __m256 hit = _mm256_and_ps(_mm256_cmp_ps(distanceSq, _mm256_mul_ps(radius, radius), _CMP_LE_OQ),
+                                   _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&hostileMask_[i]))));
+
+        // 有効なレーンだけを見る
+        uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(hit));
+        if (count_ - i < 8) {
+            bits &= (1u << (count_ - i)) - 1u;
+        }
+        while (bits) {
+            outIds.push_back(ids_[i + std::countr_zero(bits)]);
+            bits &= bits - 1u;
+        }
+    }
+#elif defined(PROJECTILE_BATCH_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 cx = _mm_set1_ps(shape.center.x);
+    const __m128 cy = _mm_set1_ps(shape.center.y);
+    const __m128 cz = _mm_set1_ps(shape.center.z);
+    const __m128 shapeRadius = _mm_set1_ps(shape.radius);
+    const float halfExtents[3] = { shape.halfExtents.x, shape.halfExtents.y, shape.halfExtents.z };
+    __m128 ax[3], ay[3], az[3], h[3];
+    for (int k = 0; k < 3; ++k) {
+        ax[k] = _mm_set1_ps(shape.axes[k].x);
+        ay[k] = _mm_set1_ps(shape.axes[k].y);
+        az[k] = _mm_set1_ps(shape.axes[k].z);
+        h[k] = _mm_set1_ps(halfExtents[k]);
+    }
+
+    for (uint32_t i = 0; i < count_; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&posX_[i]), cx);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&posY_[i]), cy);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(&posZ_[i]), cz);
+
+        __m128 distanceSq = zero;
+        for (int k = 0; k < 3; ++k) {
+            __m128 projection = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, ax[k]), _mm_mul_ps(dy, ay[k])), _mm_mul_ps(dz, az[k]));
+            __m128 excess = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signMask, projection), h[k]), zero);
+            distanceSq = _mm_add_ps(distanceSq, _mm_mul_ps(excess, excess));
+        }
+        __m128 radius = _mm_add_ps(_mm_loadu_ps(&radius_[i]), shapeRadius);
+        __m128 hit = _mm_and_ps(_mm_cmple_ps(distanceSq, _mm_mul_ps(radius, radius)),
+                                _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&hostileMask_[i]))));
+
+        // 有効なレーンだけを見る
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(hit));
+        if (count_ - i < 4) {
+            bits &= (1u << (count_ - i)) - 1u;
+        }
+        while (bits) {
+            outIds.push_back(ids_[i + std::countr_zero(bits)]);
+            bits &= bits - 1u;
+        }
+    }
+#else
+    const float halfExtents[3] = { shape.halfExtents.x, shape.halfExtents.y, shape.halfExtents.z };
+    for (uint32_t i = 0; i < count_; ++i) {
+        if (hostileMask_[i] == 0) {
+            continue;
+        }
+        Vector3 d = { posX_[i] - shape.center.x, posY_[i] - shape.center.y, posZ_[i] - shape.center.z };
+        float distanceSq = 0.0f;
+        for (int k = 0; k < 3; ++k) {
+            float projection = d.x * shape.axes[k].x + d.y * shape.axes[k].y + d.z * shape.axes[k].z;
+            float excess = std::max(std::abs(projection) - halfExtents[k], 0.0f);
+            distanceSq += excess * excess;
+        }
+        float radius = radius_[i] + shape.radius;
+        if (distanceSq <= radius * radius) {
+            outIds.push_back(ids_[i]);
+        }
+    }
+#endif
+}
+
+const char* ProjectileBatch::GetInstructionSetName() {
+#if defined(PROJECTILE_BATCH_AVX)
+    return "AVX";
+#elif defined(PROJECTILE_BATCH_SSE)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+void ProjectileBatch::MoveElement(uint32_t from, uint32_t to) {
+    posX_[to] = posX_[from];
+    posY_[to] = posY_[from];
+    posZ_[to] = posZ_[from];
+    velX_[to] = velX_[from];
+    velY_[to] = velY_[from];
+    velZ_[to] = velZ_[from];
+    rotX_[to] = rotX_[from];
+    rotY_[to] = rotY_[from];
+    rotZ_[to] = rotZ_[from];
+    rotSpeedX_[to] = rotSpeedX_[from];
+    rotSpeedY_[to] = rotSpeedY_[from];
+    rotSpeedZ_[to] = rotSpeedZ_[from];
+    radius_[to] = radius_[from];
+    cullMask_[to] = cullMask_[from];
+    hostileMask_[to] = hostileMask_[from];
+    flags_[to] = flags_[from];
+    ids_[to] = ids_[from];
+    indices_[ids_[to]] = to;
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "Vector3.h"
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 弾の移動・範囲外判定をまとめて行うデータ指向のシミュレーション
+/// 寿命は毎フレーム確認せず、呼び出し側が TimingWheel で期限を管理する
+/// 位置・速度・回転などを要素ごとの配列（SoA）で持ち、生存中の弾を先頭に詰めて
+/// SIMD（AVX / SSE、使えなければスカラー）で全弾を一括更新する
+/// 弾の種類ごとの挙動の違いは仮想関数ではなく Flags で表す
+/// 当たり判定も同じ位置の配列に対して QueryHostile で一括に行い、CollisionManager には登録しない
+/// </summary>
+class ProjectileBatch {
+public:
+    /// <summary>
+    /// 弾ごとの挙動フラグ
+    /// </summary>
+    enum Flags : uint32_t {
+        kFlagNone = 0,
+        kFlagRotate = 1u << 0,      // 回転速度に従って回転する
+        kFlagCullBounds = 1u << 1,  // 範囲外に出たら消滅する
+        kFlagHostile = 1u << 2,     // プレイヤー側に当たる（QueryHostile の対象）
+    };
+
+    /// <summary>
+    /// 範囲外判定に使う領域
+    /// </summary>
+    struct Bounds {
+        Tako::Vector3 min;
+        Tako::Vector3 max;
+    };
+
+    /// <summary>
+    /// 当たり判定の形状（球は半径だけを持つ大きさ 0 の箱として扱う）
+    /// 軸は正規直交であること
+    /// </summary>
+    struct QueryShape {
+        Tako::Vector3 center;
+        Tako::Vector3 axes[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+        Tako::Vector3 halfExtents;
+        float radius = 0.0f;
+
+        /// <summary>
+        /// 球
+        /// </summary>
+        static QueryShape Sphere(const Tako::Vector3& center, float radius) {
+            QueryShape shape;
+            shape.center = center;
+            shape.radius = radius;
+            return shape;
+        }
+    };
+
+    /// <summary>
+    /// 未登録を示すインデックス
+    /// </summary>
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    /// <summary>
+    /// 初期化（配列を容量分確保する。以後の追加・削除では確保しない）
+    /// </summary>
+    /// <param name="capacity">同時に扱える弾の数</param>
+    /// <param name="bounds">範囲外判定の領域</param>
+    void Initialize(uint32_t capacity, const Bounds& bounds);
+
+    /// <summary>
+    /// 弾を追加
+    /// </summary>
+    /// <param name="id">呼び出し側の識別番号（0 ～ 容量-1）</param>
+    /// <param name="position">初期位置</param>
+    /// <param name="velocity">速度</param>
+    /// <param name="rotationSpeed">回転速度（kFlagRotate が無ければ無視）</param>
+    /// <param name="flags">挙動フラグ</param>
+    /// <param name="radius">当たり判定の半径</param>
+    /// <returns>追加できたら true</returns>
+    bool Add(uint32_t id, const Tako::Vector3& position, const Tako::Vector3& velocity,
+             const Tako::Vector3& rotationSpeed, uint32_t flags, float radius = 0.0f);
+
+    /// <summary>
+    /// 弾を削除（末尾の弾を空いた位置に移すため順序は保たない）
+    /// </summary>
+    /// <param name="id">識別番号</param>
+    void Remove(uint32_t id);
+
+    /// <summary>
+    /// 全弾の削除
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 全弾を1ステップ進め、範囲外になった弾の識別番号を GetExpired に集める
+    /// （消滅した弾は削除しないので、呼び出し側で後処理をしてから Remove する）
+    /// </summary>
+    /// <param name="deltaTime">経過時間</param>
+    void Integrate(float deltaTime);
+
+    /// <summary>
+    /// kFlagHostile の弾のうち、形状に重なる弾の識別番号を集める（弾の半径を含めて判定する）
+    /// </summary>
+    /// <param name="shape">判定する形状</param>
+    /// <param name="outIds">重なった弾の識別番号の追加先（クリアはしない）</param>
+    void QueryHostile(const QueryShape& shape, std::vector<uint32_t>& outIds) const;
+
+    /// <summary>
+    /// 直前の Integrate で消滅した弾の識別番号
+    /// </summary>
+    const std::vector<uint32_t>& GetExpired() const { return expired_; }
+
+    /// <summary>
+    /// 生存中の弾の数
+    /// </summary>
+    uint32_t GetCount() const { return count_; }
+
+    /// <summary>
+    /// 容量
+    /// </summary>
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(indices_.size()); }
+
+    /// <summary>
+    /// 詰めた配列上の位置から識別番号を取得
+    /// </summary>
+    uint32_t GetId(uint32_t index) const { return ids_[index]; }
+
+    /// <summary>
+    /// 識別番号から詰めた配列上の位置を取得
+    /// </summary>
+    /// <returns>位置（未登録なら kInvalidIndex）</returns>
+    uint32_t FindIndex(uint32_t id) const { return id < indices_.size() ? indices_[id] : kInvalidIndex; }
+
+    /// <summary>
+    /// 位置を取得
+    /// </summary>
+    Tako::Vector3 GetPosition(uint32_t index) const { return { posX_[index], posY_[index], posZ_[index] }; }
+
+    /// <summary>
+    /// 回転を取得
+    /// </summary>
+    Tako::Vector3 GetRotation(uint32_t index) const { return { rotX_[index], rotY_[index], rotZ_[index] }; }
+
+    /// <summary>
+    /// 当たり判定の半径を取得
+    /// </summary>
+    float GetRadius(uint32_t index) const { return radius_[index]; }
+
+    /// <summary>
+    /// 位置の配列（先頭 GetCount 個が有効。衝突判定などの一括処理用）
+    /// </summary>
+    const float* GetPositionsX() const { return posX_.data(); }
+    const float* GetPositionsY() const { return posY_.data(); }
+    const float* GetPositionsZ() const { return posZ_.data(); }
+
+    /// <summary>
+    /// 一括更新に使う命令セット名
+    /// </summary>
+    static const char* GetInstructionSetName();
+
+private:
+    /// <summary>
+    /// 詰めた配列上の要素を別の位置へ移す
+    /// </summary>
+    void MoveElement(uint32_t from, uint32_t to);
+
+    // 要素ごとの配列（容量を SIMD 幅に切り上げて確保し、端数のレーンは結果を捨てる）
+    std::vector<float> posX_, posY_, posZ_;
+    std::vector<float> velX_, velY_, velZ_;
+    std::vector<float> rotX_, rotY_, rotZ_;
+    std::vector<float> rotSpeedX_, rotSpeedY_, rotSpeedZ_;
+    std::vector<float> radius_;
+    std::vector<uint32_t> cullMask_;    // kFlagCullBounds なら全ビット 1
+    std::vector<uint32_t> hostileMask_; // kFlagHostile なら全ビット 1
+    std::vector<uint32_t> flags_;
+    std::vector<uint32_t> ids_;
+
+    // 識別番号 → 詰めた配列上の位置
+    std::vector<uint32_t> indices_;
+
+    // 消滅した弾の識別番号
+    std::vector<uint32_t> expired_;
+
+    uint32_t count_ = 0;
+    Bounds bounds_{};
+};
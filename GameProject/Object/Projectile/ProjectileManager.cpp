@@ -0,0 +1,281 @@
+#include "ProjectileManager.h"
+#include "BossBullet.h"
+#include "PenetratingBossBullet.h"
+#include "PlayerBullet.h"
+#include "../../Common/GameConst.h"
+#include "../../Collision/MeleeAttackCollider.h"
+#include "OBBCollider.h"
+#include <algorithm>
+
+using namespace Tako;
+
+namespace {
+    constexpr std::array<const char*, static_cast<size_t>(ProjectileKind::Count)> kKindNames = {
+        "BossBullet", "PenetratingBossBullet", "PlayerBullet"
+    };
+}
+
+void ProjectileManager::Initialize(EmitterManager* emitterManager) {
+    emitterManager_ = emitterManager;
+
+    slots_.clear();
+    slotKinds_.clear();
+    trailHandles_.clear();
+    explodeHandles_.clear();
+    lifetimeHandles_.clear();
+
+    // 弾幕中に生成・破棄を繰り返さないよう、上限分を先に確保しておく
+    RegisterKind<BossBullet>(ProjectileKind::BossBullet, GameConst::kBossBulletPoolSize);
+    RegisterKind<PenetratingBossBullet>(ProjectileKind::PenetratingBossBullet, GameConst::kPenetratingBossBulletPoolSize);
+    RegisterKind<PlayerBullet>(ProjectileKind::PlayerBullet, GameConst::kPlayerBulletPoolSize);
+
+    // 全種類の弾を1つの一括計算にまとめる
+    uint32_t capacity = static_cast<uint32_t>(slots_.size());
+    ProjectileBatch::Bounds bounds{
+        { GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin },
+        { GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax }
+    };
+    batch_.Initialize(capacity, bounds);
+    lifetimeTimers_.Initialize(capacity, GameConst::kSimulationTickSeconds);
+    lifetimeHandles_.assign(capacity, kInvalidTimerHandle);
+    retired_.clear();
+    retired_.reserve(capacity);
+    lifetimeExpired_.clear();
+    lifetimeExpired_.reserve(capacity);
+    hitSlots_.clear();
+    hitSlots_.reserve(capacity);
+}
+
+template<typename T>
+void ProjectileManager::RegisterKind(ProjectileKind kind, uint32_t capacity) {
+    KindData& data = kinds_[static_cast<size_t>(kind)];
+    data.firstSlot = static_cast<uint32_t>(slots_.size());
+    data.simulationFlags = T::kSimulationFlags;
+
+    for (uint32_t i = 0; i < capacity; ++i) {
+        slots_.push_back(std::make_unique<T>());
+        slotKinds_.push_back(kind);
+    }
+    trailHandles_.resize(slots_.size(), kInvalidEmitterHandle);
+    explodeHandles_.resize(slots_.size(), kInvalidEmitterHandle);
+
+    data.trailEmitters.Initialize(emitterManager_, T::kTrailEmitterPreset, capacity);
+    data.explodeEmitters.Initialize(emitterManager_, T::kExplodeEmitterPreset, capacity);
+
+    data.freeList.resize(capacity);
+    for (uint32_t i = 0; i < capacity; ++i) {
+        data.freeList[i] = data.firstSlot + i;
+    }
+    data.freeHead = 0;
+    data.freeCount = capacity;
+
+    data.stats = {};
+    data.stats.capacity = capacity;
+}
+
+void ProjectileManager::Finalize() {
+    ReleaseAll();
+    for (KindData& data : kinds_) {
+        data.trailEmitters.Finalize();
+        data.explodeEmitters.Finalize();
+        data.freeList.clear();
+        data.freeHead = 0;
+        data.freeCount = 0;
+        data.stats.capacity = 0;
+    }
+    slots_.clear();
+    slotKinds_.clear();
+    trailHandles_.clear();
+    explodeHandles_.clear();
+    lifetimeHandles_.clear();
+    lifetimeTimers_.Clear();
+}
+
+Projectile* ProjectileManager::Spawn(ProjectileKind kind, const Vector3& position, const Vector3& velocity) {
+    KindData& data = kinds_[static_cast<size_t>(kind)];
+    if (data.freeCount == 0) {
+        ++data.stats.exhaustCount;
+        return nullptr;
+    }
+
+    uint32_t slot = data.freeList[data.freeHead];
+    data.freeHead = (data.freeHead + 1) % data.stats.capacity;
+    --data.freeCount;
+
+    // 弾本体の初期化（ダメージ・寿命・回転速度が決まる）後に一括計算と寿命の期限に登録
+    Projectile* projectile = slots_[slot].get();
+    projectile->Initialize(position, velocity);
+    batch_.Add(slot, position, velocity, projectile->GetRotationSpeed(), data.simulationFlags, projectile->GetCollisionRadius());
+    lifetimeHandles_[slot] = lifetimeTimers_.ScheduleSeconds(projectile->GetLifeTime(), slot);
+
+    // 軌跡エフェクトを有効化（位置は Update でほかの弾とまとめて送る）
+    trailHandles_[slot] = data.trailEmitters.Acquire();
+    explodeHandles_[slot] = data.explodeEmitters.Acquire();
+    data.trailEmitters.SetActive(trailHandles_[slot], true);
+
+    ++data.stats.acquireCount;
+    ++data.stats.activeCount;
+    data.stats.highWater = std::max(data.stats.highWater, data.stats.activeCount);
+    return projectile;
+}
+
+void ProjectileManager::SpawnBatch(ProjectileKind kind, std::span<const BulletSpawnRequest> requests) {
+    KindData& data = kinds_[static_cast<size_t>(kind)];
+    size_t spawnCount = std::min<size_t>(requests.size(), data.freeCount);
+    for (size_t i = 0; i < spawnCount; ++i) {
+        Spawn(kind, requests[i].position, requests[i].velocity);
+    }
+    data.stats.exhaustCount += requests.size() - spawnCount;
+}
+
+void ProjectileManager::Update(float deltaTime) {
+    // 衝突などで前フレームに非アクティブになった弾を返す
+    retired_.clear();
+    for (uint32_t i = 0; i < batch_.GetCount(); ++i) {
+        uint32_t slot = batch_.GetId(i);
+        if (!slots_[slot]->IsActive()) {
+            retired_.push_back(slot);
+        }
+    }
+    for (uint32_t slot : retired_) {
+        Release(slot);
+    }
+
+    // 全種類の弾の移動・回転・範囲外判定をまとめて計算
+    batch_.Integrate(deltaTime);
+
+    // 寿命の期限が来た弾だけを受け取る
+    lifetimeExpired_.clear();
+    for (uint64_t slot : lifetimeTimers_.Advance(deltaTime)) {
+        lifetimeHandles_[slot] = kInvalidTimerHandle;
+        lifetimeExpired_.push_back(static_cast<uint32_t>(slot));
+    }
+
+    // 結果をモデルに反映し、軌跡エフェクトの位置を種類ごとのエミッターに積む
+    for (uint32_t i = 0; i < batch_.GetCount(); ++i) {
+        uint32_t slot = batch_.GetId(i);
+        Vector3 position = batch_.GetPosition(i);
+        slots_[slot]->SyncSimulation(position, batch_.GetRotation(i));
+        kinds_[static_cast<size_t>(slotKinds_[slot])].trailEmitters.SubmitPosition(trailHandles_[slot], position);
+    }
+    for (KindData& data : kinds_) {
+        data.trailEmitters.Flush();
+    }
+
+    // 範囲外・寿命切れの弾を返す（同じフレームに両方に入った弾は1度だけ返す）
+    for (uint32_t slot : batch_.GetExpired()) {
+        slots_[slot]->SetActive(false);
+        Release(slot);
+    }
+    for (uint32_t slot : lifetimeExpired_) {
+        if (batch_.FindIndex(slot) != ProjectileBatch::kInvalidIndex) {
+            slots_[slot]->SetActive(false);
+            Release(slot);
+        }
+    }
+}
+
+void ProjectileManager::CheckCollisions(OBBCollider* playerBody, MeleeAttackCollider* meleeAttack) {
+    // プレイヤー本体とボスの弾（体のコライダーは回転させないので軸はワールドの軸のまま）
+    if (playerBody && playerBody->IsActive()) {
+        ProjectileBatch::QueryShape shape;
+        shape.center = playerBody->GetCenter();
+        shape.halfExtents = playerBody->GetSize() * 0.5f;
+
+        hitSlots_.clear();
+        batch_.QueryHostile(shape, hitSlots_);
+        for (uint32_t slot : hitSlots_) {
+            NotifyHit(slot, playerBody);
+        }
+    }
+
+    // 近接攻撃とボスの弾（攻撃のコライダーはプレイヤーの向きに回すので、向きの行列の行を軸に使う）
+    if (meleeAttack && meleeAttack->IsActive()) {
+        ProjectileBatch::QueryShape shape;
+        shape.center = meleeAttack->GetCenter();
+        const Matrix4x4& orientation = meleeAttack->GetOrientation();
+        for (int k = 0; k < 3; ++k) {
+            shape.axes[k] = { orientation.m[k][0], orientation.m[k][1], orientation.m[k][2] };
+        }
+        shape.halfExtents = meleeAttack->GetSize() * 0.5f;
+
+        hitSlots_.clear();
+        batch_.QueryHostile(shape, hitSlots_);
+        for (uint32_t slot : hitSlots_) {
+            NotifyHit(slot, meleeAttack);
+        }
+    }
+
+    // プレイヤーの弾とボスの弾（プレイヤーの弾は少ないので、1発ごとにボスの弾の配列をまとめて判定する）
+    // 通知中は弾を非アクティブにするだけで一括計算からは外さないので、走査中に並びは変わらない
+    for (uint32_t i = 0; i < batch_.GetCount(); ++i) {
+        uint32_t slot = batch_.GetId(i);
+        if (slotKinds_[slot] != ProjectileKind::PlayerBullet) {
+            continue;
+        }
+
+        hitSlots_.clear();
+        batch_.QueryHostile(ProjectileBatch::QueryShape::Sphere(batch_.GetPosition(i), batch_.GetRadius(i)), hitSlots_);
+        for (uint32_t hitSlot : hitSlots_) {
+            NotifyHit(hitSlot, slots_[slot]->GetHitCollider());
+        }
+    }
+}
+
+void ProjectileManager::ReleaseAll() {
+    while (batch_.GetCount() > 0) {
+        uint32_t slot = batch_.GetId(batch_.GetCount() - 1);
+        slots_[slot]->SetActive(false);
+        Release(slot);
+    }
+}
+
+uint64_t ProjectileManager::GetExhaustCount() const {
+    uint64_t count = 0;
+    for (const KindData& data : kinds_) {
+        count += data.stats.exhaustCount;
+    }
+    return count;
+}
+
+const char* ProjectileManager::GetKindName(ProjectileKind kind) {
+    size_t index = static_cast<size_t>(kind);
+    return index < kKindNames.size() ? kKindNames[index] : "Unknown";
+}
+
+void ProjectileManager::Release(uint32_t slot) {
+    KindData& data = kinds_[static_cast<size_t>(slotKinds_[slot])];
+
+    // コライダーの登録解除
+    Projectile* projectile = slots_[slot].get();
+    projectile->Finalize();
+
+    // 爆発エフェクトを生成し、エミッターのハンドルを返す
+    data.explodeEmitters.SpawnTemporary(explodeHandles_[slot], projectile->GetTransform().translate, kExplodeDuration);
+    data.trailEmitters.Release(trailHandles_[slot]);
+    data.explodeEmitters.Release(explodeHandles_[slot]);
+    trailHandles_[slot] = kInvalidEmitterHandle;
+    explodeHandles_[slot] = kInvalidEmitterHandle;
+
+    // 寿命の期限を取り消す（期限で返す場合は発火済み）
+    lifetimeTimers_.Cancel(lifetimeHandles_[slot]);
+    lifetimeHandles_[slot] = kInvalidTimerHandle;
+
+    // 一括計算から外す（末尾の弾を空いた位置に移す）
+    batch_.Remove(slot);
+
+    data.freeList[(data.freeHead + data.freeCount) % data.stats.capacity] = slot;
+    ++data.freeCount;
+    --data.stats.activeCount;
+}
+
+void ProjectileManager::NotifyHit(uint32_t slot, Collider* other) {
+    // このフレームに非アクティブになった弾も CollisionManager と同じく通知する（各コライダーが所有者の状態を見て無視する）
+    Collider* collider = slots_[slot]->GetHitCollider();
+    if (!collider || !other) {
+        return;
+    }
+
+    collider->OnCollisionEnter(other);
+    other->OnCollisionEnter(collider);
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Projectile.h"
+#include "ProjectileBatch.h"
+#include "../../Common/BulletSpawnRequest.h"
+#include "../../Effect/EmitterHandlePool.h"
+#include "../../Common/TimingWheel.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Tako
+{
+    class EmitterManager;
+    class Collider;
+    class OBBCollider;
+}
+
+class MeleeAttackCollider;
+
+/// <summary>
+/// 弾の種類
+/// </summary>
+enum class ProjectileKind : uint8_t {
+    BossBullet,             // ボスの弾
+    PenetratingBossBullet,  // ボスの貫通弾
+    PlayerBullet,           // プレイヤーの弾
+    Count
+};
+
+/// <summary>
+/// 全種類の弾をまとめて管理するマネージャー
+/// 弾本体・モデル・コライダー・エミッターは種類ごとの固定容量のスロットとして初期化時に確保し、発射ごとに使い回す
+/// 生存中の弾は種類を問わず1つの ProjectileBatch に詰めて持ち、移動・範囲外判定・エフェクト位置の反映を
+/// 1フレーム1回の走査で行う（削除は末尾の弾を移す swap-and-pop）
+/// 寿命は発射時に TimingWheel へ期限を登録し、期限の来た弾だけを受け取る
+/// ボスの弾の当たり判定は CollisionManager の総当たりに乗せず、CheckCollisions で位置の配列に対して一括で行う
+/// 空きスロットは種類ごとの FIFO の空きリストで管理し、解放直後のスロットの一時エミッター名がすぐ使い回されないようにする
+/// 種類を増やすときは ProjectileKind に追加して Initialize で RegisterKind を呼ぶだけでよく、走査の回数は増えない
+/// </summary>
+class ProjectileManager {
+    // 爆発エフェクトの一時エミッターの寿命（秒）
+    static constexpr float kExplodeDuration = 0.5f;
+
+    // 種類の数
+    static constexpr size_t kKindCount = static_cast<size_t>(ProjectileKind::Count);
+
+public:
+    /// <summary>
+    /// 種類ごとの統計
+    /// </summary>
+    struct Stats {
+        uint32_t capacity = 0;      // スロット数
+        uint32_t activeCount = 0;   // 使用中のスロット数
+        uint32_t highWater = 0;     // 使用中スロット数の最大値
+        uint64_t acquireCount = 0;  // 取得した回数
+        uint64_t exhaustCount = 0;  // 空きが無く発射を見送った回数
+    };
+
+    /// <summary>
+    /// 初期化（全種類のスロットの弾とエミッターを生成）
+    /// </summary>
+    /// <param name="emitterManager">エミッターマネージャー</param>
+    void Initialize(Tako::EmitterManager* emitterManager);
+
+    /// <summary>
+    /// 終了処理（使用中の弾を終了させ、全スロットのエミッターを削除して弾を破棄）
+    /// EmitterManager の破棄より前に呼ぶこと
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 空きスロットの弾を初期化して発射（同じフレームの Update より前に呼ぶ）
+    /// </summary>
+    /// <param name="kind">弾の種類</param>
+    /// <param name="position">初期位置</param>
+    /// <param name="velocity">速度</param>
+    /// <returns>弾（空きが無ければ nullptr）</returns>
+    Projectile* Spawn(ProjectileKind kind, const Tako::Vector3& position, const Tako::Vector3& velocity);
+
+    /// <summary>
+    /// 弾生成リクエストの連続配列をまとめて発射（空きが尽きたら残りは見送る）
+    /// </summary>
+    /// <param name="kind">弾の種類</param>
+    /// <param name="requests">弾生成リクエスト</param>
+    void SpawnBatch(ProjectileKind kind, std::span<const BulletSpawnRequest> requests);
+
+    /// <summary>
+    /// 全種類の使用中の弾を更新し、非アクティブになった弾をスロットに返す
+    /// </summary>
+    /// <param name="deltaTime">前フレームからの経過時間</param>
+    void Update(float deltaTime);
+
+    /// <summary>
+    /// ボスの弾とプレイヤー本体・近接攻撃・プレイヤーの弾の当たり判定を一括で行い、重なった組のコライダーに接触開始を通知する
+    /// 判定の回数はボスの弾の数に比例し、CollisionManager には何も登録しない
+    /// プレイヤーの弾がボスに当たった結果を反映するため、CollisionManager::CheckAllCollisions の後に呼ぶ
+    /// </summary>
+    /// <param name="playerBody">プレイヤーの体のコライダー（回転させない箱として扱う）</param>
+    /// <param name="meleeAttack">プレイヤーの近接攻撃のコライダー（アクティブな間だけ、向きに合わせて回した箱として扱う）</param>
+    void CheckCollisions(Tako::OBBCollider* playerBody, MeleeAttackCollider* meleeAttack);
+
+    /// <summary>
+    /// 使用中の弾をすべて終了させてスロットに返す
+    /// </summary>
+    void ReleaseAll();
+
+    /// <summary>
+    /// 使用中の弾ごとに処理を行う（種類は混在し、順序は保証しない）
+    /// </summary>
+    /// <param name="func">弾と種類を受け取る関数</param>
+    template<typename Func>
+    void ForEachActive(Func&& func) const {
+        for (uint32_t i = 0; i < batch_.GetCount(); ++i) {
+            uint32_t slot = batch_.GetId(i);
+            func(*slots_[slot], slotKinds_[slot]);
+        }
+    }
+
+    /// <summary>
+    /// 使用中の弾の数（全種類）
+    /// </summary>
+    size_t GetActiveCount() const { return batch_.GetCount(); }
+
+    /// <summary>
+    /// 使用中の弾の数（種類ごと）
+    /// </summary>
+    size_t GetActiveCount(ProjectileKind kind) const { return GetStats(kind).activeCount; }
+
+    /// <summary>
+    /// 空きが無く発射を見送った回数（全種類）
+    /// </summary>
+    uint64_t GetExhaustCount() const;
+
+    /// <summary>
+    /// 統計を取得
+    /// </summary>
+    const Stats& GetStats(ProjectileKind kind) const { return kinds_[static_cast<size_t>(kind)].stats; }
+
+    /// <summary>
+    /// スロットの弾の種類を取得
+    /// </summary>
+    /// <param name="slot">スロット番号（ProjectileBatch の識別番号）</param>
+    ProjectileKind GetKind(uint32_t slot) const { return slotKinds_[slot]; }
+
+    /// <summary>
+    /// スロットの弾を取得
+    /// </summary>
+    /// <param name="slot">スロット番号（ProjectileBatch の識別番号）</param>
+    Projectile& GetProjectile(uint32_t slot) const { return *slots_[slot]; }
+
+    /// <summary>
+    /// 一括計算のデータを取得（位置の配列を使う一括処理用。識別番号はスロット番号）
+    /// </summary>
+    const ProjectileBatch& GetBatch() const { return batch_; }
+
+    /// <summary>
+    /// 種類の名前（デバッグ表示用）
+    /// </summary>
+    static const char* GetKindName(ProjectileKind kind);
+
+private:
+    /// <summary>
+    /// 種類ごとのスロットの範囲・エミッター・空きリスト
+    /// </summary>
+    struct KindData {
+        uint32_t firstSlot = 0;                 // 最初のスロット番号
+        uint32_t simulationFlags = 0;           // 一括計算での挙動
+        EmitterHandlePool trailEmitters;        // 軌跡エフェクトのエミッター
+        EmitterHandlePool explodeEmitters;      // 爆発エフェクトのエミッター
+        std::vector<uint32_t> freeList;         // 空きスロット番号のリングバッファ
+        uint32_t freeHead = 0;
+        uint32_t freeCount = 0;
+        Stats stats;
+    };
+
+    /// <summary>
+    /// 種類を登録し、スロットを確保
+    /// </summary>
+    /// <template name="T">弾の型（kSimulationFlags・kTrailEmitterPreset・kExplodeEmitterPreset を持つ）</template>
+    /// <param name="kind">弾の種類</param>
+    /// <param name="capacity">スロット数</param>
+    template<typename T>
+    void RegisterKind(ProjectileKind kind, uint32_t capacity);
+
+    /// <summary>
+    /// 弾を終了させ、一括計算から外して種類ごとの空きリストの末尾に返す
+    /// </summary>
+    /// <param name="slot">スロット番号</param>
+    void Release(uint32_t slot);
+
+    /// <summary>
+    /// ボスの弾と相手のコライダーの双方に接触開始を通知（CollisionManager と同じ順序）
+    /// </summary>
+    /// <param name="slot">ボスの弾のスロット番号</param>
+    /// <param name="other">相手のコライダー</param>
+    void NotifyHit(uint32_t slot, Tako::Collider* other);
+
+    Tako::EmitterManager* emitterManager_ = nullptr;
+
+    // 全種類のスロットの弾（コライダーが弾のアドレスを保持するため個別に確保して動かさない）
+    std::vector<std::unique_ptr<Projectile>> slots_;
+    std::vector<ProjectileKind> slotKinds_;
+
+    // スロットごとに割り当てたエミッターのハンドル
+    std::vector<EmitterHandle> trailHandles_;
+    std::vector<EmitterHandle> explodeHandles_;
+
+    // 寿命の期限（スロット番号を値として登録）と、スロットごとのハンドル
+    TimingWheel lifetimeTimers_;
+    std::vector<TimerHandle> lifetimeHandles_;
+
+    // 種類ごとのデータ
+    std::array<KindData, kKindCount> kinds_;
+
+    // 使用中の全種類の弾の移動・範囲外判定（スロット番号を識別番号として登録）
+    ProjectileBatch batch_;
+
+    // 今フレームに返すスロット番号（確保済みの作業領域）
+    std::vector<uint32_t> retired_;
+    std::vector<uint32_t> lifetimeExpired_;
+    std::vector<uint32_t> hitSlots_;
+};
@@ -25,7 +25,6 @@
 #include "CameraSystem/Controller/ThirdPersonController.h"
 #include "CameraSystem/Controller/TopDownController.h"
 #include "CameraSystem/Controller/CameraAnimationController.h"
-#include "../Object/Projectile/BossBullet.h"
 #include "Object/Player/State/PlayerState.h"
 #include "Object/Player/State/PlayerStateMachine.h"
 
@@ -93,6 +92,9 @@ void GameScene::Initialize()
     // エミッターマネージャーの初期化
     InitializeEmitterManger();
 
+    // 弾の初期化（弾・モデル・コライダー・エミッターを事前に確保）
+    projectileManager_.Initialize(emitterManager_.get());
+
     // エフェクトマネージャーの初期化
     InitializeEffectManager();
 
@@ -127,6 +129,9 @@ void GameScene::Finalize()
         cameraManager_->Finalize();
     }
 
+    // 弾の終了処理（エミッターマネージャーより先に）
+    projectileManager_.Finalize();
+
     // CollisionManager のリセット
     CollisionManager::GetInstance()->Reset();
 
@@ -221,14 +226,8 @@ void GameScene::Update()
     controllerUI_->Update();
     cameraManager_->Update(FrameTimer::GetInstance()->GetDeltaTime());
 
-    // ボスからの弾生成リクエストを処理
-    CreateBossBullet();
-
-    // ボスからの貫通弾生成リクエストを処理
-    CreatePenetratingBossBullet();
-
-    // プレイヤーからの弾生成リクエストを処理
-    CreatePlayerBullet();
+    // ボス・プレイヤーからの弾生成リクエストを処理
+    CreateProjectiles();
 
     // プロジェクタイルの更新
     float deltaTime = FrameTimer::GetInstance()->GetDeltaTime();
@@ -259,8 +258,9 @@ void GameScene::Update()
         SceneManager::GetInstance()->ChangeScene("clear", "Fade", 0.3f);
     }
 
-    // 衝突判定の実行
+    // 衝突判定の実行（ボスの弾は CollisionManager に登録せず、弾専用の一括判定で扱う）
     CollisionManager::GetInstance()->CheckAllCollisions();
+    projectileManager_.CheckCollisions(player_->GetBodyCollider(), player_->GetMeleeAttackCollider());
 }
 
 void GameScene::Draw()
@@ -394,86 +394,15 @@ void GameScene::UpdateInput()
 
 void GameScene::UpdateProjectiles(float deltaTime)
 {
-    // ボスの弾の更新
-    for (auto& bullet : bossBullets_) {
-        if (bullet && bullet->IsActive()) {
-            bullet->Update(deltaTime);
-        }
-    }
-
-    // 非アクティブなボスの弾を削除
-    std::erase_if(bossBullets_,
-        [](const std::unique_ptr<BossBullet>& bullet) {
-            if (bullet && !bullet->IsActive()) {
-                // Finalize()で自動的にコライダーが削除される
-                bullet->Finalize();
-                return true;
-            }
-            return false;
-        });
-
-    // プレイヤーの弾の更新
-    for (auto& bullet : playerBullets_) {
-        if (bullet && bullet->IsActive()) {
-            bullet->Update(deltaTime);
-        }
-    }
-
-    // 非アクティブなプレイヤーの弾を削除
-    std::erase_if(playerBullets_,
-        [](const std::unique_ptr<PlayerBullet>& bullet) {
-            if (bullet && !bullet->IsActive()) {
-                // Finalize()で自動的にコライダーが削除される
-                bullet->Finalize();
-                return true;
-            }
-            return false;
-        });
-
-    // 貫通弾の更新
-    for (auto& bullet : penetratingBossBullets_) {
-        if (bullet && bullet->IsActive()) {
-            bullet->Update(deltaTime);
-        }
-    }
-
-    // 非アクティブな貫通弾を削除
-    std::erase_if(penetratingBossBullets_,
-        [](const std::unique_ptr<PenetratingBossBullet>& bullet) {
-            if (bullet && !bullet->IsActive()) {
-                // Finalize()で自動的にコライダーが削除される
-                bullet->Finalize();
-                return true;
-            }
-            return false;
-        });
-}
-
-void GameScene::CreateBossBullet()
-{
-    for (const auto& request : boss_->ConsumePendingBullets()) {
-        auto bullet = std::make_unique<BossBullet>(emitterManager_.get());
-        bullet->Initialize(request.position, request.velocity);
-        bossBullets_.push_back(std::move(bullet));
-    }
+    // 全種類の弾を1回で更新（非アクティブになった弾は Finalize してスロットに戻す）
+    projectileManager_.Update(deltaTime);
 }
 
-void GameScene::CreatePlayerBullet()
+void GameScene::CreateProjectiles()
 {
-    for (const auto& request : player_->ConsumePendingBullets()) {
-        auto bullet = std::make_unique<PlayerBullet>(emitterManager_.get());
-        bullet->Initialize(request.position, request.velocity);
-        playerBullets_.push_back(std::move(bullet));
-    }
-}
-
-void GameScene::CreatePenetratingBossBullet()
-{
-    for (const auto& request : boss_->ConsumePendingPenetratingBullets()) {
-        auto bullet = std::make_unique<PenetratingBossBullet>(emitterManager_.get());
-        bullet->Initialize(request.position, request.velocity);
-        penetratingBossBullets_.push_back(std::move(bullet));
-    }
+    projectileManager_.SpawnBatch(ProjectileKind::BossBullet, boss_->ConsumePendingBullets());
+    projectileManager_.SpawnBatch(ProjectileKind::PenetratingBossBullet, boss_->ConsumePendingPenetratingBullets());
+    projectileManager_.SpawnBatch(ProjectileKind::PlayerBullet, player_->ConsumePendingBullets());
 }
 
 void GameScene::InitializeDebugOption()
@@ -514,6 +443,19 @@ void GameScene::InitializeDebugOption()
     DebugUIManager::GetInstance()->RegisterGameObject("PauseMenu",
         [this]() { if (pauseMenu_) pauseMenu_->DrawImGui(); });
 
+    // 弾スロットの使用状況
+    DebugUIManager::GetInstance()->RegisterGameObject("Projectiles",
+        [this]() {
+            ImGui::Text("Active: %zu", projectileManager_.GetActiveCount());
+            for (size_t i = 0; i < static_cast<size_t>(ProjectileKind::Count); ++i) {
+                ProjectileKind kind = static_cast<ProjectileKind>(i);
+                const ProjectileManager::Stats& stats = projectileManager_.GetStats(kind);
+                ImGui::Text("%s: %u / %u (peak %u, dropped %llu)", ProjectileManager::GetKindName(kind),
+                    stats.activeCount, stats.capacity, stats.highWater,
+                    static_cast<unsigned long long>(stats.exhaustCount));
+            }
+        });
+
     DebugUIManager::GetInstance()->SetEmitterManager(emitterManager_.get());
 #endif
 }
@@ -672,18 +614,20 @@ void GameScene::InitializeEffectManager()
 
 void GameScene::SetCameraAnimation()
 {
-    // ゲーム開始アニメーションを再生
+    // ゲーム開始アニメーションを再生（出荷用の演出は一定間隔のトラックにベイクして再生する）
     animationController_->LoadAnimationFromFile("game_start");
+    animationController_->BakeAnimation("game_start");
     cameraManager_->ActivateController("Animation");
     animationController_->SwitchAnimation("game_start");
     animationController_->Play();
 
-    // オーバー演出アニメーションの読み込みと設定
-    animationController_->LoadAnimationFromFile("over_anim");
+    // オーバー・クリア演出は決着まで使わないので、ワーカースレッドで読み込みとベイクを済ませておく
+    // （間に合わなければ SwitchAnimation で完了を待つ）
+    // clear_anim は回転も FOV も変わらずキーフレームからの再生と速さが変わらないので、ベイクしない
+    animationController_->PrefetchAnimation("over_anim", BakedCameraTrack::BakeSettings{});
     animationController_->SetAnimationTargetByName("over_anim", player_->GetTransformPtr());
 
-    // クリア演出アニメーションの読み込みと設定
-    animationController_->LoadAnimationFromFile("clear_anim");
+    animationController_->PrefetchAnimation("clear_anim");
     animationController_->SetAnimationTargetByName("clear_anim", boss_->GetTransformPtr());
 }
 
@@ -5,9 +5,7 @@
 #include "Object/Boss/Boss.h"
 #include "Object/Player/Player.h"
 #include "Input/InputHandler.h"
-#include "../Object/Projectile/BossBullet.h"
-#include "../Object/Projectile/PlayerBullet.h"
-#include "../Object/Projectile/PenetratingBossBullet.h"
+#include "../Object/Projectile/ProjectileManager.h"
 #include "../Effect/OverEffectManager.h"
 #include "../Effect/ClearEffectManager.h"
 #include "../Effect/BossBorderParticleManager.h"
@@ -83,19 +81,9 @@ public: // メンバ関数
     void UpdateProjectiles(float deltaTime);
 
     /// <summary>
-    /// ボスの弾の生成処理
+    /// ボス・プレイヤーの弾生成リクエストから弾を生成
     /// </summary>
-    void CreateBossBullet();
-
-    /// <summary>
-    /// プレイヤーの弾の生成処理
-    /// </summary>
-    void CreatePlayerBullet();
-
-    /// <summary>
-    /// 貫通弾の生成処理
-    /// </summary>
-    void CreatePenetratingBossBullet();
+    void CreateProjectiles();
 
     /// <summary>
     /// デバッグ用オプション初期化
@@ -147,11 +135,7 @@ private: // メンバ変数
 
     std::unique_ptr<Boss> boss_;                                // ボスキャラクター
 
-    std::vector<std::unique_ptr<BossBullet>> bossBullets_;      // ボスの弾のコンテナ
-
-    std::vector<std::unique_ptr<PlayerBullet>> playerBullets_;  // プレイヤーの弾のコンテナ
-
-    std::vector<std::unique_ptr<PenetratingBossBullet>> penetratingBossBullets_;  // 貫通弾のコンテナ
+    ProjectileManager projectileManager_;                       // 全種類の弾の管理
 
     std::unique_ptr<InputHandler> inputHandler_;                // 入力ハンドラー
 